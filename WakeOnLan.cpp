@@ -0,0 +1,5238 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Wake-on-LAN(WOL) 라이브러리 구현
+///
+/// @details
+/// WakeOnLan.h에 선언한 함수와 클래스 멤버 함수의 구현
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WakeOnLanInternal.h"
+
+namespace WakeOnLan
+{
+    std::wstring WolErrorCodeToString(_In_ const WolErrorCode result) noexcept
+    {
+        switch (result)
+        {
+        case WolErrorCode::Success: return {L"성공\n"};
+
+        case WolErrorCode::FailedToGetExecutionPath: return {L"실행 파일 경로를 얻을 수 없음\n"};
+        case WolErrorCode::InvalidExecutionPath: return {L"유효하지 않은 실행 파일 경로\n"};
+
+        case WolErrorCode::ConfigFileNotFound: return {CONFIG_FILE_NAME L"파일을 찾을 수 없음\n"};
+        case WolErrorCode::CannotAccessConfigFile: return {CONFIG_FILE_NAME L"파일에 접근 권한이 없음\n"};
+        case WolErrorCode::TargetNotFound: return {CONFIG_FILE_NAME L"파일에서 대상 섹션을 찾을 수 없음\n"};
+        case WolErrorCode::FailedToReadMacAddress: return {L"Config 파일에서 Mac 주소를 읽을 수 없음\n"};
+        case WolErrorCode::InvalidMacAddress: return {L"잘못된 MAC 주소\n"};
+        case WolErrorCode::FailedToReadBroadcastIp: return {L"Config 파일에서 브로드캐스트 주소를 읽을 수 없음\n"};
+        case WolErrorCode::InvalidBroadcastIp: return {L"잘못된 브로드캐스트 주소\n"};
+        case WolErrorCode::FailedToReadPort: return {L"Config 파일에서 포트 읽을 수 없음\n"};
+        case WolErrorCode::InvalidPort: return {L"잘못된 포트 번호\n"};
+
+        case WolErrorCode::WinsockInitializationFailed: return {L"WinSock 초기화 실패\n"};
+        case WolErrorCode::SocketCreationFailed: return {L"소켓 생성 실패\n"};
+        case WolErrorCode::BroadcastSetupFailed: return {L"브로드캐스트 설정 실패\n"};
+        case WolErrorCode::PacketSendFailed: return {L"패킷 전송 실패\n"};
+
+        case WolErrorCode::ControlSocketFailed: return {L"제어 소켓 오류\n"};
+        case WolErrorCode::DaemonAlreadyRunning: return {L"서비스가 이미 실행 중\n"};
+        case WolErrorCode::DaemonNotRunning: return {L"서비스에 연결할 수 없음\n"};
+        case WolErrorCode::InvalidCommand: return {L"알 수 없는 명령\n"};
+
+        case WolErrorCode::InvalidArgument: return {L"잘못된 명령줄 옵션\n"};
+
+        case WolErrorCode::InvalidHostIp: return {L"대상 IP 주소가 없거나 잘못됨\n"};
+        case WolErrorCode::HostNotResponding: return {L"대상이 응답하지 않음\n"};
+        case WolErrorCode::ProbeUnavailable: return {L"확인 방법을 사용할 수 없음\n"};
+
+        case WolErrorCode::InvalidRack: return {L"랙 번호가 잘못됨\n"};
+
+        case WolErrorCode::InterfaceNotFound: return {L"네트워크 인터페이스를 찾을 수 없음\n"};
+        case WolErrorCode::InterfaceBindFailed: return {L"네트워크 인터페이스에 바인딩 실패\n"};
+
+        case WolErrorCode::UnexpectedException: return {L"예기치 않은 오류 발생\n"};
+        }
+
+        // 모든 조건을 위 Switch 문에서 처리해야 함
+        assert(false);
+        return {L""};
+    }
+
+    const wchar_t* WolErrorCodeToName(_In_ const WolErrorCode result) noexcept
+    {
+        switch (result)
+        {
+        case WolErrorCode::Success: return L"Success";
+
+        case WolErrorCode::FailedToGetExecutionPath: return L"FailedToGetExecutionPath";
+        case WolErrorCode::InvalidExecutionPath: return L"InvalidExecutionPath";
+
+        case WolErrorCode::ConfigFileNotFound: return L"ConfigFileNotFound";
+        case WolErrorCode::CannotAccessConfigFile: return L"CannotAccessConfigFile";
+        case WolErrorCode::TargetNotFound: return L"TargetNotFound";
+        case WolErrorCode::FailedToReadMacAddress: return L"FailedToReadMacAddress";
+        case WolErrorCode::InvalidMacAddress: return L"InvalidMacAddress";
+        case WolErrorCode::FailedToReadBroadcastIp: return L"FailedToReadBroadcastIp";
+        case WolErrorCode::InvalidBroadcastIp: return L"InvalidBroadcastIp";
+        case WolErrorCode::FailedToReadPort: return L"FailedToReadPort";
+        case WolErrorCode::InvalidPort: return L"InvalidPort";
+
+        case WolErrorCode::WinsockInitializationFailed: return L"WinsockInitializationFailed";
+        case WolErrorCode::SocketCreationFailed: return L"SocketCreationFailed";
+        case WolErrorCode::BroadcastSetupFailed: return L"BroadcastSetupFailed";
+        case WolErrorCode::PacketSendFailed: return L"PacketSendFailed";
+
+        case WolErrorCode::ControlSocketFailed: return L"ControlSocketFailed";
+        case WolErrorCode::DaemonAlreadyRunning: return L"DaemonAlreadyRunning";
+        case WolErrorCode::DaemonNotRunning: return L"DaemonNotRunning";
+        case WolErrorCode::InvalidCommand: return L"InvalidCommand";
+
+        case WolErrorCode::InvalidArgument: return L"InvalidArgument";
+
+        case WolErrorCode::InvalidHostIp: return L"InvalidHostIp";
+        case WolErrorCode::HostNotResponding: return L"HostNotResponding";
+        case WolErrorCode::ProbeUnavailable: return L"ProbeUnavailable";
+
+        case WolErrorCode::InvalidRack: return L"InvalidRack";
+
+        case WolErrorCode::InterfaceNotFound: return L"InterfaceNotFound";
+        case WolErrorCode::InterfaceBindFailed: return L"InterfaceBindFailed";
+
+        case WolErrorCode::UnexpectedException: return L"UnexpectedException";
+        }
+
+        // 모든 조건을 위 Switch 문에서 처리해야 함
+        assert(false);
+        return L"";
+    }
+
+    bool EqualsIgnoreCase(_In_ const std::wstring_view lhs, _In_ const std::wstring_view rhs) noexcept
+    {
+        return lhs.length() == rhs.length()
+            && std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](const wchar_t l, const wchar_t r) noexcept
+            {
+                return ::towlower(static_cast<wint_t>(l)) == ::towlower(static_cast<wint_t>(r));
+            });
+    }
+
+    std::wstring_view TrimWhitespace(_In_ std::wstring_view text) noexcept
+    {
+        while (text.empty() == false && ::iswspace(static_cast<wint_t>(text.front())))
+            text.remove_prefix(1U);
+        while (text.empty() == false && ::iswspace(static_cast<wint_t>(text.back())))
+            text.remove_suffix(1U);
+        return text;
+    }
+
+    std::wstring ToLowerCase(_In_ const std::wstring_view text)
+    {
+        std::wstring result{text};
+        for (wchar_t& ch : result)
+        {
+            ch = static_cast<wchar_t>(::towlower(static_cast<wint_t>(ch)));
+        }
+
+        return result;
+    }
+
+    std::wstring Utf8ToWide(_In_ const std::string_view text)
+    {
+        constexpr wchar_t replacement = static_cast<wchar_t>(0xFFFD);
+
+        std::wstring result{};
+        result.reserve(text.length());
+
+        for (std::size_t i = 0U; i < text.length();)
+        {
+            const auto lead = static_cast<unsigned char>(text[i]);
+
+            // 선행 바이트로 전체 바이트 수 결정
+            std::size_t length = 0U;
+            char32_t codePoint = 0U;
+            if (lead < 0x80U) { length = 1U; codePoint = lead; }
+            else if ((lead & 0xE0U) == 0xC0U) { length = 2U; codePoint = lead & 0x1FU; }
+            else if ((lead & 0xF0U) == 0xE0U) { length = 3U; codePoint = lead & 0x0FU; }
+            else if ((lead & 0xF8U) == 0xF0U) { length = 4U; codePoint = lead & 0x07U; }
+
+            if (length == 0U || i + length > text.length())
+            {
+                result.push_back(replacement);
+                ++i;
+                continue;
+            }
+
+            // 후속 바이트는 10xxxxxx 형식이어야 함
+            bool valid = true;
+            for (std::size_t j = 1U; j < length; ++j)
+            {
+                const auto next = static_cast<unsigned char>(text[i + j]);
+                if ((next & 0xC0U) != 0x80U)
+                {
+                    valid = false;
+                    break;
+                }
+                codePoint = (codePoint << 6U) | (next & 0x3FU);
+            }
+
+            if (valid == false)
+            {
+                result.push_back(replacement);
+                ++i;
+                continue;
+            }
+
+            if constexpr (sizeof(wchar_t) == 2U)
+            {
+                // BMP 밖의 문자는 UTF-16 서로게이트 쌍으로 변환
+                if (codePoint >= 0x10000U)
+                {
+                    codePoint -= 0x10000U;
+                    result.push_back(static_cast<wchar_t>(0xD800U + (codePoint >> 10U)));
+                    result.push_back(static_cast<wchar_t>(0xDC00U + (codePoint & 0x3FFU)));
+                    i += length;
+                    continue;
+                }
+            }
+
+            result.push_back(static_cast<wchar_t>(codePoint));
+            i += length;
+        }
+
+        return result;
+    }
+
+    std::string WideToUtf8(_In_ const std::wstring_view text)
+    {
+        constexpr char32_t replacement = 0xFFFDU;
+
+        std::string result{};
+        result.reserve(text.length());
+
+        for (std::size_t i = 0U; i < text.length(); ++i)
+        {
+            auto codePoint = static_cast<char32_t>(text[i]);
+            if constexpr (sizeof(wchar_t) == 2U)
+            {
+                codePoint &= 0xFFFFU;
+                if (codePoint >= 0xD800U && codePoint <= 0xDBFFU && i + 1U < text.length()
+                    && (static_cast<char32_t>(text[i + 1U]) & 0xFC00U) == 0xDC00U)
+                {
+                    codePoint = 0x10000U + ((codePoint - 0xD800U) << 10U)
+                        + ((static_cast<char32_t>(text[i + 1U]) & 0xFFFFU) - 0xDC00U);
+                    ++i;
+                }
+            }
+
+            if ((codePoint >= 0xD800U && codePoint <= 0xDFFFU) || codePoint > 0x10FFFFU)
+                codePoint = replacement;
+
+            if (codePoint < 0x80U)
+            {
+                result.push_back(static_cast<char>(codePoint));
+            }
+            else if (codePoint < 0x800U)
+            {
+                result.push_back(static_cast<char>(0xC0U | (codePoint >> 6U)));
+                result.push_back(static_cast<char>(0x80U | (codePoint & 0x3FU)));
+            }
+            else if (codePoint < 0x10000U)
+            {
+                result.push_back(static_cast<char>(0xE0U | (codePoint >> 12U)));
+                result.push_back(static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3FU)));
+                result.push_back(static_cast<char>(0x80U | (codePoint & 0x3FU)));
+            }
+            else
+            {
+                result.push_back(static_cast<char>(0xF0U | (codePoint >> 18U)));
+                result.push_back(static_cast<char>(0x80U | ((codePoint >> 12U) & 0x3FU)));
+                result.push_back(static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3FU)));
+                result.push_back(static_cast<char>(0x80U | (codePoint & 0x3FU)));
+            }
+        }
+
+        return result;
+    }
+
+    void IniFile::Section::GetValue(_In_ const std::wstring_view key, _In_ const std::wstring_view defaultValue,
+                                    _Out_ std::wstring& value) const
+    {
+        for (const Key& entry : mKeys)
+        {
+            if (EqualsIgnoreCase(entry.mName, key))
+            {
+                value = entry.mValue;
+                return;
+            }
+        }
+
+        value.assign(defaultValue);
+    }
+
+    WolErrorCode IniFile::Load(_In_ const std::wstring& path)
+    {
+        mSections.clear();
+        mSectionIndex.clear();
+
+        std::string content{};
+        const WolErrorCode errorCode = ReadContent(path, content);
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        Parse(content);
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode IniFile::ReadContent(_In_ const std::wstring& path, _Out_ std::string& content)
+    {
+        content.clear();
+
+        std::ifstream file{std::filesystem::path{path}, std::ios::binary};
+        if (file.is_open() == false)
+        {
+            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일을 열 수 없습니다: %ls\n", path.c_str());
+            return WolErrorCode::CannotAccessConfigFile;
+        }
+
+        content.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+        return WolErrorCode::Success;
+    }
+
+    void IniFile::SplitSections(_In_ std::string_view content, _Out_ std::vector<std::string_view>& chunks)
+    {
+        chunks.clear();
+
+        // UTF-8 BOM 제거
+        if (content.substr(0U, 3U) == "\xEF\xBB\xBF")
+            content.remove_prefix(3U);
+
+        std::size_t chunkBegin = 0U;
+        std::size_t lineBegin = 0U;
+        while (lineBegin < content.length())
+        {
+            const std::size_t firstChar = content.find_first_not_of(" \t", lineBegin);
+            if (firstChar != std::string_view::npos && content[firstChar] == '[' && lineBegin != chunkBegin)
+            {
+                chunks.push_back(content.substr(chunkBegin, lineBegin - chunkBegin));
+                chunkBegin = lineBegin;
+            }
+
+            const std::size_t lineEnd = content.find('\n', lineBegin);
+            lineBegin = lineEnd == std::string_view::npos ? content.length() : lineEnd + 1U;
+        }
+
+        if (chunkBegin < content.length())
+            chunks.push_back(content.substr(chunkBegin));
+    }
+
+    void IniFile::Parse(_In_ std::string_view content)
+    {
+        mSections.clear();
+        mSectionIndex.clear();
+
+        // UTF-8 BOM 제거
+        if (content.substr(0U, 3U) == "\xEF\xBB\xBF")
+            content.remove_prefix(3U);
+
+        const std::wstring wideText = Utf8ToWide(content);
+        std::wstring_view remaining{wideText};
+        Section* currentSection = nullptr;
+
+        while (remaining.empty() == false)
+        {
+            const std::size_t lineEnd = remaining.find(L'\n');
+            const std::wstring_view line = TrimWhitespace(remaining.substr(0U, lineEnd));
+            remaining.remove_prefix(lineEnd == std::wstring_view::npos ? remaining.length() : lineEnd + 1U);
+
+            if (line.empty() || line.front() == L';')
+                continue;
+
+            if (line.front() == L'[')
+            {
+                const std::size_t sectionEnd = line.find(L']');
+                if (sectionEnd == std::wstring_view::npos)
+                    continue;
+
+                Section& section = mSections.emplace_back();
+                section.mName = TrimWhitespace(line.substr(1U, sectionEnd - 1U));
+                mSectionIndex.try_emplace(ToLowerCase(section.mName), mSections.size() - 1U);
+                currentSection = &section;
+                continue;
+            }
+
+            const std::size_t separator = line.find(L'=');
+            if (currentSection == nullptr || separator == std::wstring_view::npos)
+                continue;
+
+            const std::wstring_view key = TrimWhitespace(line.substr(0U, separator));
+            if (key.empty())
+                continue;
+
+            // 같은 섹션에 같은 키가 다시 나타나면 첫 번째 값을 유지
+            const bool duplicated = std::any_of(currentSection->mKeys.begin(), currentSection->mKeys.end(),
+                                                [key](const Key& entry) noexcept
+                                                {
+                                                    return EqualsIgnoreCase(entry.mName, key);
+                                                });
+            if (duplicated)
+                continue;
+
+            currentSection->mKeys.push_back({std::wstring{key}, std::wstring{TrimWhitespace(line.substr(separator + 1U))}});
+        }
+    }
+
+    const IniFile::Section* IniFile::FindSection(_In_ const std::wstring_view name) const
+    {
+        const auto found = mSectionIndex.find(ToLowerCase(name));
+        return found != mSectionIndex.end() ? &mSections[found->second] : nullptr;
+    }
+
+    bool ResolveScopeId(_In_ const std::wstring_view scope, _Out_ std::uint32_t& scopeId) noexcept
+    {
+        scopeId = 0U;
+        if (scope.empty())
+            return true;
+
+        if (std::all_of(scope.begin(), scope.end(), [](const wchar_t ch) { return ch >= L'0' && ch <= L'9'; }))
+        {
+            std::uint64_t value = 0U;
+            for (const wchar_t ch : scope)
+            {
+                value = (value * 10U) + static_cast<std::uint64_t>(ch - L'0');
+                if (value > UINT32_MAX)
+                    return false;
+            }
+
+            scopeId = static_cast<std::uint32_t>(value);
+            return true;
+        }
+
+        try
+        {
+            scopeId = ::if_nametoindex(WideToUtf8(scope).c_str());
+        }
+        catch (...)
+        {
+            scopeId = 0U;
+        }
+
+        return scopeId != 0U;
+    }
+
+    void FormatIpv6Address(_In_ const Ipv6Multicast& multicast, _Out_ std::array<wchar_t, 64U>& text) noexcept
+    {
+        std::array<std::uint32_t, 8U> groups{};
+        for (std::size_t i = 0U; i < groups.size(); ++i)
+        {
+            groups[i] = (static_cast<std::uint32_t>(multicast.mGroup[i * 2U]) << 8U) | multicast.mGroup[(i * 2U) + 1U];
+        }
+
+        // 가장 긴(같으면 앞쪽) 0 그룹 구간
+        std::size_t gapStart = groups.size();
+        std::size_t gapLength = 1U;
+        for (std::size_t i = 0U; i < groups.size();)
+        {
+            std::size_t length = 0U;
+            while (i + length < groups.size() && groups[i + length] == 0U)
+            {
+                ++length;
+            }
+
+            if (length > gapLength)
+            {
+                gapStart = i;
+                gapLength = length;
+            }
+
+            i += length != 0U ? length : 1U;
+        }
+
+        std::size_t length = 0U;
+        const auto append = [&](const wchar_t* const format, const auto value) noexcept
+        {
+            const int written = std::swprintf(text.data() + length, text.size() - length, format, value);
+            if (written > 0)
+                length = (std::min)(length + static_cast<std::size_t>(written), text.size() - 1U);
+        };
+
+        text[0] = L'\0';
+        for (std::size_t i = 0U; i < groups.size(); ++i)
+        {
+            if (i == gapStart)
+            {
+                append(L"%ls", L"::");
+                i += gapLength - 1U;
+                continue;
+            }
+
+            append(i == 0U || i == gapStart + gapLength ? L"%x" : L":%x", groups[i]);
+        }
+
+        if (multicast.mScopeId != 0U)
+        {
+            std::array<char, IF_NAMESIZE> name{};
+            if (::if_indextoname(multicast.mScopeId, name.data()) != nullptr)
+                append(L"%%%hs", name.data());
+            else
+                append(L"%%%u", multicast.mScopeId);
+        }
+    }
+
+    void FormatMacAddress(_In_ const MacAddress& macAddress,
+                          _Out_ std::array<wchar_t, MAC_ADDRESS_SEPARATED_LENGTH + 1U>& text) noexcept
+    {
+        constexpr std::wstring_view hexDigits{L"0123456789ABCDEF"};
+
+        for (std::size_t i = 0U; i < macAddress.size(); ++i)
+        {
+            const auto value = std::to_integer<std::size_t>(macAddress[i]);
+            text[i * 3U] = hexDigits[value >> 4U];
+            text[(i * 3U) + 1U] = hexDigits[value & 0x0FU];
+            text[(i * 3U) + 2U] = L'-';
+        }
+
+        text[MAC_ADDRESS_SEPARATED_LENGTH] = L'\0';
+    }
+
+    void FormatIpv4Address(_In_ const std::uint32_t address, _Out_ std::array<wchar_t, 16U>& text) noexcept
+    {
+        const std::uint32_t hostAddress = ntohl(address);
+        std::ignore = std::swprintf(text.data(), text.size(), L"%u.%u.%u.%u", (hostAddress >> 24U) & 0xFFU,
+                                    (hostAddress >> 16U) & 0xFFU, (hostAddress >> 8U) & 0xFFU, hostAddress & 0xFFU);
+    }
+
+    bool MappedFile::Open(_In_ const std::wstring& path) noexcept
+    {
+        Close();
+
+#ifdef _WIN32
+        mFile = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+        if (mFile == INVALID_HANDLE_VALUE)
+            return false;
+
+        // 크기가 0인 파일은 매핑할 수 없음
+        LARGE_INTEGER fileSize{};
+        if (::GetFileSizeEx(mFile, &fileSize) == FALSE || fileSize.QuadPart <= 0)
+        {
+            Close();
+            return false;
+        }
+
+        mMapping = ::CreateFileMappingW(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mMapping == nullptr)
+        {
+            Close();
+            return false;
+        }
+
+        const void* const view = ::MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr)
+        {
+            Close();
+            return false;
+        }
+
+        mData = static_cast<const std::byte*>(view);
+        mSize = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+        std::string narrowPath{};
+        try
+        {
+            narrowPath = std::filesystem::path{path}.string();
+        }
+        catch (...)
+        {
+            return false;
+        }
+
+        const int fileDescriptor = ::open(narrowPath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor < 0)
+            return false;
+
+        // 크기가 0인 파일은 매핑할 수 없음
+        struct stat fileStatus{};
+        if (::fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size <= 0)
+        {
+            ::close(fileDescriptor);
+            return false;
+        }
+
+        const auto size = static_cast<std::size_t>(fileStatus.st_size);
+        void* const view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+        // 매핑은 파일 디스크립터를 닫아도 유지됨
+        ::close(fileDescriptor);
+        if (view == MAP_FAILED)
+            return false;
+
+        mData = static_cast<const std::byte*>(view);
+        mSize = size;
+#endif
+
+        return true;
+    }
+
+    void MappedFile::Close() noexcept
+    {
+#ifdef _WIN32
+        if (mData != nullptr)
+            std::ignore = ::UnmapViewOfFile(mData);
+        if (mMapping != nullptr)
+            std::ignore = ::CloseHandle(mMapping);
+        if (mFile != INVALID_HANDLE_VALUE)
+            std::ignore = ::CloseHandle(mFile);
+
+        mMapping = nullptr;
+        mFile = INVALID_HANDLE_VALUE;
+#else
+        if (mData != nullptr)
+            ::munmap(const_cast<std::byte*>(mData), mSize);
+#endif
+
+        mData = nullptr;
+        mSize = 0U;
+    }
+
+    bool TargetDatabase::Open(_In_ const std::wstring& path, _In_ const SourceStamp& source) noexcept
+    {
+        Detach();
+        mBuffer.clear();
+
+        if (mMappedFile.Open(path) == false)
+            return false;
+
+        if (Attach(mMappedFile.GetData(), mMappedFile.GetSize(), source) == false)
+        {
+            mMappedFile.Close();
+            return false;
+        }
+
+        // 설정 파일이 그대로여도 재부팅이나 인터페이스를 다시 만든 뒤에는 인터페이스 번호가 바뀔 수 있음
+        if (AreScopeIdsCurrent() == false)
+        {
+            std::ignore = ::fwprintf(stderr, CONFIG_DATABASE_FILE_NAME L" 파일의 IPv6 인터페이스가 없어졌거나 번호가 바뀌어 다시 생성합니다.\n");
+            Detach();
+            mMappedFile.Close();
+            return false;
+        }
+
+        return true;
+    }
+
+    WolErrorCode TargetDatabase::Build(_In_ const std::vector<WolTarget>& targets,
+                                       _In_ const SourceStamp& source) noexcept
+    {
+        Detach();
+        mMappedFile.Close();
+
+        try
+        {
+            // 이름과 범위는 UTF-8로 저장하여 파일 크기(체크섬 계산량)를 줄임
+            // 대상마다 이름 뒤에 IPv6 범위 문자열을 이어 붙임 (nameOffsets[i] ~ scopeOffsets[i] ~ nameOffsets[i + 1])
+            std::string names{};
+            std::vector<std::size_t> nameOffsets{};
+            std::vector<std::size_t> scopeOffsets{};
+            nameOffsets.reserve(targets.size() + 1U);
+            scopeOffsets.reserve(targets.size());
+            for (const WolTarget& target : targets)
+            {
+                nameOffsets.push_back(names.size());
+                names += WideToUtf8(target.mName);
+                scopeOffsets.push_back(names.size());
+
+                Ipv6Address group{};
+                std::wstring_view scope{};
+                if (target.mMulticast.IsSet() && ParseIpv6Multicast(target.mBroadcastIp, group, scope))
+                    names += WideToUtf8(scope);
+            }
+            nameOffsets.push_back(names.size());
+
+            const std::size_t nameLength = names.size();
+
+            if (targets.size() > UINT32_MAX || nameLength > UINT32_MAX)
+            {
+                std::ignore = ::fwprintf(stderr, L"대상 수가 너무 많아 데이터베이스를 생성할 수 없습니다.\n");
+                return WolErrorCode::UnexpectedException;
+            }
+
+            Header header{};
+            header.mMagic = MAGIC;
+            header.mVersion = FORMAT_VERSION;
+            header.mByteOrderMark = BYTE_ORDER_MARK;
+            header.mSource = source;
+            header.mRecordCount = static_cast<std::uint32_t>(targets.size());
+            header.mNameLength = static_cast<std::uint32_t>(nameLength);
+
+            const std::size_t recordsOffset = sizeof(Header);
+            const std::size_t namesOffset = recordsOffset + (targets.size() * sizeof(Record));
+            mBuffer.assign(namesOffset + nameLength, std::byte{0});
+
+            for (std::size_t i = 0U; i < targets.size(); ++i)
+            {
+                const WolTarget& target = targets[i];
+
+                Record record{};
+                record.mMacBytes = target.mMacBytes;
+                record.mPort = target.mPort;
+                record.mBroadcastAddress = target.mBroadcastAddr.s_addr;
+                record.mNameOffset = static_cast<std::uint32_t>(nameOffsets[i]);
+                record.mNameLength = static_cast<std::uint32_t>(scopeOffsets[i] - nameOffsets[i]);
+                record.mHostAddress = target.mHostAddr.s_addr;
+                record.mProbePort = target.mProbePort;
+                record.mRack = target.mRack;
+                record.mMulticast = target.mMulticast;
+                record.mScopeOffset = static_cast<std::uint32_t>(scopeOffsets[i]);
+                record.mScopeLength = static_cast<std::uint32_t>(nameOffsets[i + 1U] - scopeOffsets[i]);
+                std::memcpy(mBuffer.data() + recordsOffset + (i * sizeof(Record)), &record, sizeof(record));
+            }
+
+            std::memcpy(mBuffer.data() + namesOffset, names.data(), nameLength);
+
+            header.mChecksum = ComputeChecksum(mBuffer.data() + recordsOffset, mBuffer.size() - recordsOffset);
+            std::memcpy(mBuffer.data(), &header, sizeof(header));
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"대상 데이터베이스를 생성하는 중 오류가 발생했습니다.\n");
+            mBuffer.clear();
+            return WolErrorCode::UnexpectedException;
+        }
+
+        const bool attached = Attach(mBuffer.data(), mBuffer.size(), source);
+        assert(attached);
+        return attached ? WolErrorCode::Success : WolErrorCode::UnexpectedException;
+    }
+
+    bool TargetDatabase::Save(_In_ const std::wstring& path) const noexcept
+    {
+        if (mBuffer.empty())
+            return false;
+
+        try
+        {
+            const std::filesystem::path targetPath{path};
+            // 여러 프로세스가 동시에 생성하더라도 임시 파일이 겹치지 않도록 프로세스 ID를 붙임
+#ifdef _WIN32
+            const unsigned long processId = ::GetCurrentProcessId();
+#else
+            const auto processId = static_cast<unsigned long>(::getpid());
+#endif
+            std::filesystem::path temporaryPath{targetPath};
+            temporaryPath += L"." + std::to_wstring(processId) + L".tmp";
+
+            {
+                std::ofstream file{temporaryPath, std::ios::binary | std::ios::trunc};
+                file.write(reinterpret_cast<const char*>(mBuffer.data()), static_cast<std::streamsize>(mBuffer.size()));
+                if (file.good() == false)
+                    return false;
+            }
+
+            // 같은 폴더 안의 이름 변경이므로 기존 파일이 원자적으로 교체됨
+            std::error_code errorCode{};
+            std::filesystem::rename(temporaryPath, targetPath, errorCode);
+            if (errorCode)
+            {
+                std::filesystem::remove(temporaryPath, errorCode);
+                return false;
+            }
+
+            return true;
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+    bool TargetDatabase::GetSourceStamp(_In_ const std::wstring& path, _Out_ SourceStamp& source) noexcept
+    {
+        source = {};
+
+        try
+        {
+            const std::filesystem::path sourcePath{path};
+
+            std::error_code errorCode{};
+            const auto modifiedTime = std::filesystem::last_write_time(sourcePath, errorCode);
+            if (errorCode)
+                return false;
+
+            const auto size = std::filesystem::file_size(sourcePath, errorCode);
+            if (errorCode)
+                return false;
+
+            source.mModifiedTime = static_cast<std::uint64_t>(modifiedTime.time_since_epoch().count());
+            source.mSize = static_cast<std::uint64_t>(size);
+            return true;
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+    std::uint64_t TargetDatabase::ComputeChecksum(_In_reads_(size) const std::byte* const data,
+                                                  _In_ const std::size_t size) noexcept
+    {
+        constexpr std::uint64_t offsetBasis = 0xCBF29CE484222325ULL;
+        constexpr std::uint64_t prime = 0x100000001B3ULL;
+        constexpr std::size_t laneCount = 4U;
+        constexpr std::size_t blockSize = laneCount * sizeof(std::uint64_t);
+
+        std::array<std::uint64_t, laneCount> lanes{offsetBasis, offsetBasis + 1U, offsetBasis + 2U, offsetBasis + 3U};
+        std::size_t i = 0U;
+        for (; i + blockSize <= size; i += blockSize)
+        {
+            for (std::size_t lane = 0U; lane < laneCount; ++lane)
+            {
+                std::uint64_t word = 0U;
+                std::memcpy(&word, data + i + (lane * sizeof(word)), sizeof(word));
+                lanes[lane] = (lanes[lane] ^ word) * prime;
+                lanes[lane] ^= lanes[lane] >> 32U;
+            }
+        }
+
+        // 누적값을 합친 뒤 남은 바이트를 처리
+        std::uint64_t hash = offsetBasis;
+        for (const std::uint64_t lane : lanes)
+        {
+            hash = (hash ^ lane) * prime;
+        }
+
+        for (; i < size; ++i)
+        {
+            hash = (hash ^ std::to_integer<std::uint64_t>(data[i])) * prime;
+        }
+
+        return hash;
+    }
+
+    bool TargetDatabase::Attach(_In_reads_(size) const std::byte* const data, _In_ const std::size_t size,
+                                _In_ const SourceStamp& source) noexcept
+    {
+        Detach();
+
+        if (size < sizeof(Header))
+            return false;
+
+        const auto* const header = reinterpret_cast<const Header*>(data);
+        if (header->mMagic != MAGIC || header->mVersion != FORMAT_VERSION || header->mByteOrderMark != BYTE_ORDER_MARK)
+        {
+            return false;
+        }
+
+        // 설정 파일이 바뀌었으면 다시 생성해야 함
+        if (header->mSource.mModifiedTime != source.mModifiedTime || header->mSource.mSize != source.mSize)
+            return false;
+
+        const std::uint64_t expectedSize = sizeof(Header) + (std::uint64_t{header->mRecordCount} * sizeof(Record))
+            + std::uint64_t{header->mNameLength};
+        if (expectedSize != size)
+        {
+            std::ignore = ::fwprintf(stderr, CONFIG_DATABASE_FILE_NAME L" 파일의 크기가 올바르지 않아 다시 생성합니다.\n");
+            return false;
+        }
+
+        if (ComputeChecksum(data + sizeof(Header), size - sizeof(Header)) != header->mChecksum)
+        {
+            std::ignore = ::fwprintf(stderr, CONFIG_DATABASE_FILE_NAME L" 파일이 손상되어 다시 생성합니다.\n");
+            return false;
+        }
+
+        const auto* const records = reinterpret_cast<const Record*>(data + sizeof(Header));
+        for (std::size_t i = 0U; i < header->mRecordCount; ++i)
+        {
+            const Record& record = records[i];
+            if (record.mPort == 0U || std::uint64_t{record.mNameOffset} + record.mNameLength > header->mNameLength
+                || std::uint64_t{record.mScopeOffset} + record.mScopeLength > header->mNameLength)
+            {
+                std::ignore = ::fwprintf(stderr, CONFIG_DATABASE_FILE_NAME L" 파일이 손상되어 다시 생성합니다.\n");
+                return false;
+            }
+        }
+
+        mHeader = header;
+        mRecords = records;
+        mNames = reinterpret_cast<const char*>(data + sizeof(Header) + (header->mRecordCount * sizeof(Record)));
+        return true;
+    }
+
+    bool TargetDatabase::AreScopeIdsCurrent() const noexcept
+    {
+        // 대상 대부분이 같은 인터페이스를 사용하므로 직전에 변환한 범위는 다시 변환하지 않음
+        std::string_view lastScope{};
+        std::uint32_t lastScopeId = 0U;
+        bool hasLastScope = false;
+
+        for (std::size_t i = 0U; i < GetCount(); ++i)
+        {
+            const Record& record = mRecords[i];
+            if (record.mMulticast.IsSet() == false)
+                continue;
+
+            const std::string_view scope = GetScope(record);
+            if (hasLastScope == false || scope != lastScope)
+            {
+                try
+                {
+                    if (ResolveScopeId(Utf8ToWide(scope), lastScopeId) == false)
+                        return false;
+                }
+                catch (...)
+                {
+                    return false;
+                }
+
+                lastScope = scope;
+                hasLastScope = true;
+            }
+
+            if (lastScopeId != record.mMulticast.mScopeId)
+                return false;
+        }
+
+        return true;
+    }
+
+    void TargetDatabase::Detach() noexcept
+    {
+        mHeader = nullptr;
+        mRecords = nullptr;
+        mNames = nullptr;
+    }
+
+    const std::vector<WolTarget>& WolConfig::GetTargets() const noexcept
+    {
+        static const std::vector<WolTarget> emptyTargets{};
+
+        const std::shared_ptr<const TargetSnapshot> snapshot = GetSnapshot();
+        return snapshot != nullptr ? snapshot->mTargets : emptyTargets;
+    }
+
+    WolErrorCode WolConfig::LoadDatabase(_Out_ TargetDatabase& database) noexcept
+    {
+        std::atomic_store(&mSnapshot, std::shared_ptr<const TargetSnapshot>{});
+
+        std::wstring configFileAbsolutePath{}; // 설정 파일 절대 경로
+        WolErrorCode errorCode = GetConfigFilePath(configFileAbsolutePath);
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        TargetDatabase::SourceStamp source{};
+        std::wstring databasePath{};
+        try
+        {
+            databasePath = std::filesystem::path{configFileAbsolutePath}.replace_filename(CONFIG_DATABASE_FILE_NAME).wstring();
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, CONFIG_DATABASE_FILE_NAME L" 파일 경로를 만드는 중 오류가 발생했습니다.\n");
+            return WolErrorCode::UnexpectedException;
+        }
+
+        // 설정 파일이 바뀌지 않았다면 컴파일된 데이터베이스를 그대로 사용
+        if (TargetDatabase::GetSourceStamp(configFileAbsolutePath, source) && database.Open(databasePath, source))
+        {
+            return WolErrorCode::Success;
+        }
+
+        errorCode = LoadFromIni();
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        errorCode = database.Build(GetTargets(), source);
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        if (database.Save(databasePath) == false)
+        {
+            // 다음 실행에서 다시 생성하면 되므로 계속 진행
+            std::ignore = ::fwprintf(stderr, CONFIG_DATABASE_FILE_NAME L" 파일을 저장하지 못했습니다: %ls\n", databasePath.c_str());
+        }
+
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode WolConfig::GetConfigFilePath(_Out_ std::wstring& configFilePath) const noexcept
+    {
+        configFilePath.clear();
+
+        try
+        {
+            // 지정된 설정 파일 경로가 있다면 절대 경로로 변환하여 사용
+            if (mConfigFilePath.empty() == false)
+            {
+                configFilePath = std::filesystem::absolute(mConfigFilePath).wstring();
+                return WolErrorCode::Success;
+            }
+
+#ifdef _WIN32
+            // 실행 파일 경로 저장을 위한 버퍼 (null 문자로 초기화)
+            std::array<wchar_t, MAX_PATH_LENGTH> buffer{};
+
+            // API 호출 실패 또는 경로가 버퍼 크기를 초과하여 잘린 경우
+            if (const DWORD length = ::GetModuleFileNameW(nullptr, buffer.data(), static_cast<DWORD>(buffer.size()));
+                // 현재 모듈(실행 파일)의 전체 경로를 가져옴
+                length == 0 || length >= MAX_PATH_LENGTH)
+            {
+                std::ignore = ::fwprintf(stderr, L"실행 파일 경로를 얻을 수 없습니다.\n");
+                return WolErrorCode::FailedToGetExecutionPath;
+            }
+
+            // 실행 파일 절대 경로를 담은 buffer를 std::filesystem::path로 변환
+            const std::filesystem::path exePath{buffer.data()};
+#else
+            // /proc/self/exe 심볼릭 링크가 현재 실행 파일의 절대 경로를 가리킴
+            std::error_code errorCode{};
+            const std::filesystem::path exePath = std::filesystem::read_symlink("/proc/self/exe", errorCode);
+            if (errorCode)
+            {
+                std::ignore = ::fwprintf(stderr, L"실행 파일 경로를 얻을 수 없습니다.\n");
+                return WolErrorCode::FailedToGetExecutionPath;
+            }
+#endif
+
+            // 실행 파일이 있는 폴더 경로
+            const std::filesystem::path exeDir = exePath.parent_path();
+
+            // 디렉토리 정보가 비어있다면 파일명만 반환
+            if (exeDir.empty())
+            {
+                // 일반적으로 발생하지 않지만, 디렉토리 경로가 비어있는 경우를 대비
+                std::ignore = ::fwprintf(stderr, L"실행 파일 경로가 유효하지 않습니다: %ls\n", exePath.wstring().c_str());
+                return WolErrorCode::InvalidExecutionPath;
+            }
+            // 디렉토리 경로와 설정 파일명 결합
+            configFilePath = (exeDir / CONFIG_FILE_NAME).wstring();
+            return WolErrorCode::Success;
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 설정 파일을 찾는 중 알 수 없는 오류가 발생했습니다.\n");
+            return WolErrorCode::UnexpectedException;
+        }
+    }
+
+    WolErrorCode WolConfig::LoadFromIni() noexcept
+    {
+        // 이전에 로드된 대상 목록 초기화
+        std::atomic_store(&mSnapshot, std::shared_ptr<const TargetSnapshot>{});
+
+        std::shared_ptr<const TargetSnapshot> snapshot{};
+        ConfigReloadResult result{};
+        const WolErrorCode errorCode = BuildSnapshot(nullptr, snapshot, result);
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        std::atomic_store(&mSnapshot, std::move(snapshot));
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode WolConfig::Reload(_Out_ ConfigReloadResult& result) noexcept
+    {
+        // Reload()는 한 스레드에서만 호출하므로 새 스냅샷을 만드는 동안 현재 스냅샷이 바뀌지 않음
+        const std::shared_ptr<const TargetSnapshot> previous = GetSnapshot();
+
+        std::shared_ptr<const TargetSnapshot> snapshot{};
+        const WolErrorCode errorCode = BuildSnapshot(previous.get(), snapshot, result);
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        std::atomic_store(&mSnapshot, std::move(snapshot));
+        return WolErrorCode::Success;
+    }
+
+    bool WolConfig::IsModified() const noexcept
+    {
+        const std::shared_ptr<const TargetSnapshot> snapshot = GetSnapshot();
+        if (snapshot == nullptr)
+        {
+            return true;
+        }
+
+        std::wstring configFileAbsolutePath{};
+        if (GetConfigFilePath(configFileAbsolutePath) != WolErrorCode::Success)
+        {
+            return false;
+        }
+
+        TargetDatabase::SourceStamp source{};
+        if (TargetDatabase::GetSourceStamp(configFileAbsolutePath, source) == false)
+        {
+            // 설정 파일이 삭제되었거나 교체 중인 경우 다음 확인까지 기다림
+            return false;
+        }
+
+        return source.mModifiedTime != snapshot->mSource.mModifiedTime || source.mSize != snapshot->mSource.mSize;
+    }
+
+    WolErrorCode WolConfig::BuildSnapshot(_In_opt_ const TargetSnapshot* const previous,
+                                          _Out_ std::shared_ptr<const TargetSnapshot>& snapshot,
+                                          _Out_ ConfigReloadResult& result) const noexcept
+    {
+        snapshot.reset();
+        result = {};
+
+        std::wstring configFileAbsolutePath{}; // 설정 파일 절대 경로
+        WolErrorCode errorCode = GetConfigFilePath(configFileAbsolutePath); // 설정 파일 경로를 얻어온다.
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        // 설정파일이 존재하는지 확인
+        if (std::filesystem::exists(configFileAbsolutePath) == false)
+        {
+            // iniPath.data()는 std::wstring_view 기반으로 null-terminated 보장이 없음 > %ls 포맷에 전달하면 미정의 동작 발생 가능
+            // std::wstring_view에서 std::wstring으로 명시적 변환 후 출력
+            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일을 찾을 수 없습니다: %ls\n", configFileAbsolutePath.c_str());
+            return WolErrorCode::ConfigFileNotFound;
+        }
+
+        try
+        {
+            auto newSnapshot = std::make_shared<TargetSnapshot>();
+
+            // 파일을 읽기 전에 수정 시각/크기를 기록 (읽는 도중 수정되면 다음 IsModified()에서 다시 감지)
+            std::ignore = TargetDatabase::GetSourceStamp(configFileAbsolutePath, newSnapshot->mSource);
+
+            // 설정 파일을 한 번만 읽고 섹션 단위로 나눔 (다음 Reload()에서 비교할 수 있도록 원본 텍스트를 스냅샷에 보관)
+            std::string& content = newSnapshot->mContent;
+            errorCode = IniFile::ReadContent(configFileAbsolutePath, content);
+            if (errorCode != WolErrorCode::Success)
+            {
+                return errorCode;
+            }
+
+            std::vector<std::string_view> chunks{};
+            IniFile::SplitSections(content, chunks);
+
+            newSnapshot->mTargets.reserve(chunks.size());
+            newSnapshot->mSections.reserve(chunks.size());
+
+            // 모든 섹션을 읽은 뒤에 스냅샷을 교체
+            // 하나라도 유효하지 않으면 새 스냅샷은 버려짐
+            IniFile iniFile{};
+            for (const std::string_view chunk : chunks)
+            {
+                const std::uint64_t hash = HashSectionText(chunk);
+                TargetSnapshot::SectionRange range{newSnapshot->mTargets.size(), 0U,
+                                                   static_cast<std::size_t>(chunk.data() - content.data()), chunk.size()};
+
+                // 이전 스냅샷에 원본 텍스트가 같은 조각이 있으면 해석과 검증을 생략하고 그대로 재사용
+                // 해시는 후보를 찾는 데만 사용하고, 해시 충돌로 다른 섹션을 재사용하지 않도록 텍스트를 비교
+                const TargetSnapshot::SectionRange* reusable = nullptr;
+                if (previous != nullptr)
+                {
+                    if (const auto found = previous->mSections.find(hash);
+                        found != previous->mSections.end() && found->second.mLength == chunk.size()
+                        && std::string_view{previous->mContent}.substr(found->second.mOffset, found->second.mLength) == chunk)
+                    {
+                        reusable = &found->second;
+                    }
+                }
+
+                bool reused = false;
+                if (reusable != nullptr)
+                {
+                    const auto first = previous->mTargets.begin() + static_cast<std::ptrdiff_t>(reusable->mFirst);
+                    newSnapshot->mTargets.insert(newSnapshot->mTargets.end(), first,
+                                                 first + static_cast<std::ptrdiff_t>(reusable->mCount));
+
+                    // 범위에 해당하는 인터페이스가 없어졌다면 재사용하지 않고 다시 해석하여 오류를 보고
+                    reused = RefreshScopeIds(newSnapshot->mTargets, range.mFirst);
+                    if (reused == false)
+                    {
+                        newSnapshot->mTargets.resize(range.mFirst);
+                    }
+                }
+
+                if (reused)
+                {
+                    range.mCount = reusable->mCount;
+                    result.mUnchanged += range.mCount;
+                }
+                else
+                {
+                    iniFile.Parse(chunk);
+                    for (const IniFile::Section& section : iniFile.GetSections())
+                    {
+                        if (IsTargetSection(section.mName) == false)
+                        {
+                            continue;
+                        }
+
+                        WolTarget target{};
+                        errorCode = LoadTarget(section, target);
+                        if (errorCode != WolErrorCode::Success)
+                        {
+                            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일의 [%ls] 섹션 설정이 유효하지 않습니다.\n",
+                                                     section.mName.c_str());
+                            result = {};
+                            return errorCode;
+                        }
+
+                        newSnapshot->mTargets.push_back(std::move(target));
+                        ++range.mCount;
+                    }
+
+                    result.mReloaded += range.mCount;
+                }
+
+                newSnapshot->mSections.try_emplace(hash, range);
+            }
+
+            if (newSnapshot->mTargets.empty())
+            {
+                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일에서 [Target] 또는 [Target.이름] 섹션을 찾을 수 없습니다.\n");
+                result = {};
+                return WolErrorCode::TargetNotFound;
+            }
+
+            result.mDropped = previous != nullptr ? previous->mTargets.size() - result.mUnchanged : 0U;
+            snapshot = std::move(newSnapshot);
+            return WolErrorCode::Success;
+        }
+        catch (const std::exception& e)
+        {
+            // 모든 예외 처리 (예: 문자열 조작 중 std::bad_alloc 등)
+            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 설정 파일 로드 중 오류가 발생했습니다: %hs\n", e.what());
+            result = {};
+            return WolErrorCode::UnexpectedException;
+        }
+        catch (...)
+        {
+            // noexcept 보장을 위해 모든 예외를 포착하고 실패로 처리
+            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 설정 파일 로드 중 알 수 없는 오류가 발생했습니다.\n");
+            result = {};
+            return WolErrorCode::UnexpectedException;
+        }
+    }
+
+    bool WolConfig::IsTargetSection(_In_ const std::wstring_view name) const noexcept
+    {
+        // "Target" 또는 "Target.XXX" 형식의 섹션만 대상으로 취급
+        // 섹션명 비교 시 GetPrivateProfileStringW와 동일하게 대소문자를 구분하지 않음
+        const std::wstring_view prefix = name.substr(0U, TARGET_SECTION_PREFIX.length());
+        if (EqualsIgnoreCase(prefix, TARGET_SECTION_PREFIX) == false)
+        {
+            return false;
+        }
+
+        return name.length() == TARGET_SECTION_PREFIX.length()
+            || (name.length() > TARGET_SECTION_PREFIX.length() + 1U && name[TARGET_SECTION_PREFIX.length()] == L'.');
+    }
+
+    bool WolConfig::RefreshScopeIds(_Inout_ std::vector<WolTarget>& targets, _In_ const std::size_t first) noexcept
+    {
+        for (std::size_t i = first; i < targets.size(); ++i)
+        {
+            WolTarget& target = targets[i];
+            if (target.mMulticast.IsSet() == false)
+            {
+                continue;
+            }
+
+            Ipv6Address group{};
+            std::wstring_view scope{};
+            if (ParseIpv6Multicast(target.mBroadcastIp, group, scope) == false
+                || ResolveScopeId(scope, target.mMulticast.mScopeId) == false)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::uint64_t WolConfig::HashSectionText(_In_ const std::string_view text) noexcept
+    {
+        constexpr std::uint64_t offsetBasis = 0xCBF29CE484222325ULL;
+        constexpr std::uint64_t prime = 0x100000001B3ULL;
+
+        std::uint64_t hash = offsetBasis;
+        for (const char ch : text)
+        {
+            hash = (hash ^ static_cast<std::uint8_t>(ch)) * prime;
+        }
+
+        return hash;
+    }
+
+    WolErrorCode WolConfig::LoadTarget(_In_ const IniFile::Section& section, _Out_ WolTarget& target) const
+    {
+        target = {};
+        target.mName = section.mName;
+
+        // MAC 주소 로드
+        // 대상 섹션의 MacAddress 키에서 값을 읽어옴
+        // 키가 없거나 값이 비어있을 경우 > 유효하지 않은 맥 주소로 처리
+        section.GetValue(L"MacAddress", L"", target.mMacAddress);
+        if (target.mMacAddress.empty())
+        {
+            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일에서 MacAddress 키 값을 읽는데 실패했습니다.\n");
+            return WolErrorCode::FailedToReadMacAddress;
+        }
+
+        // 대상 IP 주소 로드 (선택)
+        // 키가 없으면 확인할 때 IP 주소가 필요 없는 방법(ARP/이웃 테이블)만 사용할 수 있음
+        // CIDR 표기(예: 192.168.10.23/24)이면 BroadcastIp의 기본값을 해당 서브넷의 지정 브로드캐스트 주소로 사용
+        std::array<wchar_t, 16U> directedBroadcast{L"255.255.255.255"};
+        section.GetValue(L"HostIp", L"", target.mHostIp);
+        if (target.mHostIp.empty() == false)
+        {
+            std::uint32_t hostAddress = 0U;
+            std::uint32_t prefixLength = 0U;
+            if (ParseIpv4Cidr(target.mHostIp, hostAddress, prefixLength) == false || hostAddress == 0U || prefixLength > 30U)
+            {
+                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일의 HostIp 값이 유효하지 않습니다 (A.B.C.D 또는 A.B.C.D/1 ~ 30): %ls\n",
+                                         target.mHostIp.c_str());
+                return WolErrorCode::InvalidHostIp;
+            }
+
+            target.mHostAddr.s_addr = htonl(hostAddress);
+            if (prefixLength != 0U)
+            {
+                FormatIpv4Address(htonl(GetDirectedBroadcast(hostAddress, prefixLength)), directedBroadcast);
+            }
+        }
+
+        // 브로드캐스트 IP 주소 로드
+        // 대상 섹션의 BroadcastIP 키에서 값을 읽어옴 (기본값: HostIp의 지정 브로드캐스트 또는 전역 브로드캐스트)
+        // 키 값이 비어있는 경우 > 유효하지 않은 브로드캐스트 주소로 처리
+        section.GetValue(L"BroadcastIp", directedBroadcast.data(), target.mBroadcastIp);
+        if (target.mBroadcastIp.empty())
+        {
+            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일에서 BroadcastIp 키 값을 읽는데 실패했습니다.\n");
+            return WolErrorCode::FailedToReadBroadcastIp;
+        }
+
+        // 포트 번호 로드
+        // 대상 섹션의 Port 키에서 값을 읽어옴
+        // Port 키 값이 비어있는 경우 > 유효하지 않은 포트로 처리
+        std::wstring portString{};
+        section.GetValue(L"Port", L"", portString);
+        if (portString.empty())
+        {
+            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일에서 Port 키 값을 읽는데 실패했습니다.\n");
+            return WolErrorCode::FailedToReadPort;
+        }
+
+        errno = 0;
+        wchar_t* endPtr = nullptr;
+        const unsigned long port = std::wcstoul(portString.c_str(), &endPtr, 10);
+        if (errno == ERANGE)
+        {
+            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일에서 Port 값을 정수로 변환하는데 실패하였습니다: %ls\n",
+                                     portString.c_str());
+            return WolErrorCode::InvalidPort;
+        }
+
+        // endPtr == portString.c_str() > 변환된 숫자가 없음 (예: "abc")
+        // *endPtr != L'\0' > 숫자 뒤에 쓰레기 문자 있음 (예: "255abc")
+        if (endPtr == portString.c_str() || *endPtr != L'\0')
+        {
+            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일의 Port 값이 유효하지 않습니다: %ls\n", portString.c_str());
+            return WolErrorCode::InvalidPort;
+        }
+
+        if (port == 0 || port > UINT16_MAX)
+        {
+            std::ignore = ::fwprintf(
+                stderr, CONFIG_FILE_NAME L" 설정 파일의 Port 키 값이 유효하지 않습니다.\n\t유효한 포트의 범위: 1 ~ 65535\n\t입력된 포트: %lu\n",
+                port);
+            return WolErrorCode::InvalidPort;
+        }
+
+        // 유효한 포트 값을 저장
+        target.mPort = static_cast<std::uint16_t>(port);
+
+        // 로드된 모든 설정값들의 최종 유효성 검사
+        const WolErrorCode result = IsConfigurationValid(target);
+        if (result != WolErrorCode::Success)
+        {
+            return result;
+        }
+
+        // 검증된 문자열을 전송에 사용할 바이너리 값으로 변환 (전송 시에는 문자열을 다시 해석하지 않음)
+        if (ParseMacAddress(target.mMacAddress, target.mMacBytes).IsSuccess() == false)
+        {
+            return WolErrorCode::InvalidMacAddress;
+        }
+
+        std::wstring_view scope{};
+        if (ParseIpv6Multicast(target.mBroadcastIp, target.mMulticast.mGroup, scope))
+        {
+            // 범위(인터페이스 이름 또는 번호)는 이 컴퓨터에서만 의미가 있으므로 읽을 때 번호로 변환
+            if (ResolveScopeId(scope, target.mMulticast.mScopeId) == false)
+            {
+                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일의 BroadcastIp 범위에 해당하는 네트워크 인터페이스가 없습니다: %ls\n",
+                                         target.mBroadcastIp.c_str());
+                return WolErrorCode::InvalidBroadcastIp;
+            }
+        }
+        else
+        {
+            std::uint32_t broadcastAddress = 0U;
+            if (ParseIpv4Address(target.mBroadcastIp, broadcastAddress) == false)
+            {
+                return WolErrorCode::InvalidBroadcastIp;
+            }
+
+            target.mBroadcastAddr.s_addr = htonl(broadcastAddress);
+        }
+
+        // 확인용 TCP 포트 로드 (선택)
+        std::wstring probePortString{};
+        section.GetValue(L"ProbePort", L"", probePortString);
+        if (probePortString.empty() == false)
+        {
+            errno = 0;
+            const unsigned long probePort = std::wcstoul(probePortString.c_str(), &endPtr, 10);
+            if (errno == ERANGE || endPtr == probePortString.c_str() || *endPtr != L'\0' || probePort == 0
+                || probePort > UINT16_MAX)
+            {
+                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일의 ProbePort 값이 유효하지 않습니다 (1 ~ 65535): %ls\n",
+                                         probePortString.c_str());
+                return WolErrorCode::InvalidPort;
+            }
+
+            target.mProbePort = static_cast<std::uint16_t>(probePort);
+        }
+
+        // 랙 번호 로드 (선택)
+        std::wstring rackString{};
+        section.GetValue(L"Rack", L"", rackString);
+        if (rackString.empty() == false)
+        {
+            errno = 0;
+            const unsigned long rack = std::wcstoul(rackString.c_str(), &endPtr, 10);
+            if (errno == ERANGE || endPtr == rackString.c_str() || *endPtr != L'\0' || rack == 0 || rack > UINT16_MAX)
+            {
+                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일의 Rack 값이 유효하지 않습니다 (1 ~ 65535): %ls\n",
+                                         rackString.c_str());
+                return WolErrorCode::InvalidRack;
+            }
+
+            target.mRack = static_cast<std::uint16_t>(rack);
+        }
+
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode WolConfig::IsConfigurationValid(_In_ const WolTarget& target) const noexcept
+    {
+        // MAC 주소 형식 유효성 검사
+        WolErrorCode result = IsValidMacAddress(target.mMacAddress);
+        if (result != WolErrorCode::Success)
+        {
+            return result;
+        }
+
+        // 브로드캐스트 IP 주소 형식 유효성 검사
+        result = IsValidBroadcastIpAddress(target.mBroadcastIp);
+        if (result != WolErrorCode::Success)
+        {
+            return result;
+        }
+
+        // 포트는 INI 파일을 읽는 위치에서 검증
+
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode WolConfig::IsValidMacAddress(_In_ const std::wstring_view macAddress) const noexcept
+    {
+        MacAddress macBytes{};
+        const MacAddressParseResult result = ParseMacAddress(macAddress, macBytes);
+        switch (result.mError)
+        {
+        case MacAddressParseError::None:
+            return WolErrorCode::Success;
+
+        case MacAddressParseError::Empty:
+        case MacAddressParseError::InvalidLength:
+            std::ignore = ::fwprintf(stderr,
+                                     CONFIG_FILE_NAME L" 설정 파일의 MacAddress 키 값의 길이가 유효하지 않습니다.\n\t유효한 길이: %zu, %zu, %zu\n\t입력된 길이: %zu\n",
+                                     MAC_ADDRESS_SEPARATED_LENGTH, MAC_ADDRESS_DOTTED_LENGTH, MAC_ADDRESS_HEX_DIGIT_COUNT,
+                                     macAddress.length());
+            break;
+
+        case MacAddressParseError::InvalidSeparator:
+            std::ignore = ::fwprintf(stderr,
+                                     CONFIG_FILE_NAME L" 설정 파일의 MacAddress 키 값의 구분자가 유효하지 않습니다.\n\t유효한 형식: XX-XX-XX-XX-XX-XX, XX:XX:XX:XX:XX:XX, XXXX.XXXX.XXXX, XXXXXXXXXXXX\n\t입력된 구분자: '%lc' (%zu번째 문자)\n",
+                                     static_cast<wint_t>(macAddress[result.mPosition]), result.mPosition + 1U);
+            break;
+
+        case MacAddressParseError::InvalidHexDigit:
+            std::ignore = ::fwprintf(stderr,
+                                     CONFIG_FILE_NAME L" 설정 파일의 MacAddress 키 값에 유효하지 않은 문자가 포함되어 있습니다: '%lc' (%zu번째 문자)\n",
+                                     static_cast<wint_t>(macAddress[result.mPosition]), result.mPosition + 1U);
+            break;
+        }
+
+        return WolErrorCode::InvalidMacAddress;
+    }
+
+    WolErrorCode WolConfig::IsValidBroadcastIpAddress(_In_ const std::wstring_view broadcastIpAddress) const noexcept
+    {
+        if (broadcastIpAddress.find(L':') != std::wstring_view::npos)
+        {
+            Ipv6Address group{};
+            std::wstring_view scope{};
+            if (ParseIpv6Multicast(broadcastIpAddress, group, scope) == false)
+            {
+                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 설정 파일의 BroadcastIp가 IPv6 멀티캐스트 주소(ff00::/8)가 아닙니다: %.*ls\n",
+                                         static_cast<int>(broadcastIpAddress.length()), broadcastIpAddress.data());
+                return WolErrorCode::InvalidBroadcastIp;
+            }
+
+            return WolErrorCode::Success;
+        }
+
+        std::size_t start = 0U;
+        std::size_t dotCount = 0U;
+
+        // 점(.)으로 구분된 각 옥텟 검사
+        for (std::size_t i = 0U; i <= broadcastIpAddress.length(); ++i)
+        {
+            // 점을 만나거나 문자열 끝에 도달한 경우
+            if (i == broadcastIpAddress.length() || broadcastIpAddress[i] == L'.')
+            {
+                try
+                {
+                    const std::wstring_view octet = broadcastIpAddress.substr(start, i - start);
+                    const WolErrorCode result = IsValidateIpOctet(octet);
+                    if (result != WolErrorCode::Success)
+                    {
+                        return result;
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟 파싱 중 오류가 발생했습니다: %hs\n",
+                                             e.what());
+                    return WolErrorCode::UnexpectedException;
+                }
+                catch (...)
+                {
+                    std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟 파싱 중 알 수 없는 오류가 발생했습니다.\n");
+                    return WolErrorCode::UnexpectedException;
+                }
+
+                start = i + 1U;
+
+                // 점인 경우 카운트 증가
+                if (i < broadcastIpAddress.length())
+                {
+                    ++dotCount;
+                }
+
+                if (dotCount > 3)
+                {
+                    std::ignore = ::fwprintf(
+                        stderr, CONFIG_FILE_NAME L" 설정 파일의 BroadcastIp 구분자(.) 개수가 잘못되었습니다.(필요 갯수보다 많음)\n");
+                    return WolErrorCode::InvalidBroadcastIp;
+                }
+            }
+        }
+
+        // 정확히 3개의 점이 있어야 함 (4개 옥텟)
+        if (dotCount != 3U)
+        {
+            std::ignore = ::fwprintf(
+                stderr, CONFIG_FILE_NAME L" 설정 파일의 BroadcastIp 구분자(.) 개수가 잘못되었습니다.(필요: 3, 실제: %zu)\n", dotCount);
+            return WolErrorCode::InvalidBroadcastIp;
+        }
+
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode WolConfig::IsValidateIpOctet(_In_ const std::wstring_view octet) const noexcept
+    {
+        // 옥텟 길이 검사 (0 또는 너무 김)
+        if (octet.empty() || octet.length() > 3)
+        {
+            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟 길이가 유효하지 않습니다.\n");
+            return WolErrorCode::InvalidBroadcastIp;
+        }
+
+        // 숫자 확인
+        for (const wchar_t ch : octet)
+        {
+            if (iswdigit(ch) == false)
+            {
+                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟에 유효하지 않은 문자가 포함되어 있습니다: %c\n", ch);
+                return WolErrorCode::InvalidBroadcastIp;
+            }
+        }
+
+        // 선행 0 금지 (두 자리 이상인데 0으로 시작)
+        if (octet.length() > 1 && octet[0] == L'0')
+        {
+            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟에 선행 0이 있습니다. 지원하지 않습니다.\n");
+            return WolErrorCode::InvalidBroadcastIp;
+        }
+
+        // 숫자 범위 확인
+        try
+        {
+            errno = 0;
+            wchar_t* endPtr = nullptr;
+            const long value = ::wcstol(std::wstring{octet}.c_str(), &endPtr, 10);
+
+            if (errno == EINVAL || errno == ERANGE)
+            {
+                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟 값을 정수로 변환하는데 실패하였습니다: %ld\n",
+                                         value);
+                return WolErrorCode::InvalidBroadcastIp;
+            }
+
+            // endPtr == octet.c_str() > 변환된 숫자가 없음 (예: "abc")
+            // *endPtr != L'\0' > 숫자 뒤에 쓰레기 문자 있음 (예: "255abc")
+            if (endPtr == octet.data() || *endPtr != L'\0')
+            {
+                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟 값이 유효하지 않습니다: %.*ls\n",
+                                         static_cast<int>(octet.length()), octet.data());
+                return WolErrorCode::InvalidBroadcastIp;
+            }
+
+            if (value < 0L || value > 255L)
+            {
+                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟 값이 유효 범위를 벗어났습니다. (0~255): %ld\n",
+                                         value);
+                return WolErrorCode::InvalidBroadcastIp;
+            }
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟 숫자 변환 중 오류가 발생하였습니다.\n");
+            return WolErrorCode::UnexpectedException;
+        }
+
+        return WolErrorCode::Success;
+    }
+
+    Socket::Socket(const SOCKET& socket) noexcept
+        : mSocket(socket)
+    {
+    }
+
+    Socket::~Socket() noexcept
+    {
+        // WinSock SOCKET은 자동 관리되지 않는 리소스이므로 명시적으로 closesocket() 필요
+        // Rule of Zero는 이 경우 적용되지 않음
+        Close();
+    }
+
+    void Socket::Set(const SOCKET& socket) noexcept
+    {
+        assert(socket != INVALID_SOCKET); // 유효하지 않은 핸들은 허용하지 않음
+
+        Close(); // 이전 핸들이 열려 있다면 닫음
+        mSocket = socket; // 새 핸들로 교체
+    }
+
+    SOCKET Socket::Release() noexcept
+    {
+        const SOCKET socket = mSocket;
+        mSocket = INVALID_SOCKET; // 소유권 이전
+        return socket;
+    }
+
+    void Socket::Close() noexcept
+    {
+        if (mSocket == INVALID_SOCKET)
+            return;
+
+        closesocket(mSocket); // 소켓 닫기
+        mSocket = INVALID_SOCKET; // 상태 초기화
+    }
+
+    // 정적 참조 카운트 초기값
+    unsigned long long WsaGuard::mRefCount = 0;
+
+    std::mutex WsaGuard::mRefCountMutex{};
+
+    WsaGuard::~WsaGuard() noexcept
+    {
+        if (mInitialized == false)
+            return;
+
+        const std::lock_guard<std::mutex> lock{mRefCountMutex};
+        --mRefCount;
+#ifdef _WIN32
+        if (mRefCount == 0)
+        {
+            // 모든 인스턴스가 종료되었으므로 WinSock 환경 종료
+            std::ignore = WSACleanup(); // WSACleanup() 실패 시 복구 수단이 없으므로 무시
+        }
+#endif
+    }
+
+    WolErrorCode WsaGuard::Initialize()
+    {
+        if (mInitialized)
+            return WolErrorCode::Success;
+
+        const std::lock_guard<std::mutex> lock{mRefCountMutex};
+
+#ifdef _WIN32
+        // WinSock 초기화
+        if (WSAStartup(MAKEWORD(2, 2), &mWsaData) != 0)
+        {
+            std::ignore = ::fwprintf(stderr, L"WinSock 초기화에 실패했습니다.\n");
+            return WolErrorCode::WinsockInitializationFailed;
+        }
+#endif
+
+        // 성공 시 참조 카운트 증가
+        mRefCount++;
+        mInitialized = true;
+
+        return WolErrorCode::Success;
+    }
+
+    void CreateMagicPacket(_In_ const MacAddress& macBytes, _Out_ MagicPacket& packet) noexcept
+    {
+        // 헤더 + MAC 주소 16회 (반복 횟수가 상수이므로 컴파일러가 펼쳐서 6바이트 저장 16번으로 변환)
+        std::memcpy(packet.data(), MAGIC_PACKET_HEADER.data(), MAGIC_PACKET_HEADER.size());
+        for (std::size_t repeat = 0U; repeat < MAGIC_PACKET_MAC_REPEAT_COUNT; ++repeat)
+        {
+            std::memcpy(packet.data() + MAGIC_PACKET_HEADER.size() + (repeat * macBytes.size()), macBytes.data(),
+                        macBytes.size());
+        }
+    }
+
+    void CreateMagicPackets(_In_reads_(count) const MacAddress* const macAddresses, _In_ const std::size_t count,
+                            _Out_writes_(count) MagicPacket* const packets) noexcept
+    {
+        for (std::size_t i = 0U; i < count; ++i)
+        {
+            CreateMagicPacket(macAddresses[i], packets[i]);
+        }
+    }
+
+    void MagicPacketCache::GetPacket(_In_ const MacAddress& macAddress, _Out_ MagicPacket& packet) noexcept
+    {
+        const std::uint64_t key = ToKey(macAddress);
+
+        const auto found = mIndex.find(key);
+        if (found != mIndex.end())
+        {
+            // 최근에 사용한 항목으로 이동 (splice는 반복자를 무효화하지 않음)
+            mEntries.splice(mEntries.begin(), mEntries, found->second);
+            packet = found->second->mPacket;
+            ++mHitCount;
+            return;
+        }
+
+        ++mMissCount;
+        CreateMagicPacket(macAddress, packet);
+
+        if (mCapacity == 0U)
+            return;
+
+        try
+        {
+            EvictTo(mCapacity - 1U);
+            mEntries.push_front(Entry{key, packet});
+            try
+            {
+                mIndex.emplace(key, mEntries.begin());
+            }
+            catch (...)
+            {
+                mEntries.pop_front();
+                throw;
+            }
+        }
+        catch (...)
+        {
+            // 보관에 실패해도 생성한 패킷은 사용할 수 있으므로 무시
+        }
+    }
+
+    void MagicPacketCache::SetCapacity(_In_ const std::size_t capacity) noexcept
+    {
+        mCapacity = capacity;
+        EvictTo(mCapacity);
+    }
+
+    void MagicPacketCache::Clear() noexcept
+    {
+        mIndex.clear();
+        mEntries.clear();
+    }
+
+    std::uint64_t MagicPacketCache::ToKey(_In_ const MacAddress& macAddress) noexcept
+    {
+        std::uint64_t key = 0U;
+        for (const std::byte value : macAddress)
+        {
+            key = (key << 8U) | std::to_integer<std::uint64_t>(value);
+        }
+
+        return key;
+    }
+
+    void MagicPacketCache::EvictTo(_In_ const std::size_t capacity) noexcept
+    {
+        while (mEntries.size() > capacity)
+        {
+            mIndex.erase(mEntries.back().mKey);
+            mEntries.pop_back();
+            ++mEvictionCount;
+        }
+    }
+
+    void TokenBucket::Reset(_In_ const double rate, _In_ const double capacity, _In_ const Clock::time_point now) noexcept
+    {
+        assert(rate >= 0.0 && capacity >= 1.0);
+        mRate = rate;
+        mCapacity = capacity;
+        mTokens = capacity;
+        mLastRefill = now;
+    }
+
+    bool TokenBucket::HasToken(_In_ const Clock::time_point now) noexcept
+    {
+        if (IsLimited() == false)
+            return true;
+
+        Refill(now);
+        return mTokens >= 1.0;
+    }
+
+    TokenBucket::Clock::duration TokenBucket::GetWaitTime(_In_ double count) const noexcept
+    {
+        count = (std::min)(count, mCapacity);
+        if (IsLimited() == false || mTokens >= count)
+            return Clock::duration::zero();
+
+        // 올림하여 깨어났을 때 토큰이 채워져 있도록 함
+        const std::chrono::duration<double> wait{(count - mTokens) / mRate};
+        return std::chrono::ceil<Clock::duration>(wait);
+    }
+
+    void TokenBucket::Refill(_In_ const Clock::time_point now) noexcept
+    {
+        if (now <= mLastRefill)
+            return;
+
+        const double elapsed = std::chrono::duration<double>(now - mLastRefill).count();
+        mTokens = (std::min)(mCapacity, mTokens + (elapsed * mRate));
+        mLastRefill = now;
+    }
+
+    void LatencyHistogram::Record(_In_ const std::chrono::nanoseconds latency, _In_ const std::uint64_t count) noexcept
+    {
+        const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(latency);
+        const std::uint64_t value = micros.count() > 0 ? static_cast<std::uint64_t>(micros.count()) : 0U;
+        mBuckets[GetBucketIndex(value)] += count;
+        mCount += count;
+        mMax = (std::max)(mMax, std::chrono::microseconds{static_cast<std::chrono::microseconds::rep>(value)});
+    }
+
+    void LatencyHistogram::Merge(_In_ const LatencyHistogram& other) noexcept
+    {
+        for (std::size_t i = 0U; i < BUCKET_COUNT; ++i)
+        {
+            mBuckets[i] += other.mBuckets[i];
+        }
+
+        mCount += other.mCount;
+        mMax = (std::max)(mMax, other.mMax);
+    }
+
+    std::chrono::microseconds LatencyHistogram::GetPercentile(_In_ const double percentile) const noexcept
+    {
+        if (mCount == 0U)
+            return std::chrono::microseconds{0};
+
+        // 백분위에 해당하는 순위(1부터)의 항목이 속한 구간을 찾음 (구간 상한이 최댓값보다 크면 최댓값)
+        const double clamped = (std::min)((std::max)(percentile, 0.0), 100.0);
+        const auto rank = (std::max)(std::uint64_t{1U}, static_cast<std::uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(mCount))));
+        std::uint64_t seen = 0U;
+        for (std::size_t i = 0U; i < BUCKET_COUNT; ++i)
+        {
+            seen += mBuckets[i];
+            if (seen >= rank)
+            {
+                const auto upperBound = static_cast<std::uint64_t>(mMax.count());
+                return std::chrono::microseconds{static_cast<std::chrono::microseconds::rep>((std::min)(GetBucketUpperBound(i), upperBound))};
+            }
+        }
+
+        return mMax;
+    }
+
+    WolErrorCode GetNetworkInterfaces(_Out_ std::vector<NetworkInterface>& interfaces) noexcept
+    {
+        interfaces.clear();
+
+        try
+        {
+#ifdef _WIN32
+            // 필요한 버퍼 크기를 알 수 없으므로 ERROR_BUFFER_OVERFLOW가 반환되면 알려준 크기로 다시 조회
+            constexpr ULONG flags = GAA_FLAG_SKIP_ANYCAST | GAA_FLAG_SKIP_MULTICAST | GAA_FLAG_SKIP_DNS_SERVER;
+            ULONG size = 16U * 1024U;
+            std::unique_ptr<std::byte[]> buffer{};
+            ULONG result = ERROR_BUFFER_OVERFLOW;
+            for (int attempt = 0; attempt < 3 && result == ERROR_BUFFER_OVERFLOW; ++attempt)
+            {
+                buffer = std::make_unique<std::byte[]>(size);
+                result = ::GetAdaptersAddresses(AF_INET, flags, nullptr,
+                                                reinterpret_cast<PIP_ADAPTER_ADDRESSES>(buffer.get()), &size);
+            }
+
+            if (result != NO_ERROR)
+            {
+                std::ignore = ::fwprintf(stderr, L"네트워크 인터페이스 목록을 읽을 수 없습니다: %lu\n", result);
+                return WolErrorCode::InterfaceNotFound;
+            }
+
+            for (auto adapter = reinterpret_cast<const IP_ADAPTER_ADDRESSES*>(buffer.get()); adapter != nullptr;
+                 adapter = adapter->Next)
+            {
+                if (adapter->OperStatus != IfOperStatusUp || adapter->IfType == IF_TYPE_SOFTWARE_LOOPBACK
+                    || adapter->IfType == IF_TYPE_TUNNEL)
+                {
+                    continue;
+                }
+
+                for (auto unicast = adapter->FirstUnicastAddress; unicast != nullptr; unicast = unicast->Next)
+                {
+                    if (unicast->Address.lpSockaddr->sa_family != AF_INET)
+                        continue;
+
+                    NetworkInterface& networkInterface = interfaces.emplace_back();
+                    networkInterface.mName = adapter->FriendlyName;
+                    networkInterface.mAddress = reinterpret_cast<const sockaddr_in*>(unicast->Address.lpSockaddr)->sin_addr.s_addr;
+                }
+            }
+#else
+            ifaddrs* list = nullptr;
+            if (::getifaddrs(&list) != 0)
+            {
+                std::ignore = ::fwprintf(stderr, L"네트워크 인터페이스 목록을 읽을 수 없습니다: %d (errno)\n", errno);
+                return WolErrorCode::InterfaceNotFound;
+            }
+
+            const std::unique_ptr<ifaddrs, void (*)(ifaddrs*)> listGuard{list, ::freeifaddrs};
+            for (const ifaddrs* entry = list; entry != nullptr; entry = entry->ifa_next)
+            {
+                constexpr unsigned int requiredFlags = IFF_UP | IFF_BROADCAST;
+                if (entry->ifa_addr == nullptr || entry->ifa_addr->sa_family != AF_INET
+                    || (entry->ifa_flags & requiredFlags) != requiredFlags || (entry->ifa_flags & IFF_LOOPBACK) != 0U)
+                {
+                    continue;
+                }
+
+                NetworkInterface& networkInterface = interfaces.emplace_back();
+                networkInterface.mName = Utf8ToWide(entry->ifa_name);
+                networkInterface.mAddress = reinterpret_cast<const sockaddr_in*>(entry->ifa_addr)->sin_addr.s_addr;
+            }
+#endif
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"네트워크 인터페이스 목록을 준비하는 중 오류가 발생했습니다.\n");
+            interfaces.clear();
+            return WolErrorCode::UnexpectedException;
+        }
+
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode SelectNetworkInterfaces(_In_ const std::vector<std::wstring>& names,
+                                         _Out_ std::vector<NetworkInterface>& selected) noexcept
+    {
+        selected.clear();
+
+        std::vector<NetworkInterface> interfaces{};
+        const WolErrorCode errorCode = GetNetworkInterfaces(interfaces);
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        const auto matches = [](const NetworkInterface& networkInterface, const std::wstring_view name) noexcept
+        {
+            std::array<wchar_t, 16U> addressText{};
+            FormatIpv4Address(networkInterface.mAddress, addressText);
+            return EqualsIgnoreCase(name, L"all") || EqualsIgnoreCase(name, networkInterface.mName)
+                || name == addressText.data();
+        };
+
+        try
+        {
+            for (const std::wstring& name : names)
+            {
+                if (std::none_of(interfaces.begin(), interfaces.end(),
+                                 [&](const NetworkInterface& networkInterface) { return matches(networkInterface, name); }))
+                {
+                    std::ignore = ::fwprintf(stderr, L"네트워크 인터페이스를 찾을 수 없습니다: %ls\n", name.c_str());
+                    return WolErrorCode::InterfaceNotFound;
+                }
+            }
+
+            for (const NetworkInterface& networkInterface : interfaces)
+            {
+                if (std::any_of(names.begin(), names.end(),
+                                [&](const std::wstring& name) { return matches(networkInterface, name); }))
+                {
+                    selected.push_back(networkInterface);
+                }
+            }
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"네트워크 인터페이스 목록을 준비하는 중 오류가 발생했습니다.\n");
+            selected.clear();
+            return WolErrorCode::UnexpectedException;
+        }
+
+        if (selected.empty())
+        {
+            std::ignore = ::fwprintf(stderr, L"사용할 수 있는 네트워크 인터페이스가 없습니다.\n");
+            return WolErrorCode::InterfaceNotFound;
+        }
+
+        return WolErrorCode::Success;
+    }
+
+    bool IoUringQueue::Open(_In_ const unsigned int entries) noexcept
+    {
+        if (IsOpen())
+            return true;
+
+#ifdef __linux__
+        io_uring_params params{};
+        const auto ringFd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (ringFd < 0)
+        {
+            return false;
+        }
+
+        mRingFd = ringFd;
+
+        // IORING_OP_SENDMSG를 지원하는지 확인 (IORING_REGISTER_PROBE를 지원하지 않는 커널(5.6 미만)도 사용하지 않음)
+        constexpr std::size_t probeOps = 256U;
+        alignas(io_uring_probe) std::array<std::byte, sizeof(io_uring_probe) + probeOps * sizeof(io_uring_probe_op)> probeBuffer{};
+        auto* const probe = reinterpret_cast<io_uring_probe*>(probeBuffer.data());
+        if (::syscall(__NR_io_uring_register, mRingFd, IORING_REGISTER_PROBE, probe, probeOps) < 0
+            || probe->last_op < IORING_OP_SENDMSG || (probe->ops[IORING_OP_SENDMSG].flags & IO_URING_OP_SUPPORTED) == 0U)
+        {
+            Close();
+            return false;
+        }
+
+        // 제출 큐 링, 완료 큐 링, 요청 배열을 공유 메모리로 연결
+        mSqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+        mCqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0U;
+        if (singleMap)
+        {
+            mSqRingSize = (std::max)(mSqRingSize, mCqRingSize);
+            mCqRingSize = mSqRingSize;
+        }
+
+        void* const sqRing = ::mmap(nullptr, mSqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFd,
+                                    IORING_OFF_SQ_RING);
+        if (sqRing == MAP_FAILED)
+        {
+            Close();
+            return false;
+        }
+
+        mSqRing = sqRing;
+        void* const cqRing = singleMap ? sqRing
+                                       : ::mmap(nullptr, mCqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFd,
+                                                IORING_OFF_CQ_RING);
+        if (cqRing == MAP_FAILED)
+        {
+            Close();
+            return false;
+        }
+
+        mCqRing = cqRing;
+        void* const sqes = ::mmap(nullptr, params.sq_entries * sizeof(io_uring_sqe), PROT_READ | PROT_WRITE,
+                                  MAP_SHARED | MAP_POPULATE, mRingFd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+        {
+            Close();
+            return false;
+        }
+
+        mSqes = static_cast<io_uring_sqe*>(sqes);
+        mSqEntries = params.sq_entries;
+
+        auto* const sqBase = static_cast<std::uint8_t*>(mSqRing);
+        auto* const cqBase = static_cast<std::uint8_t*>(mCqRing);
+        mSqTail = reinterpret_cast<unsigned int*>(sqBase + params.sq_off.tail);
+        mSqMask = *reinterpret_cast<const unsigned int*>(sqBase + params.sq_off.ring_mask);
+        mSqArray = reinterpret_cast<unsigned int*>(sqBase + params.sq_off.array);
+        mCqHead = reinterpret_cast<unsigned int*>(cqBase + params.cq_off.head);
+        mCqTail = reinterpret_cast<const unsigned int*>(cqBase + params.cq_off.tail);
+        mCqMask = *reinterpret_cast<const unsigned int*>(cqBase + params.cq_off.ring_mask);
+        mCqes = reinterpret_cast<const io_uring_cqe*>(cqBase + params.cq_off.cqes);
+        return true;
+#else
+        std::ignore = entries;
+        return false;
+#endif
+    }
+
+#ifdef __linux__
+    std::size_t IoUringQueue::SendMessages(_In_ const SOCKET socket, _In_ mmsghdr* const messages,
+                                           _In_ const std::size_t count, _Out_ int* const results) noexcept
+    {
+        assert(IsOpen());
+
+        std::size_t completed = 0U;
+        while (completed < count)
+        {
+            // 이전 묶음의 요청은 모두 제출되고 완료도 모두 수거했으므로 제출 큐 전체를 사용할 수 있음
+            const auto queued = static_cast<unsigned int>((std::min)(count - completed, std::size_t{mSqEntries}));
+            unsigned int tail = *mSqTail;
+            for (unsigned int i = 0U; i < queued; ++i, ++tail)
+            {
+                const unsigned int index = tail & mSqMask;
+                io_uring_sqe& sqe = mSqes[index];
+                sqe = {};
+                sqe.opcode = IORING_OP_SENDMSG;
+                sqe.fd = socket;
+                sqe.addr = reinterpret_cast<std::uintptr_t>(&messages[completed + i].msg_hdr);
+                sqe.len = 1U;
+                sqe.user_data = completed + i;
+                mSqArray[index] = index;
+            }
+
+            // 요청을 모두 채운 뒤 꼬리를 옮겨 커널에 공개
+            __atomic_store_n(mSqTail, tail, __ATOMIC_RELEASE);
+
+            // 제출에 실패하면 남은 요청은 더 제출하지 않고, 이미 제출한 요청(커널이 전송함)의 완료만 마저 수거
+            unsigned int unsubmitted = queued;
+            unsigned int reaped = 0U;
+            bool failed = false;
+            while (reaped < queued - (failed ? unsubmitted : 0U))
+            {
+                const unsigned int toSubmit = failed ? 0U : unsubmitted;
+                const unsigned int toReap = queued - (failed ? unsubmitted : 0U) - reaped;
+                const auto entered = static_cast<int>(::syscall(__NR_io_uring_enter, mRingFd, toSubmit, toReap,
+                                                                IORING_ENTER_GETEVENTS, nullptr, 0));
+                if (entered < 0 && errno != EINTR)
+                {
+                    // 수거마저 실패하면 나머지 결과는 알 수 없으나 제출한 요청은 전송된 것으로 간주
+                    if (failed)
+                        break;
+
+                    std::ignore = ::fwprintf(stderr, L"io_uring 요청 제출 실패: %d (errno), 소켓 API로 전송합니다.\n", errno);
+                    failed = true;
+                    continue;
+                }
+
+                if (entered > 0)
+                {
+                    unsubmitted -= static_cast<unsigned int>(entered);
+                }
+                else if (entered == 0 && toSubmit != 0U)
+                {
+                    std::ignore = ::fwprintf(stderr, L"io_uring 요청을 제출하지 못했습니다. 소켓 API로 전송합니다.\n");
+                    failed = true;
+                    continue;
+                }
+
+                // 도착한 완료를 모두 수거한 뒤 머리를 옮겨 커널에 알림
+                unsigned int head = *mCqHead;
+                const unsigned int cqTail = __atomic_load_n(mCqTail, __ATOMIC_ACQUIRE);
+                for (; head != cqTail; ++head, ++reaped)
+                {
+                    const io_uring_cqe& cqe = mCqes[head & mCqMask];
+                    results[cqe.user_data] = cqe.res;
+                }
+
+                __atomic_store_n(mCqHead, head, __ATOMIC_RELEASE);
+            }
+
+            // 제출한 요청까지를 처리한 것으로 반환하여 호출자가 같은 메시지를 다시 보내지 않도록 함
+            if (failed)
+            {
+                Close();
+                return completed + (queued - unsubmitted);
+            }
+
+            completed += queued;
+        }
+
+        return completed;
+    }
+#endif
+
+    void IoUringQueue::Close() noexcept
+    {
+#ifdef __linux__
+        if (mSqes != nullptr)
+        {
+            std::ignore = ::munmap(mSqes, mSqEntries * sizeof(io_uring_sqe));
+            mSqes = nullptr;
+        }
+
+        if (mCqRing != nullptr && mCqRing != mSqRing)
+        {
+            std::ignore = ::munmap(mCqRing, mCqRingSize);
+        }
+
+        if (mSqRing != nullptr)
+        {
+            std::ignore = ::munmap(mSqRing, mSqRingSize);
+        }
+
+        mSqRing = nullptr;
+        mCqRing = nullptr;
+        mSqEntries = 0U;
+
+        // 링 파일 디스크립터를 닫으면 진행 중인 요청은 커널이 정리
+        if (mRingFd >= 0)
+        {
+            std::ignore = ::close(mRingFd);
+            mRingFd = -1;
+        }
+#endif
+    }
+
+    /// @brief 호출한 스레드(0번) 외의 전송 스레드가 사용하는 소켓과 io_uring 큐
+    /// @details 전송 중에는 자신의 스레드에서만 사용하므로 잠금이 필요 없음
+    struct WakeOnLanSession::SendWorker final
+    {
+        /// @brief SO_BROADCAST가 설정된 UDP 소켓
+        Socket mSocket;
+
+        /// @brief IPv6 멀티캐스트 전송용 UDP 소켓 (IPv6 대상에게 처음 전송할 때 생성)
+        Socket mSocket6;
+
+        /// @brief 세션 소켓으로 전송할 때 사용하는 io_uring 큐
+        IoUringQueue mIoUring;
+
+        /// @brief 네트워크 인터페이스별 바인딩한 소켓 (세션의 mInterfaceSockets와 같은 순서, 열지 못한 인터페이스는 nullptr)
+        std::vector<std::unique_ptr<Socket>> mInterfaceSockets{};
+
+        /// @brief 네트워크 인터페이스별 io_uring 큐 (mInterfaceSockets와 같은 순서)
+        std::vector<std::unique_ptr<IoUringQueue>> mInterfaceQueues{};
+    };
+
+    WakeOnLanSession::WakeOnLanSession() noexcept = default;
+
+    WakeOnLanSession::~WakeOnLanSession() noexcept = default;
+
+    SendBackend WakeOnLanSession::GetActiveSendBackend() const noexcept
+    {
+        return mIoUring != nullptr && mIoUring->IsOpen() ? SendBackend::IoUring : SendBackend::Socket;
+    }
+
+    void WakeOnLanSession::SetSendThreads(_In_ const std::size_t threadCount) noexcept
+    {
+        assert(IsOpen() == false);
+        mSendThreads = (std::max)(std::size_t{1U}, (std::min)(threadCount, MAX_SEND_THREADS));
+    }
+
+    WolErrorCode WakeOnLanSession::Open() noexcept
+    {
+        if (IsOpen())
+            return WolErrorCode::Success;
+
+        WolErrorCode wolErrorCode = mWsaGuard.Initialize();
+        if (wolErrorCode != WolErrorCode::Success)
+        {
+            return wolErrorCode;
+        }
+
+        // 소켓 초기화 및 브로드캐스트 설정
+        Socket socket;
+        wolErrorCode = OpenBroadcastSocket(socket);
+        if (wolErrorCode != WolErrorCode::Success)
+        {
+            return wolErrorCode;
+        }
+
+        // 인터페이스를 지정했다면 인터페이스마다 소켓을 열고, 열지 못한 인터페이스는 결과에 기록한 뒤 건너뜀
+        // io_uring을 사용할 수 없으면 소켓 API로 전송 (큐가 열리지 않은 상태로 둠)
+        if (mIoUring == nullptr)
+        {
+            try
+            {
+                mIoUring = std::make_unique<IoUringQueue>();
+            }
+            catch (...)
+            {
+                return WolErrorCode::UnexpectedException;
+            }
+        }
+
+        const bool useIoUring = mSendBackend == SendBackend::IoUring && mIoUring->Open(IO_URING_ENTRIES);
+
+        WolErrorCode interfaceErrorCode = WolErrorCode::Success;
+        std::size_t openedCount = 0U;
+        try
+        {
+            mInterfaceSockets.clear();
+            mInterfaceQueues.clear();
+            for (InterfaceSendStats& stats : mInterfaceStats)
+            {
+                auto interfaceSocket = std::make_unique<Socket>();
+                auto interfaceQueue = std::make_unique<IoUringQueue>();
+                stats.mOpenResult = OpenInterfaceSocket(stats.mInterface, *interfaceSocket);
+                if (stats.mOpenResult != WolErrorCode::Success)
+                {
+                    interfaceErrorCode = stats.mOpenResult;
+                    interfaceSocket.reset();
+                }
+                else
+                {
+                    ++openedCount;
+                    if (useIoUring)
+                    {
+                        std::ignore = interfaceQueue->Open(IO_URING_ENTRIES);
+                    }
+                }
+
+                mInterfaceSockets.push_back(std::move(interfaceSocket));
+                mInterfaceQueues.push_back(std::move(interfaceQueue));
+            }
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"네트워크 인터페이스 소켓을 준비하는 중 오류가 발생했습니다.\n");
+            mInterfaceSockets.clear();
+            mInterfaceQueues.clear();
+            return WolErrorCode::UnexpectedException;
+        }
+
+        if (mInterfaceStats.empty() == false && openedCount == 0U)
+        {
+            mInterfaceSockets.clear();
+            mInterfaceQueues.clear();
+            return interfaceErrorCode;
+        }
+
+        // 전송 스레드를 여러 개 사용한다면 스레드마다 자신의 소켓과 큐를 만듦 (0번 스레드는 세션의 소켓과 큐를 사용)
+        try
+        {
+            mWorkers.clear();
+            for (std::size_t i = 1U; i < mSendThreads; ++i)
+            {
+                auto worker = std::make_unique<SendWorker>();
+                wolErrorCode = OpenWorker(*worker, useIoUring);
+                if (wolErrorCode != WolErrorCode::Success)
+                {
+                    mWorkers.clear();
+                    mInterfaceSockets.clear();
+                    mInterfaceQueues.clear();
+                    return wolErrorCode;
+                }
+
+                mWorkers.push_back(std::move(worker));
+            }
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"전송 스레드의 소켓을 준비하는 중 오류가 발생했습니다.\n");
+            mWorkers.clear();
+            mInterfaceSockets.clear();
+            mInterfaceQueues.clear();
+            return WolErrorCode::UnexpectedException;
+        }
+
+        // 모든 설정에 성공한 소켓만 세션에 보관
+        mSocket.Set(socket.Release());
+        return WolErrorCode::Success;
+    }
+
+    void WakeOnLanSession::SetInterfaces(_In_ const std::vector<NetworkInterface>& interfaces)
+    {
+        assert(IsOpen() == false);
+
+        std::vector<InterfaceSendStats> interfaceStats(interfaces.size());
+        for (std::size_t i = 0U; i < interfaces.size(); ++i)
+        {
+            interfaceStats[i].mInterface = interfaces[i];
+        }
+
+        mInterfaceStats = std::move(interfaceStats);
+    }
+
+    WolErrorCode WakeOnLanSession::OpenBroadcastSocket(_Inout_ Socket& socket) const noexcept
+    {
+        WolErrorCode wolErrorCode = InitializeSocket(socket);
+        if (wolErrorCode != WolErrorCode::Success)
+        {
+            return wolErrorCode;
+        }
+
+        // 브로드캐스트 설정 (WinSock의 BOOL과 POSIX 모두 int 크기의 옵션 값을 사용)
+        constexpr int broadcastOpt = 1;
+        if (setsockopt(socket.Get(), SOL_SOCKET, SO_BROADCAST, reinterpret_cast<const char*>(&broadcastOpt),
+                       sizeof(broadcastOpt)) == SOCKET_ERROR)
+        {
+            return WolErrorCode::BroadcastSetupFailed;
+        }
+
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode WakeOnLanSession::OpenWorker(_Inout_ SendWorker& worker, _In_ const bool useIoUring) const
+    {
+        WolErrorCode wolErrorCode = OpenBroadcastSocket(worker.mSocket);
+        if (wolErrorCode != WolErrorCode::Success)
+        {
+            return wolErrorCode;
+        }
+
+        if (useIoUring)
+            std::ignore = worker.mIoUring.Open(IO_URING_ENTRIES);
+
+        for (std::size_t i = 0U; i < mInterfaceSockets.size(); ++i)
+        {
+            std::unique_ptr<Socket> interfaceSocket{};
+            auto interfaceQueue = std::make_unique<IoUringQueue>();
+            if (mInterfaceSockets[i] != nullptr)
+            {
+                interfaceSocket = std::make_unique<Socket>();
+                wolErrorCode = OpenInterfaceSocket(mInterfaceStats[i].mInterface, *interfaceSocket);
+                if (wolErrorCode != WolErrorCode::Success)
+                {
+                    return wolErrorCode;
+                }
+
+                if (useIoUring)
+                    std::ignore = interfaceQueue->Open(IO_URING_ENTRIES);
+            }
+
+            worker.mInterfaceSockets.push_back(std::move(interfaceSocket));
+            worker.mInterfaceQueues.push_back(std::move(interfaceQueue));
+        }
+
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode WakeOnLanSession::OpenInterfaceSocket(_In_ const NetworkInterface& networkInterface,
+                                                       _Inout_ Socket& socket) const noexcept
+    {
+        WolErrorCode wolErrorCode = OpenBroadcastSocket(socket);
+        if (wolErrorCode != WolErrorCode::Success)
+        {
+            return wolErrorCode;
+        }
+
+        sockaddr_in localAddr{};
+        localAddr.sin_family = AF_INET;
+        localAddr.sin_addr.s_addr = networkInterface.mAddress;
+        if (::bind(socket.Get(), reinterpret_cast<const sockaddr*>(&localAddr), sizeof(localAddr)) == SOCKET_ERROR)
+        {
+            std::array<wchar_t, 16U> addressText{};
+            FormatIpv4Address(networkInterface.mAddress, addressText);
+            std::ignore = ::fwprintf(stderr, L"네트워크 인터페이스에 바인딩할 수 없습니다: %ls (%ls), %d (WSALastError)\n",
+                                     networkInterface.mName.c_str(), addressText.data(), WSAGetLastError());
+            return WolErrorCode::InterfaceBindFailed;
+        }
+
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode WakeOnLanSession::Send(_In_ const MacAddress& macAddress,
+                                        _In_ const DestinationAddress& destAddr, _In_ const std::uint16_t rack) noexcept
+    {
+        assert(IsOpen());
+
+        if (mPacing.IsEnabled())
+        {
+            try
+            {
+                WaitForToken(rack);
+            }
+            catch (...)
+            {
+                std::ignore = ::fwprintf(stderr, L"전송 속도 제한을 적용하는 중 오류가 발생했습니다.\n");
+                return WolErrorCode::UnexpectedException;
+            }
+        }
+
+        // 매직 패킷 조회 (처음 전송하는 MAC 주소이면 생성)
+        MagicPacket packet{};
+        GetMagicPacket(macAddress, packet);
+
+        // 인터페이스를 지정했거나 IPv6 대상이면 일괄 전송과 같은 경로로 전송
+        if (mInterfaceSockets.empty() == false || IsIpv6Destination(destAddr))
+        {
+            const WolPacket wolPacket{packet, destAddr, rack};
+            WolErrorCode result = WolErrorCode::PacketSendFailed;
+            try
+            {
+                SendPackets(&wolPacket, 1U, &result);
+            }
+            catch (...)
+            {
+                std::ignore = ::fwprintf(stderr, L"패킷 전송을 준비하는 중 오류가 발생했습니다.\n");
+                return WolErrorCode::UnexpectedException;
+            }
+
+            return result;
+        }
+
+        // 매직 패킷 전송
+        const auto sendResult = sendto(mSocket.Get(), reinterpret_cast<const char*>(packet.data()),
+                                       static_cast<int>(packet.size()), 0, reinterpret_cast<const sockaddr*>(&destAddr.mIpv4),
+                                       sizeof(destAddr.mIpv4));
+        if (sendResult == SOCKET_ERROR)
+        {
+            std::ignore = ::fwprintf(stderr, L"패킷 전송 실패: %d (WSALastError)\n", WSAGetLastError());
+            return WolErrorCode::PacketSendFailed;
+        }
+
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode WakeOnLanSession::SendBatch(_In_ const std::vector<WolPacket>& packets,
+                                             _Out_ std::vector<WolErrorCode>& results) noexcept
+    {
+        assert(IsOpen());
+
+        try
+        {
+            // 아직 전송하지 않은 패킷은 전송 실패로 간주
+            results.assign(packets.size(), WolErrorCode::PacketSendFailed);
+
+            if (mPacing.IsEnabled())
+            {
+                SendPaced(packets, results);
+            }
+            else
+            {
+                SendPackets(packets.data(), packets.size(), results.data());
+            }
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"전송 결과 목록을 준비하는 중 오류가 발생했습니다.\n");
+            return WolErrorCode::UnexpectedException;
+        }
+
+        return WolErrorCode::Success;
+    }
+
+    void WakeOnLanSession::SendPackets(_In_ const WolPacket* const packets, _In_ const std::size_t count,
+                                       _Out_ WolErrorCode* const results)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        // 패킷이 전송 스레드들에게 넘겨진 시각 (패킷별 지연 시간의 시작)
+        const Clock::time_point enqueueTime = Clock::now();
+        if (count == 0U)
+            return;
+
+        // IPv6 대상이 있을 때만 IPv6 소켓을 만듦 (IPv6를 사용하지 않는 환경에는 영향 없음)
+        const auto ipv6Count = static_cast<std::size_t>(std::count_if(packets, packets + count, [](const WolPacket& packet)
+        {
+            return IsIpv6Destination(packet.mDestAddr);
+        }));
+
+        // 경로 목록: 인터페이스를 지정하지 않았다면 세션 소켓 하나, 지정했다면 열린 인터페이스마다 하나와 IPv6 대상용 세션 소켓 하나
+        // 인터페이스 소켓은 IPv4 주소에 바인딩되어 있으므로 IPv6 패킷은 보내지 않음 (IPv6는 범위 ID로 인터페이스를 선택)
+        constexpr std::size_t SESSION_LANE = SIZE_MAX;
+        std::vector<std::size_t> lanes{};
+        for (std::size_t i = 0U; i < mInterfaceSockets.size(); ++i)
+        {
+            if (mInterfaceSockets[i] != nullptr)
+                lanes.push_back(i);
+        }
+
+        const bool useInterfaces = lanes.empty() == false;
+        if (useInterfaces == false || ipv6Count != 0U)
+            lanes.push_back(SESSION_LANE);
+
+        // 스레드 수: 지정한 스레드 수, 지정하지 않았다면 경로마다 하나 (항목 수보다 많이 만들지 않음)
+        // 패킷이 하나뿐이면 스레드를 만드는 비용이 전송보다 크므로 호출한 스레드에서 차례로 전송
+        const std::size_t laneCount = lanes.size();
+        const std::size_t chunkCount = (count + mBatchSize - 1U) / mBatchSize;
+        const std::size_t itemCount = laneCount * chunkCount;
+        const bool canSteal = mSendThreads > 1U;
+        std::size_t workerCount = canSteal ? (std::min)(mSendThreads, itemCount) : laneCount;
+        if (count <= 1U)
+            workerCount = 1U;
+
+        if (mWorkerStats.size() < workerCount)
+            mWorkerStats.resize(workerCount);
+
+        // 스레드별 경로의 소켓과 큐 (스레드를 시작하기 전에 모두 준비하고, 스레드 안에서는 할당하지 않음)
+        // 가져오지 않는 경우에는 스레드마다 자신의 경로만 전송하므로 경로별로 하나씩만 준비
+        struct Endpoint final
+        {
+            SOCKET mIpv4Socket{INVALID_SOCKET};
+            SOCKET mIpv6Socket{INVALID_SOCKET};
+            IoUringQueue* mQueue{nullptr};
+        };
+
+        const std::size_t endpointSets = canSteal ? workerCount : 1U;
+        std::vector<Endpoint> endpoints(endpointSets * laneCount);
+        for (std::size_t w = 0U; w < endpointSets; ++w)
+        {
+            SendWorker* const worker = w == 0U ? nullptr : mWorkers[w - 1U].get();
+            Socket& ipv4Socket = worker == nullptr ? mSocket : worker->mSocket;
+            IoUringQueue& queue = worker == nullptr ? *mIoUring : worker->mIoUring;
+            const SOCKET ipv6Socket = ipv6Count != 0U ? GetIpv6Socket(worker == nullptr ? mSocket6 : worker->mSocket6)
+                                                      : INVALID_SOCKET;
+            for (std::size_t l = 0U; l < laneCount; ++l)
+            {
+                Endpoint& endpoint = endpoints[(w * laneCount) + l];
+                if (lanes[l] == SESSION_LANE)
+                {
+                    endpoint = {useInterfaces ? INVALID_SOCKET : ipv4Socket.Get(), ipv6Socket, &queue};
+                    continue;
+                }
+
+                const std::size_t i = lanes[l];
+                endpoint = {worker == nullptr ? mInterfaceSockets[i]->Get() : worker->mInterfaceSockets[i]->Get(), INVALID_SOCKET,
+                            worker == nullptr ? mInterfaceQueues[i].get() : worker->mInterfaceQueues[i].get()};
+            }
+        }
+
+        // 경로별 결과 (인터페이스를 지정하지 않았다면 결과 목록에 바로 기록)
+        std::vector<std::vector<WolErrorCode>> laneResults(useInterfaces ? laneCount : 0U);
+        std::vector<WolErrorCode*> laneOutputs(laneCount, results);
+        for (std::size_t l = 0U; l < laneResults.size(); ++l)
+        {
+            laneResults[l].resize(count);
+            laneOutputs[l] = laneResults[l].data();
+        }
+
+        // 항목(경로 * 묶음 수 + 묶음)들을 스레드 수만큼의 연속된 몫으로 나눔
+        // 경로마다 스레드 하나인 경우 몫 하나가 경로 하나와 같음
+        std::vector<SendShard> shards(workerCount);
+        for (std::size_t w = 0U; w < workerCount; ++w)
+        {
+            shards[w].mNext.store((itemCount * w) / workerCount, std::memory_order_relaxed);
+            shards[w].mEnd = (itemCount * (w + 1U)) / workerCount;
+        }
+
+        std::vector<int> lastErrors(workerCount * laneCount, 0);
+
+        // 각 스레드는 자신의 소켓과 큐, 통계, 오류 코드만 사용하고 몫의 다음 항목 위치만 원자적으로 공유
+        const auto runWorker = [&](const std::size_t w) noexcept
+        {
+            SendWorkerStats& stats = mWorkerStats[w];
+            const Clock::time_point start = Clock::now();
+            const auto sendItem = [&](const std::size_t item)
+            {
+                const std::size_t l = item / chunkCount;
+                const std::size_t offset = (item % chunkCount) * mBatchSize;
+                const std::size_t chunkSize = (std::min)(mBatchSize, count - offset);
+                const Endpoint& endpoint = endpoints[((canSteal ? w : 0U) * laneCount) + l];
+                WolErrorCode* const output = laneOutputs[l] + offset;
+
+                const int chunkError = SendChunk(endpoint.mIpv4Socket, endpoint.mIpv6Socket, *endpoint.mQueue,
+                                                 packets + offset, chunkSize, output);
+                const Clock::time_point completed = Clock::now();
+                if (chunkError != 0)
+                    lastErrors[(w * laneCount) + l] = chunkError;
+
+                // 경로에서 보내지 않는 주소 계열의 패킷(WolErrorCode::SocketCreationFailed)은 세지 않음
+                const auto sent = static_cast<std::uint64_t>(std::count(output, output + chunkSize, WolErrorCode::Success));
+                const auto failed = static_cast<std::uint64_t>(std::count(output, output + chunkSize, WolErrorCode::PacketSendFailed));
+                stats.mPacketsSent += sent;
+                stats.mSendErrors += failed;
+                ++stats.mChunks;
+                if (sent + failed != 0U)
+                    stats.mLatency.Record(completed - enqueueTime, sent + failed);
+            };
+
+            for (std::size_t item = shards[w].mNext.fetch_add(1U, std::memory_order_relaxed); item < shards[w].mEnd;
+                 item = shards[w].mNext.fetch_add(1U, std::memory_order_relaxed))
+            {
+                sendItem(item);
+            }
+
+            // 자신의 몫을 끝냈다면 다음 스레드의 몫부터 차례로 남은 항목을 가져옴
+            for (std::size_t k = 1U; canSteal && k < workerCount; ++k)
+            {
+                SendShard& shard = shards[(w + k) % workerCount];
+                for (std::size_t item = shard.mNext.fetch_add(1U, std::memory_order_relaxed); item < shard.mEnd;
+                     item = shard.mNext.fetch_add(1U, std::memory_order_relaxed))
+                {
+                    sendItem(item);
+                    ++stats.mStolenChunks;
+                }
+            }
+
+            stats.mActiveTime += Clock::now() - start;
+        };
+
+        // 0번 스레드는 호출한 스레드에서 실행하고, 스레드를 만들 수 없으면 그 몫은 호출한 스레드에서 이어서 전송
+        // (가져올 수 있다면 다른 스레드가 이미 가져갔을 수 있음)
+        std::vector<std::thread> workers{};
+        std::vector<std::size_t> notStarted{};
+        workers.reserve(workerCount);
+        notStarted.reserve(workerCount);
+        for (std::size_t w = 1U; w < workerCount; ++w)
+        {
+            try
+            {
+                workers.emplace_back(runWorker, w);
+            }
+            catch (const std::system_error&)
+            {
+                notStarted.push_back(w);
+            }
+        }
+
+        runWorker(0U);
+        for (const std::size_t w : notStarted)
+        {
+            runWorker(w);
+        }
+
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+
+        if (useInterfaces == false)
+            return;
+
+        // 인터페이스별 통계를 기록하고, 하나 이상의 경로로 전송한 패킷은 성공
+        std::fill_n(results, count, WolErrorCode::PacketSendFailed);
+        for (std::size_t l = 0U; l < laneCount; ++l)
+        {
+            const std::vector<WolErrorCode>& laneResult = laneResults[l];
+            for (std::size_t j = 0U; j < count; ++j)
+            {
+                if (laneResult[j] == WolErrorCode::Success)
+                    results[j] = WolErrorCode::Success;
+            }
+
+            if (lanes[l] == SESSION_LANE)
+                continue;
+
+            InterfaceSendStats& stats = mInterfaceStats[lanes[l]];
+            for (std::size_t w = 0U; w < workerCount; ++w)
+            {
+                if (lastErrors[(w * laneCount) + l] != 0)
+                    stats.mLastError = lastErrors[(w * laneCount) + l];
+            }
+
+            const auto sent = static_cast<std::uint64_t>(std::count(laneResult.begin(), laneResult.end(), WolErrorCode::Success));
+            stats.mPacketsSent += sent;
+            stats.mSendErrors += (count - ipv6Count) - sent;
+        }
+    }
+
+    SOCKET WakeOnLanSession::GetIpv6Socket(_Inout_ Socket& socket) noexcept
+    {
+        if (socket.Get() != INVALID_SOCKET || mIpv6Unavailable)
+            return socket.Get();
+
+        Socket ipv6Socket;
+        if (InitializeSocket(ipv6Socket, AF_INET6) != WolErrorCode::Success)
+        {
+            std::ignore = ::fwprintf(stderr, L"IPv6 소켓을 만들 수 없어 IPv6 대상에게 전송하지 않습니다.\n");
+            mIpv6Unavailable = true;
+            return INVALID_SOCKET;
+        }
+
+        // 기본 홉 제한(1)으로는 라우터를 넘지 못하므로 사이트 범위 그룹(ff05:: 등)에도 전달되도록 늘림
+        // 링크 로컬 그룹(ff02::)은 그룹의 범위에 따라 라우터가 전달하지 않음
+        constexpr int hopLimit = IPV6_MULTICAST_HOP_LIMIT;
+        std::ignore = setsockopt(ipv6Socket.Get(), IPPROTO_IPV6, IPV6_MULTICAST_HOPS, reinterpret_cast<const char*>(&hopLimit),
+                                 sizeof(hopLimit));
+
+        socket.Set(ipv6Socket.Release());
+        return socket.Get();
+    }
+
+    void WakeOnLanSession::SetBatchSize(_In_ const std::size_t batchSize) noexcept
+    {
+        mBatchSize = (std::max)(std::size_t{1U}, (std::min)(batchSize, MAX_BATCH_SIZE));
+    }
+
+    void WakeOnLanSession::SetPacing(_In_ const PacingPolicy& policy) noexcept
+    {
+        // 버킷 용량을 지정하지 않으면 초당 한도의 1/10 (최소 1)
+        const auto getCapacity = [](const double rate, const std::uint32_t burst) noexcept
+        {
+            return burst != 0U ? static_cast<double>(burst) : (std::max)(1.0, std::floor(rate / 10.0));
+        };
+
+        mPacing = policy;
+        mPacketBucket.Reset(policy.mPacketsPerSecond, getCapacity(policy.mPacketsPerSecond, policy.mPacketBurst),
+                            TokenBucket::Clock::now());
+        mRackBuckets.clear();
+        mPacingStats = {};
+    }
+
+    void WakeOnLanSession::SendPaced(_In_ const std::vector<WolPacket>& packets,
+                                     _Inout_ std::vector<WolErrorCode>& results)
+    {
+        using Clock = TokenBucket::Clock;
+
+        // 아직 보내지 않은 패킷의 위치 (목록 순서 유지)
+        std::vector<std::size_t> pending(packets.size());
+        for (std::size_t i = 0U; i < pending.size(); ++i)
+        {
+            pending[i] = i;
+        }
+
+        std::vector<WolPacket> burst{};
+        std::vector<std::size_t> burstIndices{};
+        std::vector<WolErrorCode> burstResults{};
+        const bool rackLimited = mPacing.mRackHostsPerSecond > 0.0;
+
+        while (pending.empty() == false)
+        {
+            const Clock::time_point now = Clock::now();
+            burst.clear();
+            burstIndices.clear();
+
+            // 토큰이 있는 패킷을 묶음에 추가하고, 랙 토큰이 없는 패킷은 앞쪽으로 모아 다음 차례로 미룸
+            std::size_t kept = 0U;
+            std::size_t position = 0U;
+            for (; position < pending.size(); ++position)
+            {
+                if (mPacketBucket.HasToken(now) == false)
+                {
+                    ++mPacingStats.mPacketLimitHits;
+                    break;
+                }
+
+                const std::size_t index = pending[position];
+                const std::uint16_t rack = packets[index].mRack;
+                if (rackLimited && rack != 0U)
+                {
+                    TokenBucket& rackBucket = GetRackBucket(rack, now);
+                    if (rackBucket.HasToken(now) == false)
+                    {
+                        ++mPacingStats.mRackDeferrals;
+                        pending[kept++] = index;
+                        continue;
+                    }
+
+                    rackBucket.Take();
+                }
+
+                mPacketBucket.Take();
+                burst.push_back(packets[index]);
+                burstIndices.push_back(index);
+            }
+
+            // 확인하지 못한 나머지 패킷은 미룬 패킷 뒤에 순서대로 남김
+            pending.erase(std::copy(pending.begin() + static_cast<std::ptrdiff_t>(position), pending.end(),
+                                    pending.begin() + static_cast<std::ptrdiff_t>(kept)),
+                          pending.end());
+
+            if (burst.empty())
+            {
+                // 전체 토큰이 없다면 한 개씩 보내지 않도록 남은 패킷 수(최대 버킷 용량)만큼 채워질 때까지 기다려
+                // 다음 묶음도 sendmmsg() 한 번으로 보낼 수 있게 함 (평균 속도와 최대 묶음 크기는 같음)
+                // 전체 토큰이 있다면 남은 패킷은 모두 랙 토큰을 기다리는 중이므로 가장 먼저 채워지는 랙까지 기다림
+                Clock::duration wait = mPacketBucket.GetWaitTime(static_cast<double>(pending.size()));
+                if (mPacketBucket.HasToken(now))
+                {
+                    wait = Clock::duration::max();
+                    for (const std::size_t index : pending)
+                    {
+                        wait = (std::min)(wait, GetRackBucket(packets[index].mRack, now).GetWaitTime());
+                    }
+                }
+
+                WaitFor(wait);
+                continue;
+            }
+
+            // 허용된 묶음 안에서는 기존과 같이 mBatchSize 단위로 일괄 전송
+            burstResults.resize(burst.size());
+            SendPackets(burst.data(), burst.size(), burstResults.data());
+
+            for (std::size_t i = 0U; i < burst.size(); ++i)
+            {
+                results[burstIndices[i]] = burstResults[i];
+            }
+
+            ++mPacingStats.mBursts;
+            mPacingStats.mPacketsSent += burst.size();
+            mPacingStats.mLargestBurst = (std::max)(mPacingStats.mLargestBurst, std::uint64_t{burst.size()});
+        }
+    }
+
+    TokenBucket& WakeOnLanSession::GetRackBucket(_In_ const std::uint16_t rack, _In_ const TokenBucket::Clock::time_point now)
+    {
+        const auto [found, inserted] = mRackBuckets.try_emplace(rack);
+        if (inserted)
+        {
+            const double capacity = mPacing.mRackBurst != 0U ? static_cast<double>(mPacing.mRackBurst)
+                                                             : (std::max)(1.0, std::floor(mPacing.mRackHostsPerSecond / 10.0));
+            found->second.Reset(mPacing.mRackHostsPerSecond, capacity, now);
+        }
+
+        return found->second;
+    }
+
+    void WakeOnLanSession::WaitForToken(_In_ const std::uint16_t rack)
+    {
+        using Clock = TokenBucket::Clock;
+
+        const bool rackLimited = mPacing.mRackHostsPerSecond > 0.0 && rack != 0U;
+        for (;;)
+        {
+            const Clock::time_point now = Clock::now();
+            TokenBucket* const rackBucket = rackLimited ? &GetRackBucket(rack, now) : nullptr;
+            const bool packetReady = mPacketBucket.HasToken(now);
+            const bool rackReady = rackBucket == nullptr || rackBucket->HasToken(now);
+            if (packetReady && rackReady)
+            {
+                mPacketBucket.Take();
+                if (rackBucket != nullptr)
+                    rackBucket->Take();
+
+                ++mPacingStats.mBursts;
+                ++mPacingStats.mPacketsSent;
+                mPacingStats.mLargestBurst = (std::max)(mPacingStats.mLargestBurst, std::uint64_t{1U});
+                return;
+            }
+
+            if (packetReady == false)
+                ++mPacingStats.mPacketLimitHits;
+            else
+                ++mPacingStats.mRackDeferrals;
+
+            WaitFor((std::max)(mPacketBucket.GetWaitTime(),
+                               rackBucket != nullptr ? rackBucket->GetWaitTime() : Clock::duration::zero()));
+        }
+    }
+
+    void WakeOnLanSession::WaitFor(_In_ const TokenBucket::Clock::duration wait)
+    {
+        const auto start = TokenBucket::Clock::now();
+        std::this_thread::sleep_for(wait);
+
+        ++mPacingStats.mWaits;
+        mPacingStats.mWaitTime += std::chrono::duration_cast<std::chrono::microseconds>(TokenBucket::Clock::now() - start);
+    }
+
+    int WakeOnLanSession::SendChunk(_In_ const SOCKET ipv4Socket, _In_ const SOCKET ipv6Socket,
+                                    _Inout_ IoUringQueue& queue, _In_ const WolPacket* const packets,
+                                    _In_ const std::size_t count, _Out_ WolErrorCode* const results) const noexcept
+    {
+        assert(count <= MAX_BATCH_SIZE);
+
+        int lastError = 0;
+
+#ifdef __linux__
+        // 묶음 전체를 sendmmsg()로 전송하기 위한 메시지 헤더
+        std::array<mmsghdr, MAX_BATCH_SIZE> messages{};
+        std::array<iovec, MAX_BATCH_SIZE> buffers{};
+        for (std::size_t i = 0U; i < count; ++i)
+        {
+            // sendmmsg()는 버퍼를 읽기만 하지만 iovec이 non-const 포인터를 요구함
+            buffers[i].iov_base = const_cast<std::byte*>(packets[i].mPacket.data());
+            buffers[i].iov_len = packets[i].mPacket.size();
+
+            messages[i].msg_hdr.msg_name = const_cast<DestinationAddress*>(&packets[i].mDestAddr);
+            messages[i].msg_hdr.msg_namelen = static_cast<socklen_t>(GetDestinationLength(packets[i].mDestAddr));
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1U;
+        }
+
+        // 소켓은 주소 계열마다 다르므로 주소 계열이 같은 연속된 패킷을 한 번에 전송
+        std::size_t runBegin = 0U;
+        while (runBegin < count)
+        {
+            const bool isIpv6 = IsIpv6Destination(packets[runBegin].mDestAddr);
+            std::size_t runEnd = runBegin + 1U;
+            while (runEnd < count && IsIpv6Destination(packets[runEnd].mDestAddr) == isIpv6)
+            {
+                ++runEnd;
+            }
+
+            const SOCKET socket = isIpv6 ? ipv6Socket : ipv4Socket;
+            if (socket == INVALID_SOCKET)
+            {
+                std::fill(results + runBegin, results + runEnd, WolErrorCode::SocketCreationFailed);
+                runBegin = runEnd;
+                continue;
+            }
+
+            // io_uring 큐가 열려 있으면 요청으로 제출하고, 큐가 처리하지 못한 나머지는 sendmmsg()로 전송
+            std::size_t sent = runBegin;
+            if (queue.IsOpen())
+            {
+                std::array<int, MAX_BATCH_SIZE> sendResults{};
+                const std::size_t completed = queue.SendMessages(socket, messages.data() + runBegin, runEnd - runBegin,
+                                                                 sendResults.data());
+                for (std::size_t i = 0U; i < completed; ++i, ++sent)
+                {
+                    if (sendResults[i] >= 0)
+                    {
+                        results[sent] = WolErrorCode::Success;
+                        continue;
+                    }
+
+                    lastError = -sendResults[i];
+                    std::ignore = ::fwprintf(stderr, L"패킷 전송 실패: %d (errno)\n", lastError);
+                    results[sent] = WolErrorCode::PacketSendFailed;
+                }
+            }
+
+            // sendmmsg()는 중간에 실패하면 그 전까지 전송한 메시지 수를 반환하므로
+            // 실패한 메시지 하나를 건너뛰고 나머지를 다시 전송
+            while (sent < runEnd)
+            {
+                const int result = ::sendmmsg(socket, messages.data() + sent,
+                                              static_cast<unsigned int>(runEnd - sent), 0);
+                if (result > 0)
+                {
+                    std::fill_n(results + sent, static_cast<std::size_t>(result), WolErrorCode::Success);
+                    sent += static_cast<std::size_t>(result);
+                    continue;
+                }
+
+                if (result < 0 && errno == EINTR)
+                    continue;
+
+                lastError = errno;
+                std::ignore = ::fwprintf(stderr, L"패킷 전송 실패: %d (errno)\n", lastError);
+                results[sent] = WolErrorCode::PacketSendFailed;
+                ++sent;
+            }
+
+            runBegin = runEnd;
+        }
+#else
+        // WinSock에는 sendmmsg()에 해당하는 API가 없으므로 준비된 버퍼를 순서대로 전송 (io_uring도 없음)
+        std::ignore = queue;
+        for (std::size_t i = 0U; i < count; ++i)
+        {
+            const WolPacket& packet = packets[i];
+            const SOCKET socket = IsIpv6Destination(packet.mDestAddr) ? ipv6Socket : ipv4Socket;
+            if (socket == INVALID_SOCKET)
+            {
+                results[i] = WolErrorCode::SocketCreationFailed;
+                continue;
+            }
+
+            const auto sendResult = sendto(socket, reinterpret_cast<const char*>(packet.mPacket.data()),
+                                           static_cast<int>(packet.mPacket.size()), 0,
+                                           reinterpret_cast<const sockaddr*>(&packet.mDestAddr),
+                                           GetDestinationLength(packet.mDestAddr));
+            if (sendResult == SOCKET_ERROR)
+            {
+                lastError = WSAGetLastError();
+                std::ignore = ::fwprintf(stderr, L"패킷 전송 실패: %d (WSALastError)\n", lastError);
+                results[i] = WolErrorCode::PacketSendFailed;
+                continue;
+            }
+
+            results[i] = WolErrorCode::Success;
+        }
+#endif
+
+        return lastError;
+    }
+
+    WolErrorCode WakeOnLanSession::InitializeSocket(_Inout_ Socket& socket, _In_ const int family) const noexcept
+    {
+        // 소켓 생성
+        const SOCKET rawSocket = ::socket(family, SOCK_DGRAM, IPPROTO_UDP);
+
+        if (rawSocket == INVALID_SOCKET)
+        {
+            std::ignore = ::fwprintf(stderr, L"소켓 생성에 실패 했습니다.\n");
+            return WolErrorCode::SocketCreationFailed;
+        }
+
+#ifdef _WIN32
+        // ICMP "port unreachable" 리셋 방지
+        // POSIX에서는 연결되지 않은 UDP 소켓에 ICMP 오류가 전달되지 않으므로 필요 없음
+        bool bNewBehavior = FALSE;
+        DWORD dwBytesReturned = 0;
+        WSAIoctl(rawSocket, SIO_UDP_CONNRESET, &bNewBehavior, sizeof(bNewBehavior),
+                 nullptr, 0, &dwBytesReturned, nullptr, nullptr);
+#endif
+
+        socket.Set(rawSocket);
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode WakeOnLanSender::SendMagicPacket(_In_ const std::wstring_view macAddress,
+                                                  _In_ const std::wstring_view broadcastAddress,
+                                                  _In_range_(1, 65535) const std::uint16_t port) const noexcept
+    {
+        // 설정 파일을 읽는 과정에서 설정 값(Mac Address, Broadcast Address, port)의 값이 유효한지
+        // 검증 했기 떄문에 여기서 또 검증하지 않는다. 간단히 assert로만 체크
+        assert(macAddress.empty() == false);
+        assert(broadcastAddress.empty() == false);
+        assert(port != 0);
+
+        WakeOnLanSession session;
+        WolErrorCode wolErrorCode = session.Open();
+        if (wolErrorCode != WolErrorCode::Success)
+        {
+            return wolErrorCode;
+        }
+
+        // 설정 파일을 거치지 않은 문자열이므로 여기서 바이너리 값으로 변환
+        MacAddress macBytes{};
+        if (ParseMacAddress(macAddress, macBytes).IsSuccess() == false)
+        {
+            return WolErrorCode::InvalidMacAddress;
+        }
+
+        // IPv6 멀티캐스트 주소(ff02::1%eth0 등) 또는 IPv4 브로드캐스트 주소
+        in_addr broadcastAddr{};
+        Ipv6Multicast multicast{};
+        std::wstring_view scope{};
+        if (ParseIpv6Multicast(broadcastAddress, multicast.mGroup, scope))
+        {
+            if (ResolveScopeId(scope, multicast.mScopeId) == false)
+            {
+                return WolErrorCode::InvalidBroadcastIp;
+            }
+        }
+        else
+        {
+            std::uint32_t hostAddress = 0U;
+            if (ParseIpv4Address(broadcastAddress, hostAddress) == false)
+            {
+                return WolErrorCode::InvalidBroadcastIp;
+            }
+
+            broadcastAddr.s_addr = htonl(hostAddress);
+        }
+
+        // 대상 주소 설정
+        DestinationAddress destAddr{};
+        SetupDestination(broadcastAddr, multicast, port, destAddr);
+
+        return session.Send(macBytes, destAddr);
+    }
+
+    WolErrorCode WakeOnLanSender::SendMagicPackets(_In_ const std::vector<WolTarget>& targets,
+                                                   _Out_ std::vector<WolErrorCode>& results) const noexcept
+    {
+        // WinSock 초기화와 소켓 생성은 대상 수와 관계없이 한 번만 수행
+        WakeOnLanSession session;
+        const WolErrorCode wolErrorCode = session.Open();
+        if (wolErrorCode != WolErrorCode::Success)
+        {
+            results.clear();
+            return wolErrorCode;
+        }
+
+        return SendMagicPackets(session, targets, results);
+    }
+
+    WolErrorCode WakeOnLanSender::SendGroupedByDestination(_Inout_ WakeOnLanSession& session,
+                                                           _In_ const std::vector<WolPacket>& packets,
+                                                           _Out_ std::vector<WolErrorCode>& results) const
+    {
+        // 목적지(주소, 포트)별 묶음 번호 (처음 나타난 순서) 와 묶음별 패킷 수
+        std::unordered_map<std::uint64_t, std::size_t> groupIndex{};
+        std::vector<std::size_t> groupOfPacket(packets.size());
+        std::vector<std::size_t> groupStart{};
+        std::vector<std::pair<const sockaddr_in6*, std::size_t>> ipv6Groups{};
+        bool contiguous = true;
+        for (std::size_t i = 0U; i < packets.size(); ++i)
+        {
+            std::size_t group = groupStart.size();
+            bool inserted = true;
+            const DestinationAddress& destAddr = packets[i].mDestAddr;
+            if (IsIpv6Destination(destAddr))
+            {
+                const sockaddr_in6& ipv6 = destAddr.mIpv6;
+                const auto found = std::find_if(ipv6Groups.begin(), ipv6Groups.end(), [&ipv6](const auto& entry)
+                {
+                    return entry.first->sin6_port == ipv6.sin6_port && entry.first->sin6_scope_id == ipv6.sin6_scope_id &&
+                           std::memcmp(&entry.first->sin6_addr, &ipv6.sin6_addr, sizeof(ipv6.sin6_addr)) == 0;
+                });
+                if (found != ipv6Groups.end())
+                {
+                    group = found->second;
+                    inserted = false;
+                }
+                else
+                {
+                    ipv6Groups.emplace_back(&ipv6, group);
+                }
+            }
+            else
+            {
+                const std::uint64_t key = (std::uint64_t{destAddr.mIpv4.sin_addr.s_addr} << 16U) | destAddr.mIpv4.sin_port;
+                const auto [found, isNew] = groupIndex.try_emplace(key, group);
+                group = found->second;
+                inserted = isNew;
+            }
+
+            if (inserted)
+            {
+                groupStart.push_back(0U);
+            }
+            else if (groupOfPacket[i - 1U] != group)
+            {
+                // 앞에서 끝난 묶음이 다시 나타남
+                contiguous = false;
+            }
+
+            groupOfPacket[i] = group;
+            ++groupStart[group];
+        }
+
+        // 이미 목적지별로 모여 있으면 (대부분의 설정 파일) 순서를 바꾸지 않음
+        if (contiguous)
+        {
+            return session.SendBatch(packets, results);
+        }
+
+        // 계수 정렬: 묶음별 시작 위치를 구한 뒤 안정적으로 재배치
+        std::size_t offset = 0U;
+        for (std::size_t& start : groupStart)
+        {
+            offset += std::exchange(start, offset);
+        }
+
+        std::vector<WolPacket> grouped(packets.size());
+        std::vector<std::size_t> originalIndices(packets.size());
+        for (std::size_t i = 0U; i < packets.size(); ++i)
+        {
+            const std::size_t position = groupStart[groupOfPacket[i]]++;
+            grouped[position] = packets[i];
+            originalIndices[position] = i;
+        }
+
+        std::vector<WolErrorCode> groupedResults{};
+        const WolErrorCode errorCode = session.SendBatch(grouped, groupedResults);
+        if (errorCode != WolErrorCode::Success)
+        {
+            results.clear();
+            return errorCode;
+        }
+
+        // 결과는 원래 대상 순서로 되돌림
+        results.resize(packets.size());
+        for (std::size_t position = 0U; position < grouped.size(); ++position)
+        {
+            results[originalIndices[position]] = groupedResults[position];
+        }
+
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode WakeOnLanSender::SendMagicPackets(_Inout_ WakeOnLanSession& session,
+                                                   _In_ const std::vector<WolTarget>& targets,
+                                                   _Out_ std::vector<WolErrorCode>& results) const noexcept
+    {
+        try
+        {
+            // 모든 패킷을 먼저 연속된 버퍼에 준비한 뒤 일괄 전송
+            // 설정을 읽을 때 변환해 둔 바이너리 값만 사용하므로 준비 과정에는 실패가 없음
+            std::vector<WolPacket> packets(targets.size());
+            for (std::size_t i = 0U; i < targets.size(); ++i)
+            {
+                PreparePacket(session, targets[i], packets[i]);
+            }
+
+            return SendGroupedByDestination(session, packets, results);
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"전송할 패킷 목록을 준비하는 중 오류가 발생했습니다.\n");
+            results.clear();
+            return WolErrorCode::UnexpectedException;
+        }
+    }
+
+    WolErrorCode WakeOnLanSender::SendMagicPackets(_In_ const TargetDatabase& database,
+                                                   _Out_ std::vector<WolErrorCode>& results) const noexcept
+    {
+        // WinSock 초기화와 소켓 생성은 대상 수와 관계없이 한 번만 수행
+        WakeOnLanSession session;
+        const WolErrorCode wolErrorCode = session.Open();
+        if (wolErrorCode != WolErrorCode::Success)
+        {
+            results.clear();
+            return wolErrorCode;
+        }
+
+        return SendMagicPackets(session, database, results);
+    }
+
+    WolErrorCode WakeOnLanSender::SendMagicPackets(_Inout_ WakeOnLanSession& session,
+                                                   _In_ const TargetDatabase& database,
+                                                   _Out_ std::vector<WolErrorCode>& results) const noexcept
+    {
+        try
+        {
+            // 데이터베이스의 레코드는 검증을 마친 바이너리 값이므로 그대로 패킷을 준비
+            std::vector<WolPacket> packets(database.GetCount());
+            for (std::size_t i = 0U; i < packets.size(); ++i)
+            {
+                PreparePacket(session, database.GetRecord(i), packets[i]);
+            }
+
+            return SendGroupedByDestination(session, packets, results);
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"전송할 패킷 목록을 준비하는 중 오류가 발생했습니다.\n");
+            results.clear();
+            return WolErrorCode::UnexpectedException;
+        }
+    }
+
+    void WakeOnLanSender::PreparePacket(_Inout_ WakeOnLanSession& session, _In_ const WolTarget& target,
+                                        _Out_ WolPacket& packet) const noexcept
+    {
+        // 매직 패킷 조회 (처음 전송하는 MAC 주소이면 생성)
+        session.GetMagicPacket(target.mMacBytes, packet.mPacket);
+
+        // 대상 주소 설정
+        SetupDestination(target.mBroadcastAddr, target.mMulticast, target.mPort, packet.mDestAddr);
+        packet.mRack = target.mRack;
+    }
+
+    void WakeOnLanSender::PreparePacket(_Inout_ WakeOnLanSession& session,
+                                        _In_ const TargetDatabase::Record& record,
+                                        _Out_ WolPacket& packet) const noexcept
+    {
+        // 매직 패킷 조회 (처음 전송하는 MAC 주소이면 생성)
+        session.GetMagicPacket(record.mMacBytes, packet.mPacket);
+
+        // 대상 주소 설정
+        in_addr broadcastAddr{};
+        broadcastAddr.s_addr = record.mBroadcastAddress;
+        SetupDestination(broadcastAddr, record.mMulticast, record.mPort, packet.mDestAddr);
+        packet.mRack = record.mRack;
+    }
+
+    void WakeOnLanSender::SetupDestination(_In_ const in_addr& broadcastAddress, _In_ const Ipv6Multicast& multicast,
+                                           _In_range_(1, 65535) const std::uint16_t port,
+                                           _Out_ DestinationAddress& destAddr) const noexcept
+    {
+        assert(port != 0);
+
+        destAddr = {};
+        if (multicast.IsSet() == false)
+        {
+            SetupBroadcastAddress(broadcastAddress, port, destAddr.mIpv4);
+            return;
+        }
+
+        // 링크 로컬 그룹(ff02::)은 범위 ID로 전송할 인터페이스를 선택 (0이면 운영체제의 기본 인터페이스)
+        destAddr.mIpv6.sin6_family = AF_INET6;
+        destAddr.mIpv6.sin6_port = htons(port);
+        std::memcpy(&destAddr.mIpv6.sin6_addr, multicast.mGroup.data(), multicast.mGroup.size());
+        destAddr.mIpv6.sin6_scope_id = multicast.mScopeId;
+    }
+
+    void WakeOnLanSender::SetupBroadcastAddress(_In_ const in_addr& broadcastAddress,
+                                                _In_range_(1, 65535) const std::uint16_t port,
+                                                _Out_ sockaddr_in& destAddr) const noexcept
+    {
+        // 설정 파일을 읽는 과정에서 설정 값(Mac Address, Broadcast Address, port)의 값이 유효한지
+        // 검증 했기 떄문에 여기서 또 검증하지 않는다. 간단히 assert로만 체크
+        assert(port != 0);
+
+        // 구조체 초기화
+        destAddr = {};
+        destAddr.sin_family = AF_INET;
+        destAddr.sin_port = htons(port);
+        destAddr.sin_addr = broadcastAddress;
+    }
+
+    LivenessProber::LivenessProber() noexcept = default;
+
+    LivenessProber::~LivenessProber() noexcept = default;
+
+    WolErrorCode LivenessProber::Open(_In_ const ProbeMethod method) noexcept
+    {
+        WolErrorCode errorCode = mWsaGuard.Initialize();
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        mMethod = method;
+
+#ifndef _WIN32
+        // 수천 개의 연결을 동시에 시도할 수 있도록 열 수 있는 파일 수를 최대로 올리고,
+        // 그래도 부족하면 동시 연결 수를 줄임 (표준 입출력 등을 위해 여유를 남김)
+        if (rlimit limit{}; ::getrlimit(RLIMIT_NOFILE, &limit) == 0)
+        {
+            if (limit.rlim_cur < limit.rlim_max)
+            {
+                limit.rlim_cur = limit.rlim_max;
+                std::ignore = ::setrlimit(RLIMIT_NOFILE, &limit);
+                std::ignore = ::getrlimit(RLIMIT_NOFILE, &limit);
+            }
+
+            constexpr rlim_t reserved = 64U;
+            if (limit.rlim_cur != RLIM_INFINITY)
+            {
+                const rlim_t available = limit.rlim_cur > reserved * 2U ? limit.rlim_cur - reserved : reserved;
+                mMaxConnectsInFlight = static_cast<std::size_t>((std::min)(available, rlim_t{MAX_CONNECTS_IN_FLIGHT}));
+            }
+        }
+#endif
+
+        switch (method)
+        {
+        case ProbeMethod::TcpConnect:
+            break;
+
+        case ProbeMethod::IcmpEcho:
+        {
+            // 권한이 필요 없는 ICMP 데이터그램 소켓 (Linux: net.ipv4.ping_group_range, macOS) > raw 소켓 순서로 시도
+            SOCKET icmpSocket = INVALID_SOCKET;
+#ifndef _WIN32
+            icmpSocket = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_ICMP);
+#endif
+            mRawIcmp = icmpSocket == INVALID_SOCKET;
+            if (mRawIcmp)
+            {
+                icmpSocket = ::socket(AF_INET, SOCK_RAW, IPPROTO_ICMP);
+            }
+
+            if (icmpSocket == INVALID_SOCKET)
+            {
+#ifdef _WIN32
+                std::ignore = ::fwprintf(stderr, L"ICMP 소켓을 만들 수 없습니다 (관리자 권한 필요): %d\n", WSAGetLastError());
+#else
+                std::ignore = ::fwprintf(stderr, L"ICMP 소켓을 만들 수 없습니다 (net.ipv4.ping_group_range 설정 또는 root 권한 필요): %d\n",
+                                         WSAGetLastError());
+#endif
+                return WolErrorCode::ProbeUnavailable;
+            }
+
+            mSocket.Set(icmpSocket);
+            if (SetNonBlocking(mSocket.Get()) == false)
+            {
+                return WolErrorCode::SocketCreationFailed;
+            }
+
+            // 한 회차에 모든 대상의 요청을 한꺼번에 보내고 응답도 한꺼번에 도착하므로 버퍼를 늘림
+            // (실패하면 기본 크기로 계속 진행하며, 버려진 요청/응답은 다음 회차에 다시 보냄)
+            constexpr int bufferSize = ICMP_SOCKET_BUFFER_SIZE;
+            std::ignore = ::setsockopt(mSocket.Get(), SOL_SOCKET, SO_RCVBUF, reinterpret_cast<const char*>(&bufferSize),
+                                       sizeof(bufferSize));
+            std::ignore = ::setsockopt(mSocket.Get(), SOL_SOCKET, SO_SNDBUF, reinterpret_cast<const char*>(&bufferSize),
+                                       sizeof(bufferSize));
+
+#ifdef _WIN32
+            mEchoIdentifier = static_cast<std::uint16_t>(::GetCurrentProcessId());
+#else
+            mEchoIdentifier = static_cast<std::uint16_t>(::getpid());
+#endif
+            break;
+        }
+
+        case ProbeMethod::Neighbor:
+        {
+#if !defined(_WIN32) && !defined(__linux__)
+            std::ignore = ::fwprintf(stderr, L"이 플랫폼에서는 이웃 테이블로 확인할 수 없습니다.\n");
+            return WolErrorCode::ProbeUnavailable;
+#else
+            const SOCKET udpSocket = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+            if (udpSocket == INVALID_SOCKET)
+            {
+                std::ignore = ::fwprintf(stderr, L"소켓 생성에 실패 했습니다.\n");
+                return WolErrorCode::SocketCreationFailed;
+            }
+
+            mSocket.Set(udpSocket);
+            if (SetNonBlocking(mSocket.Get()) == false)
+            {
+                return WolErrorCode::SocketCreationFailed;
+            }
+            break;
+#endif
+        }
+        }
+
+        // ICMP Echo 요청과 주소 확인 유도 패킷은 io_uring 요청으로 한꺼번에 보낼 수 있음 (TCP 연결 시도는 소켓 API 사용)
+        if (method != ProbeMethod::TcpConnect && mSendBackend == SendBackend::IoUring)
+        {
+            try
+            {
+                mIoUring = std::make_unique<IoUringQueue>();
+            }
+            catch (...)
+            {
+                return WolErrorCode::UnexpectedException;
+            }
+
+            std::ignore = mIoUring->Open(static_cast<unsigned int>(PROBE_BATCH_SIZE));
+        }
+
+        mOpened = true;
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode LivenessProber::Start(_In_ const std::vector<ProbeTarget>& targets) noexcept
+    {
+        assert(mOpened);
+
+        try
+        {
+            mConnectSockets.reset();
+            mConnecting.clear();
+            mMacIndex.clear();
+
+            mTargets = targets;
+            mResults.assign(targets.size(), ProbeResult{});
+            mStartTime = Clock::now();
+            mNextAttempts.assign(targets.size(), mStartTime);
+            mNextRound = mStartTime;
+            mAlive.clear();
+            mAlive.reserve(targets.size());
+            mSessionTag = static_cast<std::uint32_t>(mStartTime.time_since_epoch().count()) | 1U;
+            mPendingCount = targets.size();
+
+            if (mMethod == ProbeMethod::TcpConnect)
+            {
+                mConnectSockets = std::make_unique<Socket[]>(targets.size());
+                mConnecting.reserve((std::min)(targets.size(), mMaxConnectsInFlight));
+            }
+
+            for (std::size_t i = 0U; i < targets.size(); ++i)
+            {
+                if (mMethod == ProbeMethod::Neighbor)
+                {
+                    mMacIndex.emplace(ToKey(targets[i].mMacBytes), i);
+                }
+                else if (targets[i].mHostAddress == 0U)
+                {
+                    // 확인할 주소가 없는 대상은 처음부터 제외
+                    mResults[i].mResult = WolErrorCode::InvalidHostIp;
+                    --mPendingCount;
+                }
+            }
+
+            return WolErrorCode::Success;
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"확인할 대상 목록을 준비하는 중 오류가 발생했습니다.\n");
+            mTargets.clear();
+            mResults.clear();
+            mPendingCount = 0U;
+            return WolErrorCode::UnexpectedException;
+        }
+    }
+
+    WolErrorCode LivenessProber::Poll(_In_ const std::chrono::milliseconds wait,
+                                      _Out_ std::vector<std::size_t>& alive) noexcept
+    {
+        alive.clear();
+        if (mPendingCount == 0U)
+        {
+            return WolErrorCode::Success;
+        }
+
+        mAlive.clear();
+        Clock::time_point now = Clock::now();
+        StartAttempts(now);
+
+        // 기다릴 소켓 목록: 진행 중인 TCP 연결(쓰기 가능 = 연결 완료 또는 실패), ICMP 응답(읽기 가능)
+        mPollFds.clear();
+        try
+        {
+            for (const std::size_t index : mConnecting)
+            {
+                mPollFds.push_back({mConnectSockets[index].Get(), POLLOUT, 0});
+            }
+
+            if (mMethod == ProbeMethod::IcmpEcho)
+            {
+                mPollFds.push_back({mSocket.Get(), POLLIN, 0});
+            }
+        }
+        catch (...)
+        {
+            return WolErrorCode::UnexpectedException;
+        }
+
+        // 다음 확인 요청 시각이 먼저 오면 그때까지만 기다림 (1ms 단위로 올림)
+        const Clock::time_point deadline = (std::min)(now + wait, GetNextAttemptTime());
+        const auto timeout = std::chrono::ceil<std::chrono::milliseconds>((std::max)(deadline - now, Clock::duration::zero()));
+        const int timeoutMs = static_cast<int>((std::min)(timeout.count(), std::chrono::milliseconds::rep{INT32_MAX}));
+
+        int ready = 0;
+        if (mPollFds.empty())
+        {
+            // 기다릴 소켓이 없으면 (이웃 테이블 확인) 다음 확인 시각까지 대기
+#ifdef _WIN32
+            ::Sleep(static_cast<DWORD>(timeoutMs));
+#else
+            std::ignore = ::poll(nullptr, 0U, timeoutMs);
+#endif
+        }
+        else
+        {
+            ready = WSAPoll(mPollFds.data(), static_cast<unsigned long>(mPollFds.size()), timeoutMs);
+#ifndef _WIN32
+            if (ready == SOCKET_ERROR && errno == EINTR)
+            {
+                // 시그널로 중단된 경우 다음 호출에서 다시 기다림
+                ready = 0;
+            }
+#endif
+            if (ready == SOCKET_ERROR)
+            {
+                std::ignore = ::fwprintf(stderr, L"응답을 기다리는 중 오류가 발생했습니다: %d\n", WSAGetLastError());
+                return WolErrorCode::UnexpectedException;
+            }
+        }
+
+        now = Clock::now();
+        if (ready > 0)
+        {
+            for (const WSAPOLLFD& pollFd : mPollFds)
+            {
+                if (pollFd.revents == 0)
+                    continue;
+
+                if (mMethod == ProbeMethod::IcmpEcho)
+                {
+                    ReceiveEchoReplies(now);
+                    continue;
+                }
+
+                // mPollFds는 mConnecting과 같은 순서로 채움
+                const auto position = static_cast<std::size_t>(&pollFd - mPollFds.data());
+                CompleteConnect(mConnecting[position], now);
+            }
+
+            // 끝난 연결 시도를 목록에서 제거
+            mConnecting.erase(std::remove_if(mConnecting.begin(), mConnecting.end(), [this](const std::size_t index)
+            {
+                return mConnectSockets[index].Get() == INVALID_SOCKET;
+            }), mConnecting.end());
+        }
+
+        try
+        {
+            alive.assign(mAlive.begin(), mAlive.end());
+        }
+        catch (...)
+        {
+            return WolErrorCode::UnexpectedException;
+        }
+
+        return WolErrorCode::Success;
+    }
+
+    void LivenessProber::StartAttempts(_In_ const Clock::time_point now) noexcept
+    {
+        switch (mMethod)
+        {
+        case ProbeMethod::TcpConnect:
+        {
+            // 제한 시간이 지난 연결 시도를 닫고 바로 다시 시도할 수 있게 함
+            mConnecting.erase(std::remove_if(mConnecting.begin(), mConnecting.end(), [this, now](const std::size_t index)
+            {
+                if (now < mNextAttempts[index])
+                    return false;
+
+                closesocket(mConnectSockets[index].Release());
+                return true;
+            }), mConnecting.end());
+
+            for (std::size_t i = 0U; i < mTargets.size() && mConnecting.size() < mMaxConnectsInFlight; ++i)
+            {
+                if (mResults[i].mResult == WolErrorCode::HostNotResponding && mConnectSockets[i].Get() == INVALID_SOCKET
+                    && now >= mNextAttempts[i])
+                {
+                    StartConnect(i, now);
+                }
+            }
+            break;
+        }
+
+        case ProbeMethod::IcmpEcho:
+            if (now >= mNextRound)
+            {
+                SendEchoRequests();
+                mNextRound = now + ATTEMPT_INTERVAL;
+            }
+            break;
+
+        case ProbeMethod::Neighbor:
+            if (now >= mNextRound)
+            {
+                ScanNeighborTable(now);
+                mNextRound = now + ATTEMPT_INTERVAL;
+            }
+            break;
+        }
+    }
+
+    void LivenessProber::StartConnect(_In_ const std::size_t index, _In_ const Clock::time_point now) noexcept
+    {
+        ProbeResult& result = mResults[index];
+        ++result.mAttempts;
+
+        // 시도가 실패하면 ATTEMPT_INTERVAL 뒤에 다시 시도 (진행 중이면 이 시각이 시도의 제한 시각)
+        mNextAttempts[index] = now + ATTEMPT_INTERVAL;
+
+        Socket socket(::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP));
+        if (socket.Get() == INVALID_SOCKET || SetNonBlocking(socket.Get()) == false)
+        {
+            // 일시적인 자원 부족일 수 있으므로 다음 시도까지 기다림
+            return;
+        }
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(mTargets[index].mPort);
+        address.sin_addr.s_addr = mTargets[index].mHostAddress;
+
+        if (::connect(socket.Get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0)
+        {
+            MarkAlive(index, now);
+            return;
+        }
+
+        const int error = WSAGetLastError();
+#ifdef _WIN32
+        if (error == WSAEWOULDBLOCK)
+#else
+        if (error == EINPROGRESS)
+#endif
+        {
+            mConnectSockets[index].Set(socket.Release());
+            mConnecting.push_back(index); // Start()에서 최대 동시 연결 수만큼 예약
+            return;
+        }
+
+#ifdef _WIN32
+        if (error == WSAECONNREFUSED)
+#else
+        if (error == ECONNREFUSED)
+#endif
+        {
+            // 연결 거부(RST)는 대상 장치의 운영체제가 응답한 것
+            MarkAlive(index, now);
+        }
+    }
+
+    void LivenessProber::CompleteConnect(_In_ const std::size_t index, _In_ const Clock::time_point now) noexcept
+    {
+        const SOCKET socket = mConnectSockets[index].Release();
+
+        int error = 0;
+#ifdef _WIN32
+        int length = sizeof(error);
+#else
+        socklen_t length = sizeof(error);
+#endif
+        const bool queried = ::getsockopt(socket, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &length) == 0;
+        closesocket(socket);
+
+#ifdef _WIN32
+        if (queried && (error == 0 || error == WSAECONNREFUSED))
+#else
+        if (queried && (error == 0 || error == ECONNREFUSED))
+#endif
+        {
+            MarkAlive(index, now);
+        }
+
+        // 실패한 경우 (예: 주소 확인 실패로 인한 EHOSTUNREACH) mNextAttempts[index]에 다시 시도
+    }
+
+    void LivenessProber::SendEchoRequests() noexcept
+    {
+        for (std::size_t i = 0U; i < mTargets.size(); ++i)
+        {
+            if (mResults[i].mResult != WolErrorCode::HostNotResponding)
+                continue;
+
+            IcmpEchoPacket packet{};
+            packet.mType = 8U; // Echo Request
+            packet.mIdentifier = htons(mEchoIdentifier); // 데이터그램 소켓에서는 커널이 소켓별 값으로 바꿈
+            packet.mSequence = htons(static_cast<std::uint16_t>(mResults[i].mAttempts));
+            packet.mTargetIndex = static_cast<std::uint32_t>(i);
+            packet.mSessionTag = mSessionTag;
+            packet.mChecksum = ComputeInternetChecksum(reinterpret_cast<const std::uint8_t*>(&packet), sizeof(packet));
+
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = mTargets[i].mHostAddress;
+
+            ++mResults[i].mAttempts;
+            QueueDatagram(&packet, sizeof(packet), address);
+        }
+
+        FlushDatagrams();
+    }
+
+    void LivenessProber::ReceiveEchoReplies(_In_ const Clock::time_point now) noexcept
+    {
+        // IP 헤더(최대 60바이트)를 포함한 응답을 받을 수 있는 크기
+        std::array<std::uint8_t, 128U> buffer{};
+
+        for (;;)
+        {
+            sockaddr_in source{};
+#ifdef _WIN32
+            int sourceLength = sizeof(source);
+#else
+            socklen_t sourceLength = sizeof(source);
+#endif
+            const auto received = ::recvfrom(mSocket.Get(), reinterpret_cast<char*>(buffer.data()),
+                                             static_cast<int>(buffer.size()), 0, reinterpret_cast<sockaddr*>(&source),
+                                             &sourceLength);
+            if (received == SOCKET_ERROR)
+            {
+                // 더 읽을 응답이 없음 (non-blocking) 또는 이전 요청에 대한 ICMP 오류
+                return;
+            }
+
+            // raw 소켓(및 macOS의 데이터그램 소켓)은 IP 헤더부터 전달함
+            // ICMP Echo 응답의 첫 바이트(Type 0)는 IPv4 헤더의 첫 바이트(0x4?)와 겹치지 않음
+            std::size_t offset = 0U;
+            if (received > 0 && (buffer[0] >> 4U) == 4U)
+            {
+                offset = static_cast<std::size_t>(buffer[0] & 0x0FU) * 4U;
+            }
+
+            if (static_cast<std::size_t>(received) < offset + sizeof(IcmpEchoPacket))
+                continue;
+
+            IcmpEchoPacket reply{};
+            std::memcpy(&reply, buffer.data() + offset, sizeof(reply));
+
+            // Echo 응답(Type 0)만 사용 (raw 소켓은 다른 프로세스의 응답과 루프백으로 보낸 요청도 받음)
+            if (reply.mType != 0U || reply.mSessionTag != mSessionTag || reply.mTargetIndex >= mTargets.size())
+                continue;
+
+            if (mRawIcmp && reply.mIdentifier != htons(mEchoIdentifier))
+                continue;
+
+            const std::size_t index = reply.mTargetIndex;
+            if (mTargets[index].mHostAddress == source.sin_addr.s_addr && mResults[index].mResult == WolErrorCode::HostNotResponding)
+            {
+                MarkAlive(index, now);
+            }
+        }
+    }
+
+    void LivenessProber::ScanNeighborTable(_In_ const Clock::time_point now) noexcept
+    {
+        // 완성된 항목(MAC 주소를 아는 항목)에 대해 응답 처리
+        const auto markMacAddress = [this, now](const MacAddress& macAddress)
+        {
+            const auto range = mMacIndex.equal_range(ToKey(macAddress));
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (mResults[it->second].mResult == WolErrorCode::HostNotResponding)
+                {
+                    MarkAlive(it->second, now);
+                }
+            }
+        };
+
+#ifdef _WIN32
+        PMIB_IPNET_TABLE2 table = nullptr;
+        if (::GetIpNetTable2(AF_INET, &table) == NO_ERROR)
+        {
+            for (ULONG i = 0U; i < table->NumEntries; ++i)
+            {
+                const MIB_IPNET_ROW2& row = table->Table[i];
+                if (row.PhysicalAddressLength != std::tuple_size_v<MacAddress> || row.State <= NlnsIncomplete)
+                    continue;
+
+                MacAddress macAddress{};
+                std::memcpy(macAddress.data(), row.PhysicalAddress, macAddress.size());
+                markMacAddress(macAddress);
+            }
+
+            ::FreeMibTable(table);
+        }
+#elif defined(__linux__)
+        // 형식: "IP address  HW type  Flags  HW address  Mask  Device" (Flags의 0x2(ATF_COM)가 완성된 항목)
+        if (std::FILE* const file = std::fopen("/proc/net/arp", "r"); file != nullptr)
+        {
+            std::array<char, 256U> line{};
+            std::ignore = std::fgets(line.data(), static_cast<int>(line.size()), file); // 머리글
+            while (std::fgets(line.data(), static_cast<int>(line.size()), file) != nullptr)
+            {
+                std::array<char, 64U> ip{};
+                std::array<char, 32U> hardwareAddress{};
+                unsigned int hardwareType = 0U;
+                unsigned int flags = 0U;
+                if (std::sscanf(line.data(), "%63s 0x%x 0x%x %31s", ip.data(), &hardwareType, &flags, hardwareAddress.data()) != 4
+                    || (flags & 0x2U) == 0U)
+                {
+                    continue;
+                }
+
+                const std::string_view text{hardwareAddress.data()};
+                const std::wstring wideText(text.begin(), text.end());
+                MacAddress macAddress{};
+                if (ParseMacAddress(wideText, macAddress).IsSuccess())
+                {
+                    markMacAddress(macAddress);
+                }
+            }
+
+            std::ignore = std::fclose(file);
+        }
+#endif
+
+        // 아직 응답하지 않은 대상의 주소 확인(ARP)을 유도 (다음 회차에 결과가 테이블에 나타남)
+        for (std::size_t i = 0U; i < mTargets.size(); ++i)
+        {
+            if (mResults[i].mResult != WolErrorCode::HostNotResponding)
+                continue;
+
+            ++mResults[i].mAttempts;
+            if (mTargets[i].mHostAddress == 0U)
+                continue;
+
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_port = htons(NEIGHBOR_SOLICIT_PORT);
+            address.sin_addr.s_addr = mTargets[i].mHostAddress;
+
+            constexpr char payload = 0;
+            QueueDatagram(&payload, sizeof(payload), address);
+        }
+
+        FlushDatagrams();
+    }
+
+    void LivenessProber::QueueDatagram(_In_reads_(size) const void* const data, _In_ const std::size_t size,
+                                       _In_ const sockaddr_in& address) noexcept
+    {
+        assert(size <= sizeof(IcmpEchoPacket));
+
+        std::memcpy(&mBatchData[mBatchCount], data, size);
+        mBatchSizes[mBatchCount] = size;
+        mBatchAddresses[mBatchCount] = address;
+        if (++mBatchCount == PROBE_BATCH_SIZE)
+        {
+            FlushDatagrams();
+        }
+    }
+
+    void LivenessProber::FlushDatagrams() noexcept
+    {
+        std::size_t sent = 0U;
+
+#ifdef __linux__
+        if (mIoUring != nullptr && mIoUring->IsOpen())
+        {
+            std::array<mmsghdr, PROBE_BATCH_SIZE> messages{};
+            std::array<iovec, PROBE_BATCH_SIZE> buffers{};
+            std::array<int, PROBE_BATCH_SIZE> results{};
+            for (std::size_t i = 0U; i < mBatchCount; ++i)
+            {
+                buffers[i].iov_base = &mBatchData[i];
+                buffers[i].iov_len = mBatchSizes[i];
+                messages[i].msg_hdr.msg_name = &mBatchAddresses[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(mBatchAddresses[i]);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1U;
+            }
+
+            sent = mIoUring->SendMessages(mSocket.Get(), messages.data(), mBatchCount, results.data());
+        }
+#endif
+
+        for (; sent < mBatchCount; ++sent)
+        {
+            std::ignore = ::sendto(mSocket.Get(), reinterpret_cast<const char*>(&mBatchData[sent]),
+                                   static_cast<int>(mBatchSizes[sent]), 0,
+                                   reinterpret_cast<const sockaddr*>(&mBatchAddresses[sent]), sizeof(mBatchAddresses[sent]));
+        }
+
+        mBatchCount = 0U;
+    }
+
+    void LivenessProber::MarkAlive(_In_ const std::size_t index, _In_ const Clock::time_point now) noexcept
+    {
+        ProbeResult& result = mResults[index];
+        assert(result.mResult == WolErrorCode::HostNotResponding);
+
+        result.mResult = WolErrorCode::Success;
+        result.mTimeToAlive = std::chrono::duration_cast<std::chrono::milliseconds>(now - mStartTime);
+        --mPendingCount;
+
+        // Start()에서 대상 수만큼 예약했으므로 할당하지 않음
+        mAlive.push_back(index);
+    }
+
+    LivenessProber::Clock::time_point LivenessProber::GetNextAttemptTime() const noexcept
+    {
+        if (mMethod != ProbeMethod::TcpConnect)
+        {
+            return mNextRound;
+        }
+
+        // 진행 중인 시도의 제한 시각 또는 다시 시도할 시각 중 가장 이른 시각
+        // (동시 연결 수가 가득 찼다면 진행 중인 시도가 끝나야 다음 시도를 시작할 수 있음)
+        const bool canStart = mConnecting.size() < mMaxConnectsInFlight;
+        Clock::time_point next = Clock::time_point::max();
+        for (std::size_t i = 0U; i < mTargets.size(); ++i)
+        {
+            if (mResults[i].mResult != WolErrorCode::HostNotResponding)
+                continue;
+
+            if (canStart || mConnectSockets[i].Get() != INVALID_SOCKET)
+            {
+                next = (std::min)(next, mNextAttempts[i]);
+            }
+        }
+
+        return next;
+    }
+
+    bool LivenessProber::SetNonBlocking(_In_ const SOCKET socket) noexcept
+    {
+#ifdef _WIN32
+        u_long nonBlocking = 1U;
+        return ::ioctlsocket(socket, FIONBIO, &nonBlocking) == 0;
+#else
+        const int flags = ::fcntl(socket, F_GETFL, 0);
+        return flags != -1 && ::fcntl(socket, F_SETFL, flags | O_NONBLOCK) != -1;
+#endif
+    }
+
+    std::uint16_t LivenessProber::ComputeInternetChecksum(_In_reads_(size) const std::uint8_t* const data,
+                                                          _In_ const std::size_t size) noexcept
+    {
+        // 16비트 단위(네트워크 바이트 순서)의 1의 보수 합
+        std::uint32_t sum = 0U;
+        for (std::size_t i = 0U; i + 1U < size; i += 2U)
+        {
+            sum += (static_cast<std::uint32_t>(data[i]) << 8U) | data[i + 1U];
+        }
+
+        if ((size & 1U) != 0U)
+        {
+            sum += static_cast<std::uint32_t>(data[size - 1U]) << 8U;
+        }
+
+        while ((sum >> 16U) != 0U)
+        {
+            sum = (sum & 0xFFFFU) + (sum >> 16U);
+        }
+
+        return htons(static_cast<std::uint16_t>(~sum & 0xFFFFU));
+    }
+
+    std::uint64_t LivenessProber::ToKey(_In_ const MacAddress& macAddress) noexcept
+    {
+        std::uint64_t key = 0U;
+        for (const std::byte byte : macAddress)
+        {
+            key = (key << 8U) | std::to_integer<std::uint64_t>(byte);
+        }
+
+        return key;
+    }
+
+    void TimerWheel::Schedule(_In_ const std::size_t index, _In_ const Clock::time_point expiry)
+    {
+        // 이미 처리한 틱의 슬롯에 넣으면 한 바퀴 늦게 만료되므로 다음 틱으로 당김
+        const std::uint64_t tick = (std::max)(ToTick(expiry), mCurrentTick + 1U);
+        mSlots[tick & (SLOT_COUNT - 1U)].push_back({tick, index});
+        ++mCount;
+    }
+
+    void TimerWheel::Advance(_In_ const Clock::time_point now, _Inout_ std::vector<std::size_t>& expired)
+    {
+        // now 이전의 틱까지만 처리 (ToTick()은 올림이므로 now가 속한 틱은 아직 끝나지 않음)
+        const auto elapsed = now > mOrigin ? now - mOrigin : Clock::duration::zero();
+        const std::uint64_t nowTick = static_cast<std::uint64_t>(elapsed / TICK);
+        if (nowTick <= mCurrentTick)
+        {
+            return;
+        }
+
+        // 한 바퀴 이상 지났다면 모든 슬롯을 한 번씩만 확인하면 됨
+        const std::uint64_t steps = (std::min)(nowTick - mCurrentTick, std::uint64_t{SLOT_COUNT});
+        for (std::uint64_t step = 1U; step <= steps; ++step)
+        {
+            std::vector<Entry>& slot = mSlots[(nowTick - steps + step) & (SLOT_COUNT - 1U)];
+            const auto remaining = std::remove_if(slot.begin(), slot.end(), [&](const Entry& entry)
+            {
+                if (entry.mExpiryTick > nowTick)
+                    return false;
+
+                expired.push_back(entry.mIndex);
+                return true;
+            });
+
+            mCount -= static_cast<std::size_t>(slot.end() - remaining);
+            slot.erase(remaining, slot.end());
+        }
+
+        mCurrentTick = nowTick;
+    }
+
+    TimerWheel::Clock::time_point TimerWheel::GetNextExpiry() const noexcept
+    {
+        if (mCount == 0U)
+        {
+            return Clock::time_point::max();
+        }
+
+        // 이번 바퀴에서 만료될 항목이 있는 가장 가까운 슬롯
+        for (std::uint64_t tick = mCurrentTick + 1U; tick <= mCurrentTick + SLOT_COUNT; ++tick)
+        {
+            const std::vector<Entry>& slot = mSlots[tick & (SLOT_COUNT - 1U)];
+            const bool due = std::any_of(slot.begin(), slot.end(), [tick](const Entry& entry)
+            {
+                return entry.mExpiryTick == tick;
+            });
+
+            if (due)
+            {
+                return mOrigin + (TICK * tick);
+            }
+        }
+
+        return mOrigin + (TICK * (mCurrentTick + SLOT_COUNT));
+    }
+
+    std::uint64_t TimerWheel::ToTick(_In_ const Clock::time_point time) const noexcept
+    {
+        if (time <= mOrigin)
+        {
+            return 0U;
+        }
+
+        return static_cast<std::uint64_t>((time - mOrigin + TICK - Clock::duration{1}) / TICK);
+    }
+
+    WolErrorCode RetryScheduler::Start(_In_ const std::size_t count, _In_ const RetryPolicy& policy,
+                                       _In_ const Clock::time_point now) noexcept
+    {
+        assert(policy.mMultiplier >= 1.0 && policy.mJitter >= 0.0 && policy.mJitter <= 1.0);
+
+        try
+        {
+            mPolicy = policy;
+            mWheel = std::make_unique<TimerWheel>(now);
+            mAttempts.assign(count, 1U);
+            mCancelled.assign(count, 0U);
+            mExpired.clear();
+            mExpired.reserve(count);
+
+            if (policy.mMaxAttempts > 1U)
+            {
+                for (std::size_t i = 0U; i < count; ++i)
+                {
+                    mWheel->Schedule(i, now + GetInterval(1U));
+                }
+            }
+
+            return WolErrorCode::Success;
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"재전송 일정을 준비하는 중 오류가 발생했습니다.\n");
+            mWheel.reset();
+            mAttempts.clear();
+            mCancelled.clear();
+            return WolErrorCode::UnexpectedException;
+        }
+    }
+
+    WolErrorCode RetryScheduler::Collect(_In_ const Clock::time_point now, _Out_ std::vector<std::size_t>& due) noexcept
+    {
+        due.clear();
+        if (mWheel == nullptr)
+        {
+            return WolErrorCode::Success;
+        }
+
+        try
+        {
+            mExpired.clear();
+            mWheel->Advance(now, mExpired);
+
+            for (const std::size_t index : mExpired)
+            {
+                if (mCancelled[index] != 0U)
+                    continue;
+
+                ++mAttempts[index];
+                due.push_back(index);
+
+                if (mAttempts[index] < mPolicy.mMaxAttempts)
+                {
+                    mWheel->Schedule(index, now + GetInterval(mAttempts[index]));
+                }
+            }
+
+            return WolErrorCode::Success;
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"재전송 일정을 갱신하는 중 오류가 발생했습니다.\n");
+            return WolErrorCode::UnexpectedException;
+        }
+    }
+
+    RetryScheduler::Clock::duration RetryScheduler::GetInterval(_In_ const std::uint32_t attempts) noexcept
+    {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        // 지수 증가 (상한 적용)
+        double interval = static_cast<double>(mPolicy.mInitialInterval.count());
+        for (std::uint32_t i = 1U; i < attempts && interval < static_cast<double>(mPolicy.mMaxInterval.count()); ++i)
+        {
+            interval *= mPolicy.mMultiplier;
+        }
+
+        interval = (std::min)(interval, static_cast<double>(mPolicy.mMaxInterval.count()));
+
+        // ±mJitter 범위의 균등 분포
+        if (mPolicy.mJitter > 0.0)
+        {
+            std::uniform_real_distribution<double> distribution{1.0 - mPolicy.mJitter, 1.0 + mPolicy.mJitter};
+            interval *= distribution(mRandom);
+        }
+
+        return std::chrono::duration_cast<Clock::duration>(Milliseconds{interval});
+    }
+
+    WolErrorCode GetControlSocketAddress(_In_ const WolConfig& config,
+                                         _Out_ std::filesystem::path& path,
+                                         _Out_ sockaddr_un& address) noexcept
+    {
+        path.clear();
+        address = {};
+
+        std::wstring configFilePath{};
+        const WolErrorCode errorCode = config.GetConfigFilePath(configFilePath);
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        try
+        {
+            path = std::filesystem::path{configFilePath}.replace_filename(CONTROL_SOCKET_FILE_NAME);
+
+            const std::string narrowPath = path.string();
+            if (narrowPath.length() >= sizeof(address.sun_path))
+            {
+                std::ignore = ::fwprintf(stderr, L"제어 소켓 경로가 너무 깁니다 (최대 %zu바이트): %ls\n",
+                                         sizeof(address.sun_path) - 1U, path.wstring().c_str());
+                return WolErrorCode::ControlSocketFailed;
+            }
+
+            address.sun_family = AF_UNIX;
+            std::memcpy(address.sun_path, narrowPath.c_str(), narrowPath.length() + 1U);
+            return WolErrorCode::Success;
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"제어 소켓 경로를 만드는 중 오류가 발생했습니다.\n");
+            return WolErrorCode::UnexpectedException;
+        }
+    }
+
+    WolErrorCode WakeOnLanAsyncSender::Open() noexcept
+    {
+        if (IsOpen())
+            return WolErrorCode::Success;
+
+        WolErrorCode wolErrorCode = mWsaGuard.Initialize();
+        if (wolErrorCode != WolErrorCode::Success)
+        {
+            return wolErrorCode;
+        }
+
+        wolErrorCode = mSession.Open();
+        if (wolErrorCode != WolErrorCode::Success)
+        {
+            return wolErrorCode;
+        }
+
+        // 완료 알림용 루프백 UDP 소켓 쌍 (Windows의 WSAPoll()/select()도 감시할 수 있도록 이벤트 객체 대신 소켓 사용)
+        Socket receiver{::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP)};
+        Socket sender{::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP)};
+        if (receiver.Get() == INVALID_SOCKET || sender.Get() == INVALID_SOCKET)
+        {
+            std::ignore = ::fwprintf(stderr, L"완료 알림 소켓을 만들 수 없습니다: %d (WSALastError)\n", WSAGetLastError());
+            return WolErrorCode::SocketCreationFailed;
+        }
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t addressLength = sizeof(address);
+        if (::bind(receiver.Get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR
+            || ::getsockname(receiver.Get(), reinterpret_cast<sockaddr*>(&address), &addressLength) == SOCKET_ERROR
+            || ::connect(sender.Get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR
+            || LivenessProber::SetNonBlocking(receiver.Get()) == false || LivenessProber::SetNonBlocking(sender.Get()) == false)
+        {
+            std::ignore = ::fwprintf(stderr, L"완료 알림 소켓을 준비할 수 없습니다: %d (WSALastError)\n", WSAGetLastError());
+            return WolErrorCode::SocketCreationFailed;
+        }
+
+        // 내부 스레드가 알림을 보낼 수 있도록 스레드를 시작하기 전에 보관
+        mNotifyReceiver.Set(receiver.Release());
+        mNotifySender.Set(sender.Release());
+        mStopRequested = false;
+        try
+        {
+            mWorker = std::thread{&WakeOnLanAsyncSender::Run, this};
+        }
+        catch (const std::system_error&)
+        {
+            std::ignore = ::fwprintf(stderr, L"비동기 전송 스레드를 시작할 수 없습니다.\n");
+            return WolErrorCode::UnexpectedException;
+        }
+
+        return WolErrorCode::Success;
+    }
+
+    void WakeOnLanAsyncSender::Close() noexcept
+    {
+        if (IsOpen() == false)
+            return;
+
+        {
+            const std::lock_guard<std::mutex> lock{mRequestMutex};
+            mStopRequested = true;
+        }
+        mRequestCondition.notify_one();
+        mWorker.join();
+
+        // 알림 소켓은 다시 Open()하거나 소멸될 때 닫힘
+        std::ignore = DispatchCompletions();
+    }
+
+    WolErrorCode WakeOnLanAsyncSender::Wake(_In_ const WolTarget& target, _In_ const bool verify,
+                                            _In_ Completion completion) noexcept
+    {
+        // 완료 콜백을 호출하기 전에 줄어들지 않도록 대기열에 넣기 전에 셈
+        mPendingCount.fetch_add(1U, std::memory_order_relaxed);
+        try
+        {
+            const std::lock_guard<std::mutex> lock{mRequestMutex};
+
+            // 멈춘 내부 스레드는 요청을 꺼내지 않으므로 대기열에 넣지 않고 호출자에게 알림 (콜백은 호출되지 않음)
+            if (mStopRequested)
+            {
+                mPendingCount.fetch_sub(1U, std::memory_order_relaxed);
+                return WolErrorCode::InvalidArgument;
+            }
+
+            mRequests.push_back({target, verify, std::move(completion), Clock::now()});
+        }
+        catch (...)
+        {
+            mPendingCount.fetch_sub(1U, std::memory_order_relaxed);
+            std::ignore = ::fwprintf(stderr, L"전송 요청을 대기열에 넣는 중 오류가 발생했습니다.\n");
+            return WolErrorCode::UnexpectedException;
+        }
+
+        mRequestCondition.notify_one();
+
+        return WolErrorCode::Success;
+    }
+
+    std::size_t WakeOnLanAsyncSender::DispatchCompletions() noexcept
+    {
+        // 알림을 먼저 비운 뒤 완료 목록을 가져옴 (그 사이에 추가된 완료는 새 알림으로 다시 깨어남)
+        std::array<char, 64U> drain{};
+        while (::recv(mNotifyReceiver.Get(), drain.data(), static_cast<int>(drain.size()), 0) > 0)
+        {
+        }
+
+        std::vector<Completed> completed{};
+        {
+            const std::lock_guard<std::mutex> lock{mCompletionMutex};
+            completed.swap(mCompleted);
+        }
+
+        for (Completed& item : completed)
+        {
+            mPendingCount.fetch_sub(1U, std::memory_order_relaxed);
+            try
+            {
+                if (item.mCompletion)
+                    item.mCompletion(item.mResult);
+            }
+            catch (...)
+            {
+                std::ignore = ::fwprintf(stderr, L"완료 콜백에서 예외가 발생했습니다.\n");
+            }
+        }
+
+        return completed.size();
+    }
+
+    void WakeOnLanAsyncSender::Run() noexcept
+    {
+        std::vector<Request> requests{};
+        for (;;)
+        {
+            bool stopping = false;
+            {
+                // 확인 중인 요청이 있으면 응답을 확인할 수 있도록 주기적으로 깨어남
+                std::unique_lock<std::mutex> lock{mRequestMutex};
+                const auto ready = [this]() { return mStopRequested || mRequests.empty() == false; };
+                if (mVerifications.empty())
+                    mRequestCondition.wait(lock, ready);
+                else
+                    std::ignore = mRequestCondition.wait_for(lock, VERIFY_POLL_INTERVAL, ready);
+
+                requests.swap(mRequests);
+                stopping = mStopRequested;
+            }
+
+            try
+            {
+                if (requests.empty() == false)
+                    SendRequests(requests);
+
+                PollVerifications(stopping);
+                FlushCompletions();
+            }
+            catch (...)
+            {
+                std::ignore = ::fwprintf(stderr, L"비동기 전송 요청을 처리하는 중 오류가 발생했습니다.\n");
+                CompleteFailedRequests(requests, stopping);
+            }
+
+            requests.clear();
+            if (stopping)
+                break;
+        }
+    }
+
+    void WakeOnLanAsyncSender::CompleteFailedRequests(_Inout_ std::vector<Request>& requests,
+                                                      _In_ const bool stopping) noexcept
+    {
+        // 받아들인 Wake() 요청은 모두 콜백을 한 번 받아야 하므로 아직 넘기지 못한 요청을 오류로 완료
+        const Clock::time_point failedTime = Clock::now();
+        for (Request& request : requests)
+        {
+            if (request.mHandedOver)
+                continue;
+
+            try
+            {
+                Complete(request, {WolErrorCode::UnexpectedException, std::nullopt, 0U,
+                                   std::chrono::duration_cast<std::chrono::microseconds>(failedTime - request.mQueuedTime)});
+            }
+            catch (...)
+            {
+                // 완료 목록에도 넣을 수 없으면 콜백 없이 대기 수만 줄임 (GetPendingCount()를 기다리는 루프가 멈추지 않도록)
+                mPendingCount.fetch_sub(1U, std::memory_order_relaxed);
+            }
+        }
+
+        try
+        {
+            FlushCompletions();
+        }
+        catch (...)
+        {
+            // 멈추지 않는다면 완료 목록에 남겨 다음 반복에서 다시 넘기고, 멈추는 중이면 넘길 기회가 없으므로 대기 수만 줄임
+            if (stopping)
+            {
+                mPendingCount.fetch_sub(mLocalCompleted.size(), std::memory_order_relaxed);
+                mLocalCompleted.clear();
+            }
+        }
+    }
+
+    void WakeOnLanAsyncSender::SendRequests(_Inout_ std::vector<Request>& requests)
+    {
+        // 모인 요청을 한 번에 전송 (랙별 속도 제한 등 세션 설정도 요청 전체에 적용)
+        const WakeOnLanSender sender{};
+        std::vector<WolPacket> packets(requests.size());
+        for (std::size_t i = 0U; i < requests.size(); ++i)
+        {
+            sender.PreparePacket(mSession, requests[i].mTarget, packets[i]);
+        }
+
+        std::vector<WolErrorCode> results{};
+        const WolErrorCode batchResult = mSession.SendBatch(packets, results);
+        if (batchResult != WolErrorCode::Success)
+            results.assign(requests.size(), batchResult);
+
+        // LivenessProber와 RetryScheduler는 옮길 수 없으므로 목록에 먼저 만들고, 확인할 요청이 없으면 제거
+        const Clock::time_point sentTime = Clock::now();
+        Verification& verification = mVerifications.emplace_back();
+        for (std::size_t i = 0U; i < requests.size(); ++i)
+        {
+            Request& request = requests[i];
+            if (results[i] != WolErrorCode::Success || request.mVerify == false)
+            {
+                Complete(request, {results[i], std::nullopt, 1U, std::chrono::duration_cast<std::chrono::microseconds>(sentTime - request.mQueuedTime)});
+                continue;
+            }
+
+            verification.mRequests.push_back(std::move(request));
+            request.mHandedOver = true;
+            verification.mPackets.push_back(packets[i]);
+        }
+
+        if (verification.mRequests.empty())
+        {
+            mVerifications.pop_back();
+            return;
+        }
+
+        // 확인할 요청들을 같은 LivenessProber로 확인
+        std::vector<ProbeTarget> probeTargets{};
+        probeTargets.reserve(verification.mRequests.size());
+        for (const Request& request : verification.mRequests)
+        {
+            const WolTarget& target = request.mTarget;
+            probeTargets.push_back({target.mMacBytes, target.mHostAddr.s_addr,
+                                    target.mProbePort != 0U ? target.mProbePort : mVerifyOptions.mDefaultPort});
+        }
+
+        verification.mCompleted.assign(verification.mRequests.size(), 0U);
+        verification.mRemaining = verification.mRequests.size();
+        verification.mDeadline = sentTime + mVerifyOptions.mTimeout;
+        verification.mProber.SetSendBackend(mSession.GetActiveSendBackend());
+
+        WolErrorCode errorCode = verification.mProber.Open(mVerifyOptions.mMethod);
+        if (errorCode == WolErrorCode::Success)
+            errorCode = verification.mProber.Start(probeTargets);
+        if (errorCode == WolErrorCode::Success)
+            errorCode = verification.mScheduler.Start(verification.mRequests.size(), mVerifyOptions.mRetryPolicy, sentTime);
+        verification.mScheduled = errorCode == WolErrorCode::Success;
+
+        // 확인을 시작하지 못했거나 확인할 수 없는 대상(IP 주소가 없는 경우 등)은 바로 완료
+        for (std::size_t i = 0U; i < verification.mRequests.size(); ++i)
+        {
+            if (errorCode != WolErrorCode::Success)
+            {
+                CompleteVerification(verification, i, errorCode);
+                continue;
+            }
+
+            const WolErrorCode probeResult = verification.mProber.GetResult(i).mResult;
+            if (probeResult != WolErrorCode::HostNotResponding && probeResult != WolErrorCode::Success)
+            {
+                verification.mScheduler.Cancel(i);
+                CompleteVerification(verification, i, probeResult);
+            }
+        }
+
+        if (verification.mRemaining == 0U)
+            mVerifications.pop_back();
+    }
+
+    void WakeOnLanAsyncSender::PollVerifications(_In_ const bool stopping)
+    {
+        std::vector<std::size_t> alive{};
+        std::vector<std::size_t> due{};
+        std::vector<WolPacket> retryPackets{};
+        std::vector<WolErrorCode> sendResults{};
+        for (auto it = mVerifications.begin(); it != mVerifications.end();)
+        {
+            Verification& verification = *it;
+
+            // 기다리지 않고 시기가 된 확인 요청을 보내고 도착한 응답을 반영
+            WolErrorCode errorCode = verification.mProber.Poll(std::chrono::milliseconds::zero(), alive);
+            for (const std::size_t index : alive)
+            {
+                verification.mScheduler.Cancel(index);
+                CompleteVerification(verification, index, WolErrorCode::Success);
+            }
+
+            const Clock::time_point now = Clock::now();
+            if (errorCode == WolErrorCode::Success && stopping == false && now < verification.mDeadline)
+            {
+                errorCode = verification.mScheduler.Collect(now, due);
+                retryPackets.clear();
+                for (const std::size_t index : due)
+                {
+                    if (verification.mCompleted[index] == 0U)
+                        retryPackets.push_back(verification.mPackets[index]);
+                }
+
+                // 재전송 실패는 다음 재전송이나 응답 확인 결과에 맡김
+                if (retryPackets.empty() == false)
+                    std::ignore = mSession.SendBatch(retryPackets, sendResults);
+            }
+
+            // 제한 시간이 지났거나 멈추는 중이면 남은 요청을 완료
+            if (errorCode != WolErrorCode::Success || stopping || now >= verification.mDeadline)
+            {
+                const WolErrorCode result = errorCode != WolErrorCode::Success ? errorCode : WolErrorCode::HostNotResponding;
+                for (std::size_t i = 0U; i < verification.mRequests.size(); ++i)
+                {
+                    if (verification.mCompleted[i] == 0U)
+                        CompleteVerification(verification, i, result);
+                }
+            }
+
+            it = verification.mRemaining == 0U ? mVerifications.erase(it) : std::next(it);
+        }
+    }
+
+    void WakeOnLanAsyncSender::CompleteVerification(_Inout_ Verification& verification, _In_ const std::size_t index,
+                                                    _In_ const WolErrorCode result)
+    {
+        assert(verification.mCompleted[index] == 0U);
+
+        Request& request = verification.mRequests[index];
+        AsyncWakeResult wakeResult{result, std::nullopt, verification.mScheduled ? verification.mScheduler.GetAttempts(index) : 1U,
+                                   std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - request.mQueuedTime)};
+        if (result == WolErrorCode::Success)
+            wakeResult.mTimeToAlive = verification.mProber.GetResult(index).mTimeToAlive;
+
+        verification.mCompleted[index] = 1U;
+        --verification.mRemaining;
+        Complete(request, wakeResult);
+    }
+
+    void WakeOnLanAsyncSender::Complete(_Inout_ Request& request, _In_ const AsyncWakeResult& result)
+    {
+        mLocalCompleted.push_back({result, std::move(request.mCompletion)});
+        request.mHandedOver = true;
+    }
+
+    void WakeOnLanAsyncSender::FlushCompletions()
+    {
+        if (mLocalCompleted.empty())
+            return;
+
+        bool wasEmpty = false;
+        {
+            const std::lock_guard<std::mutex> lock{mCompletionMutex};
+            wasEmpty = mCompleted.empty();
+            if (wasEmpty)
+            {
+                mCompleted.swap(mLocalCompleted);
+            }
+            else
+            {
+                std::move(mLocalCompleted.begin(), mLocalCompleted.end(), std::back_inserter(mCompleted));
+            }
+        }
+        mLocalCompleted.clear();
+
+        // 완료 목록이 비어 있었을 때만 알림 (이벤트 루프가 이미 깨어날 예정이면 보내지 않음)
+        if (wasEmpty)
+        {
+            constexpr char notification = 1;
+            std::ignore = ::send(mNotifySender.Get(), &notification, 1, 0);
+        }
+    }
+
+    WakeOnLanDaemon::~WakeOnLanDaemon() noexcept
+    {
+        // 오류로 Run()이 끝난 경우에도 전송 스레드가 멤버를 사용하지 않도록 먼저 종료
+        StopWakeWorker();
+
+        if (mSocketPath.empty() == false)
+        {
+            // 소켓을 먼저 닫은 뒤 파일을 삭제
+            if (const SOCKET listenSocket = mListenSocket.Release(); listenSocket != INVALID_SOCKET)
+            {
+                std::ignore = closesocket(listenSocket);
+            }
+
+            std::error_code errorCode{};
+            std::ignore = std::filesystem::remove(mSocketPath, errorCode);
+        }
+    }
+
+    WolErrorCode WakeOnLanDaemon::Run() noexcept
+    {
+        WolErrorCode errorCode = mConfig.LoadFromIni();
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        errorCode = mSession.Open();
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        errorCode = OpenControlSocket();
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        // 세션의 첫 상태를 기록한 뒤 전송 스레드를 시작 (이후에는 전송 스레드만 세션을 사용)
+        try
+        {
+            UpdateSessionStatus();
+            mWakeWorker = std::thread{&WakeOnLanDaemon::RunWakeWorker, this};
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"전송 스레드를 시작할 수 없습니다.\n");
+            return WolErrorCode::UnexpectedException;
+        }
+
+        std::ignore = ::fwprintf(stdout, L"Wake-on-LAN 서비스를 시작했습니다. (대상 수: %zu, 제어 소켓: %ls)\n",
+                                 mConfig.GetTargets().size(), mSocketPath.wstring().c_str());
+        std::ignore = std::fflush(stdout);
+
+        auto lastCheck = std::chrono::steady_clock::now();
+        while (sStopRequested == 0 && mShutdownRequested == false)
+        {
+            const SOCKET listenSocket = mListenSocket.Get();
+            fd_set readSet{};
+            FD_ZERO(&readSet);
+            FD_SET(listenSocket, &readSet);
+
+            timeval timeout{};
+            timeout.tv_sec = static_cast<long>(std::chrono::duration_cast<std::chrono::seconds>(POLL_INTERVAL).count());
+
+            // WinSock에서는 첫 번째 인자를 무시함
+            const int ready = ::select(static_cast<int>(listenSocket + 1), &readSet, nullptr, nullptr, &timeout);
+            if (ready == SOCKET_ERROR)
+            {
+                // 시그널로 대기가 중단된 경우
+                if (WSAGetLastError() == EINTR)
+                    continue;
+
+                std::ignore = ::fwprintf(stderr, L"제어 소켓 대기 중 오류가 발생했습니다. (오류 코드: %d)\n", WSAGetLastError());
+                return WolErrorCode::ControlSocketFailed;
+            }
+
+            if (ready > 0)
+            {
+                Socket client(::accept(listenSocket, nullptr, nullptr));
+                if (client.Get() != INVALID_SOCKET)
+                {
+                    HandleConnection(client);
+                }
+            }
+
+            // 명령이 계속 들어오는 경우에도 주기적으로 설정 파일 변경을 확인
+            if (const auto now = std::chrono::steady_clock::now(); now - lastCheck >= POLL_INTERVAL)
+            {
+                lastCheck = now;
+                if (mConfig.IsModified())
+                {
+                    try
+                    {
+                        std::string response{};
+                        ReloadConfig(response);
+                    }
+                    catch (...)
+                    {
+                        std::ignore = ::fwprintf(stderr, L"설정 파일을 다시 읽는 중 오류가 발생했습니다.\n");
+                    }
+                }
+            }
+        }
+
+        // 이미 받은 wake 요청은 모두 처리한 뒤 종료
+        StopWakeWorker();
+
+        std::ignore = ::fwprintf(stdout, L"Wake-on-LAN 서비스를 종료합니다.\n");
+        return WolErrorCode::Success;
+    }
+
+    WolErrorCode WakeOnLanDaemon::OpenControlSocket() noexcept
+    {
+        std::filesystem::path socketPath{};
+        sockaddr_un address{};
+        WolErrorCode errorCode = GetControlSocketAddress(mConfig, socketPath, address);
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        Socket socket(::socket(AF_UNIX, SOCK_STREAM, 0));
+        if (socket.Get() == INVALID_SOCKET)
+        {
+            std::ignore = ::fwprintf(stderr, L"제어 소켓을 생성할 수 없습니다. (오류 코드: %d)\n", WSAGetLastError());
+            return WolErrorCode::ControlSocketFailed;
+        }
+
+        std::error_code fileError{};
+        if (std::filesystem::exists(socketPath, fileError))
+        {
+            // 응답하는 서비스가 있다면 그대로 두고, 없다면 비정상 종료로 남은 파일이므로 삭제
+            if (const Socket probe(::socket(AF_UNIX, SOCK_STREAM, 0));
+                probe.Get() != INVALID_SOCKET
+                && ::connect(probe.Get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0)
+            {
+                std::ignore = ::fwprintf(stderr, L"Wake-on-LAN 서비스가 이미 실행 중입니다: %ls\n", socketPath.wstring().c_str());
+                return WolErrorCode::DaemonAlreadyRunning;
+            }
+
+            std::ignore = std::filesystem::remove(socketPath, fileError);
+        }
+
+#ifdef _WIN32
+        const int bindResult = ::bind(socket.Get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+#else
+        // 소켓 파일을 소유자만 접근할 수 있도록 생성 (다른 사용자가 대상 장치를 깨우지 못하도록 함)
+        const mode_t previousMask = ::umask(0177);
+        const int bindResult = ::bind(socket.Get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+        std::ignore = ::umask(previousMask);
+#endif
+        if (bindResult == SOCKET_ERROR)
+        {
+            std::ignore = ::fwprintf(stderr, L"제어 소켓을 바인드할 수 없습니다. (오류 코드: %d): %ls\n", WSAGetLastError(),
+                                     socketPath.wstring().c_str());
+            return WolErrorCode::ControlSocketFailed;
+        }
+
+        // 이후 실패하더라도 생성한 소켓 파일은 소멸자에서 삭제
+        mSocketPath = std::move(socketPath);
+
+        if (::listen(socket.Get(), SOMAXCONN) == SOCKET_ERROR)
+        {
+            std::ignore = ::fwprintf(stderr, L"제어 소켓에서 연결을 기다릴 수 없습니다. (오류 코드: %d)\n", WSAGetLastError());
+            return WolErrorCode::ControlSocketFailed;
+        }
+
+        mListenSocket.Set(socket.Release());
+        return WolErrorCode::Success;
+    }
+
+    void WakeOnLanDaemon::HandleConnection(_Inout_ Socket& client) noexcept
+    {
+        // 요청을 보내지 않는 클라이언트에서 무한히 기다리지 않도록 수신 제한 시간 설정
+#ifdef _WIN32
+        const DWORD timeout = static_cast<DWORD>(REQUEST_TIMEOUT.count());
+#else
+        timeval timeout{};
+        timeout.tv_sec = static_cast<decltype(timeout.tv_sec)>(REQUEST_TIMEOUT.count() / 1000);
+        timeout.tv_usec = static_cast<decltype(timeout.tv_usec)>((REQUEST_TIMEOUT.count() % 1000) * 1000);
+#endif
+        std::ignore = ::setsockopt(client.Get(), SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+
+        try
+        {
+            std::string request{};
+            std::array<char, 512U> buffer{};
+            while (request.find('\n') == std::string::npos && request.length() < MAX_REQUEST_LENGTH)
+            {
+                const int received = ::recv(client.Get(), buffer.data(), static_cast<int>(buffer.size()), 0);
+                if (received <= 0)
+                    break;
+
+                request.append(buffer.data(), static_cast<std::size_t>(received));
+            }
+
+            std::string_view command{request};
+            command = command.substr(0U, command.find('\n'));
+            if (command.empty() == false && command.back() == '\r')
+                command.remove_suffix(1U);
+
+            // 전송은 전송 스레드에서 처리하고 응답도 전송 스레드가 보냄 (이 스레드는 다음 연결을 바로 받음)
+            if (IsWakeCommand(command))
+            {
+                WakeRequest wakeRequest{std::make_unique<Socket>(), std::string{command}};
+                wakeRequest.mClient->Set(client.Release());
+                {
+                    const std::lock_guard<std::mutex> lock{mWakeMutex};
+                    mWakeRequests.push_back(std::move(wakeRequest));
+                    ++mPendingWakeCount;
+                }
+                mWakeCondition.notify_one();
+                return;
+            }
+
+            std::string response{};
+            ExecuteCommand(command, response);
+            SendResponse(client.Get(), response);
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"제어 명령을 처리하는 중 오류가 발생했습니다.\n");
+        }
+    }
+
+    void WakeOnLanDaemon::SendResponse(_In_ const SOCKET client, _In_ const std::string_view response) noexcept
+    {
+#ifdef _WIN32
+        constexpr int sendFlags = 0;
+#else
+        // 클라이언트가 먼저 연결을 끊어도 SIGPIPE로 서비스가 종료되지 않도록 함
+        constexpr int sendFlags = MSG_NOSIGNAL;
+#endif
+        std::size_t sent = 0U;
+        while (sent < response.length())
+        {
+            const int result = ::send(client, response.data() + sent, static_cast<int>(response.length() - sent), sendFlags);
+            if (result <= 0)
+                break;
+
+            sent += static_cast<std::size_t>(result);
+        }
+    }
+
+    bool WakeOnLanDaemon::IsWakeCommand(_In_ const std::string_view command) noexcept
+    {
+        // ExecuteCommand()와 같은 방식으로 명령과 인자를 나눔
+        const std::size_t separator = command.find(' ');
+        const std::string_view verb = command.substr(0U, separator);
+        const std::string_view argument = separator == std::string_view::npos ? std::string_view{} : command.substr(separator + 1U);
+
+        return (verb == "wake" && argument.empty() == false) || (verb == "wake-all" && argument.empty());
+    }
+
+    void WakeOnLanDaemon::RunWakeWorker() noexcept
+    {
+        bool stopping = false;
+        while (stopping == false)
+        {
+            {
+                std::unique_lock<std::mutex> lock{mWakeMutex};
+                mWakeCondition.wait(lock, [this] { return mWakeRequests.empty() == false || mWakeStopRequested; });
+
+                // 종료 요청 전에 받은 요청은 이번에 모두 가져오므로 처리한 뒤 끝냄 (종료 요청 후에는 요청을 받지 않음)
+                mActiveWakeRequests.swap(mWakeRequests);
+                stopping = mWakeStopRequested;
+            }
+
+            for (WakeRequest& request : mActiveWakeRequests)
+            {
+                try
+                {
+                    std::string response{};
+                    ExecuteWakeCommand(request.mCommand, response);
+                    SendResponse(request.mClient->Get(), response);
+                    UpdateSessionStatus();
+                }
+                catch (...)
+                {
+                    std::ignore = ::fwprintf(stderr, L"제어 명령을 처리하는 중 오류가 발생했습니다.\n");
+                }
+
+                // 응답을 보낸 뒤 연결을 닫음
+                request.mClient.reset();
+
+                const std::lock_guard<std::mutex> lock{mWakeMutex};
+                --mPendingWakeCount;
+            }
+
+            mActiveWakeRequests.clear();
+        }
+    }
+
+    void WakeOnLanDaemon::StopWakeWorker() noexcept
+    {
+        if (mWakeWorker.joinable() == false)
+            return;
+
+        {
+            const std::lock_guard<std::mutex> lock{mWakeMutex};
+            mWakeStopRequested = true;
+        }
+        mWakeCondition.notify_one();
+        mWakeWorker.join();
+    }
+
+    void WakeOnLanDaemon::ExecuteWakeCommand(_In_ const std::string_view command, _Out_ std::string& response)
+    {
+        response.clear();
+
+        const std::size_t separator = command.find(' ');
+        if (command.substr(0U, separator) == "wake-all")
+        {
+            WakeAllTargets(response);
+        }
+        else
+        {
+            WakeTarget(command.substr(separator + 1U), response);
+        }
+    }
+
+    void WakeOnLanDaemon::UpdateSessionStatus()
+    {
+        const MagicPacketCache& cache = mSession.GetPacketCache();
+        const PacingStats& pacing = mSession.GetPacingStats();
+
+        std::array<wchar_t, 416U> status{};
+        const int length = std::swprintf(status.data(), status.size(), L"backend=%ls cache-hits=%llu cache-misses=%llu",
+                                         SendBackendToName(mSession.GetActiveSendBackend()).data(),
+                                         static_cast<unsigned long long>(cache.GetHitCount()),
+                                         static_cast<unsigned long long>(cache.GetMissCount()));
+
+        // 속도를 제한하는 경우 제한 값을 조정할 수 있도록 통계를 덧붙임
+        if (mSession.GetPacing().IsEnabled() && length > 0)
+        {
+            std::ignore = std::swprintf(status.data() + length, status.size() - static_cast<std::size_t>(length),
+                                        L" paced-packets=%llu bursts=%llu largest-burst=%llu waits=%llu wait-ms=%llu "
+                                        L"packet-limit-hits=%llu rack-deferrals=%llu",
+                                        static_cast<unsigned long long>(pacing.mPacketsSent),
+                                        static_cast<unsigned long long>(pacing.mBursts),
+                                        static_cast<unsigned long long>(pacing.mLargestBurst),
+                                        static_cast<unsigned long long>(pacing.mWaits),
+                                        static_cast<unsigned long long>(pacing.mWaitTime.count() / 1000),
+                                        static_cast<unsigned long long>(pacing.mPacketLimitHits),
+                                        static_cast<unsigned long long>(pacing.mRackDeferrals));
+        }
+
+        // 인터페이스를 지정했다면 인터페이스별 "interface=이름/주소:전송/실패/오류 이름"을 덧붙임
+        std::wstring statusText{status.data()};
+        for (const InterfaceSendStats& stats : mSession.GetInterfaceStats())
+        {
+            std::array<wchar_t, 16U> addressText{};
+            FormatIpv4Address(stats.mInterface.mAddress, addressText);
+            statusText += L" interface=" + stats.mInterface.mName + L'/' + addressText.data() + L':'
+                + std::to_wstring(stats.mPacketsSent) + L'/' + std::to_wstring(stats.mSendErrors) + L'/'
+                + WolErrorCodeToName(stats.GetResult());
+        }
+
+        // 전송 스레드가 여러 개라면 스레드별 "worker=번호:전송/실패/가져온 묶음/초당 패킷 수/p99 지연(µs)"을 덧붙임
+        const std::vector<SendWorkerStats>& workerStats = mSession.GetWorkerStats();
+        for (std::size_t i = 0U; workerStats.size() > 1U && i < workerStats.size(); ++i)
+        {
+            const SendWorkerStats& stats = workerStats[i];
+            statusText += L" worker=" + std::to_wstring(i) + L':' + std::to_wstring(stats.mPacketsSent) + L'/'
+                + std::to_wstring(stats.mSendErrors) + L'/' + std::to_wstring(stats.mStolenChunks) + L'/'
+                + std::to_wstring(static_cast<std::uint64_t>(stats.GetPacketsPerSecond())) + L'/'
+                + std::to_wstring(stats.mLatency.GetPercentile(99.0).count());
+        }
+
+        const std::lock_guard<std::mutex> lock{mWakeMutex};
+        mSessionStatus.swap(statusText);
+    }
+
+    void WakeOnLanDaemon::ExecuteCommand(_In_ const std::string_view command, _Out_ std::string& response)
+    {
+        response.clear();
+
+        const std::size_t separator = command.find(' ');
+        const std::string_view verb = command.substr(0U, separator);
+        const std::string_view argument = separator == std::string_view::npos ? std::string_view{} : command.substr(separator + 1U);
+
+        if (verb == "reload" && argument.empty())
+        {
+            ReloadConfig(response);
+        }
+        else if (verb == "status" && argument.empty())
+        {
+            // 세션은 전송 스레드가 사용하므로 전송 스레드가 마지막으로 기록한 상태를 사용 (전송 중에도 기다리지 않음)
+            const std::shared_ptr<const TargetSnapshot> snapshot = mConfig.GetSnapshot();
+            std::wstring statusText = L"targets=" + std::to_wstring(snapshot != nullptr ? snapshot->mTargets.size() : 0U);
+            {
+                const std::lock_guard<std::mutex> lock{mWakeMutex};
+                statusText += L" pending-wakes=" + std::to_wstring(mPendingWakeCount) + L' ' + mSessionStatus;
+            }
+            AppendResult(response, WolErrorCode::Success, L"status", statusText);
+        }
+        else if (verb == "shutdown" && argument.empty())
+        {
+            mShutdownRequested = true;
+            AppendResult(response, WolErrorCode::Success, L"shutdown", L"");
+        }
+        else
+        {
+            AppendResult(response, WolErrorCode::InvalidCommand, Utf8ToWide(command), L"");
+        }
+    }
+
+    void WakeOnLanDaemon::WakeTarget(_In_ const std::string_view name, _Inout_ std::string& response)
+    {
+        UpdateNameIndex();
+
+        const std::wstring wideName = Utf8ToWide(name);
+        const auto found = mNameIndex.find(ToLowerCase(wideName));
+        if (found == mNameIndex.end())
+        {
+            AppendResult(response, WolErrorCode::TargetNotFound, wideName, L"");
+            return;
+        }
+
+        // 스냅샷은 이 함수가 끝날 때까지 mIndexedSnapshot이 유지
+        const WolTarget& target = mIndexedSnapshot->mTargets[found->second];
+
+        DestinationAddress destAddr{};
+        mSender.SetupDestination(target.mBroadcastAddr, target.mMulticast, target.mPort, destAddr);
+        AppendResult(response, mSession.Send(target.mMacBytes, destAddr, target.mRack), target.mName, L"");
+    }
+
+    void WakeOnLanDaemon::WakeAllTargets(_Inout_ std::string& response)
+    {
+        // 전송하는 동안 설정 파일을 다시 읽어도 이 스냅샷은 유지됨
+        const std::shared_ptr<const TargetSnapshot> snapshot = mConfig.GetSnapshot();
+        if (snapshot == nullptr)
+        {
+            AppendResult(response, WolErrorCode::TargetNotFound, L"wake-all", L"");
+            return;
+        }
+
+        std::vector<WolErrorCode> results{};
+        const WolErrorCode errorCode = mSender.SendMagicPackets(mSession, snapshot->mTargets, results);
+        if (errorCode != WolErrorCode::Success)
+        {
+            AppendResult(response, errorCode, L"wake-all", L"");
+            return;
+        }
+
+        for (std::size_t i = 0U; i < results.size(); ++i)
+        {
+            AppendResult(response, results[i], snapshot->mTargets[i].mName, L"");
+        }
+    }
+
+    void WakeOnLanDaemon::ReloadConfig(_Inout_ std::string& response)
+    {
+        ConfigReloadResult result{};
+        const WolErrorCode errorCode = mConfig.Reload(result);
+        if (errorCode != WolErrorCode::Success)
+        {
+            // 현재 스냅샷을 계속 사용
+            std::ignore = ::fwprintf(stderr, L"설정 파일을 다시 읽지 못해 이전 설정을 계속 사용합니다.\n");
+            AppendResult(response, errorCode, L"reload", L"");
+            return;
+        }
+
+        std::array<wchar_t, 128U> summary{};
+        std::ignore = std::swprintf(summary.data(), summary.size(), L"unchanged=%zu reloaded=%zu dropped=%zu",
+                                    result.mUnchanged, result.mReloaded, result.mDropped);
+        std::ignore = ::fwprintf(stdout, L"설정 파일을 다시 읽었습니다. (%ls)\n", summary.data());
+        std::ignore = std::fflush(stdout);
+        AppendResult(response, WolErrorCode::Success, L"reload", summary.data());
+    }
+
+    void WakeOnLanDaemon::UpdateNameIndex()
+    {
+        std::shared_ptr<const TargetSnapshot> snapshot = mConfig.GetSnapshot();
+        if (snapshot == mIndexedSnapshot)
+            return;
+
+        mNameIndex.clear();
+        if (snapshot != nullptr)
+        {
+            mNameIndex.reserve(snapshot->mTargets.size());
+            for (std::size_t i = 0U; i < snapshot->mTargets.size(); ++i)
+            {
+                // 같은 이름의 대상이 여러 개라면 첫 번째 대상을 사용
+                mNameIndex.try_emplace(ToLowerCase(snapshot->mTargets[i].mName), i);
+            }
+        }
+
+        mIndexedSnapshot = std::move(snapshot);
+    }
+
+    void WakeOnLanDaemon::AppendResult(_Inout_ std::string& response, _In_ const WolErrorCode result,
+                                       _In_ const std::wstring_view subject, _In_ const std::wstring_view description)
+    {
+        response += std::to_string(static_cast<unsigned int>(result));
+        response += '\t';
+        response += WideToUtf8(subject);
+        response += '\t';
+
+        // 설명이 없으면 오류 코드의 설명을 사용 (WolErrorCodeToString()의 결과는 줄바꿈으로 끝남)
+        if (description.empty())
+        {
+            std::wstring text = WolErrorCodeToString(result);
+            while (text.empty() == false && text.back() == L'\n')
+                text.pop_back();
+            response += WideToUtf8(text);
+        }
+        else
+        {
+            response += WideToUtf8(description);
+        }
+
+        response += '\n';
+    }
+
+    WolErrorCode WakeOnLanControlClient::Execute(_In_ const std::string_view command, _Out_ std::string& response) noexcept
+    {
+        response.clear();
+
+        WolErrorCode errorCode = mWsaGuard.Initialize();
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        std::filesystem::path socketPath{};
+        sockaddr_un address{};
+        errorCode = GetControlSocketAddress(mConfig, socketPath, address);
+        if (errorCode != WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        const Socket socket(::socket(AF_UNIX, SOCK_STREAM, 0));
+        if (socket.Get() == INVALID_SOCKET)
+        {
+            std::ignore = ::fwprintf(stderr, L"제어 소켓을 생성할 수 없습니다. (오류 코드: %d)\n", WSAGetLastError());
+            return WolErrorCode::ControlSocketFailed;
+        }
+
+        if (::connect(socket.Get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR)
+        {
+            std::ignore = ::fwprintf(stderr, L"Wake-on-LAN 서비스에 연결할 수 없습니다: %ls\n", socketPath.wstring().c_str());
+            return WolErrorCode::DaemonNotRunning;
+        }
+
+        try
+        {
+            std::string request{command};
+            request += '\n';
+
+            std::size_t sent = 0U;
+            while (sent < request.length())
+            {
+                const int result = ::send(socket.Get(), request.data() + sent, static_cast<int>(request.length() - sent), 0);
+                if (result <= 0)
+                {
+                    std::ignore = ::fwprintf(stderr, L"Wake-on-LAN 서비스에 명령을 보낼 수 없습니다.\n");
+                    return WolErrorCode::ControlSocketFailed;
+                }
+
+                sent += static_cast<std::size_t>(result);
+            }
+
+            // 서비스는 응답을 보낸 뒤 연결을 닫음
+            std::array<char, 4096U> buffer{};
+            int received = 0;
+            while ((received = ::recv(socket.Get(), buffer.data(), static_cast<int>(buffer.size()), 0)) > 0)
+            {
+                response.append(buffer.data(), static_cast<std::size_t>(received));
+            }
+
+            return WolErrorCode::Success;
+        }
+        catch (...)
+        {
+            std::ignore = ::fwprintf(stderr, L"Wake-on-LAN 서비스의 응답을 받는 중 오류가 발생했습니다.\n");
+            return WolErrorCode::UnexpectedException;
+        }
+    }
+}
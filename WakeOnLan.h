@@ -0,0 +1,3275 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Wake-on-LAN(WOL) 라이브러리 헤더
+///
+/// @details
+/// 설정 파일(WolConfig), 매직 패킷 생성(CreateMagicPacket, MagicPacketCache), 전송(WakeOnLanSession,
+/// WakeOnLanSender, WakeOnLanAsyncSender), 대상 장치 확인(LivenessProber)과 상주 서비스(WakeOnLanDaemon) API를 제공
+///
+/// - 콘솔 애플리케이션(main.cpp)과 같은 라이브러리(WakeOnLan 정적/공유 라이브러리)를 링크하여
+///   별도 프로세스를 실행하지 않고 프로그램 안에서 매직 패킷을 전송할 때 사용
+/// - 구현은 WakeOnLan.cpp에 있으며, 이 헤더에는 선언과 인라인 함수만 포함
+/// - 모든 API는 WakeOnLan 네임스페이스에 있으며 오류는 WolErrorCode로 반환 (값은 바꾸지 않고 새 값만 추가)
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <cwctype>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <WinSock2.h>
+#include <WS2tcpip.h>
+#include <afunix.h>
+
+#pragma comment(lib, "ws2_32.lib")
+#pragma comment(lib, "iphlpapi.lib")
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+/// @brief 설정 파일명 상수
+/// @details 실행 파일과 동일한 디렉토리에 위치하는 설정 파일의 고정 이름
+///          변경 불가능한 컴파일 타임 상수로 정의
+#define CONFIG_FILE_NAME L"config.ini"
+
+/// @brief 컴파일된 대상 데이터베이스 파일명 상수
+/// @details 설정 파일(CONFIG_FILE_NAME)을 검증하여 생성한 바이너리 파일로, 설정 파일과 같은 폴더에 생성됨
+#define CONFIG_DATABASE_FILE_NAME L"config.wdb"
+
+/// @brief 상주 서비스의 제어 소켓 파일명 상수
+/// @details 설정 파일(CONFIG_FILE_NAME)과 같은 폴더에 생성되는 AF_UNIX 소켓 파일
+#define CONTROL_SOCKET_FILE_NAME L"wol.sock"
+
+namespace WakeOnLan
+{
+#ifdef _WIN32
+    /// @brief 소켓 핸들 타입 (WinSock SOCKET)
+    using SocketHandle = SOCKET;
+
+    /// @brief 유효하지 않은 소켓 핸들
+    inline constexpr SocketHandle INVALID_SOCKET_HANDLE{INVALID_SOCKET};
+
+    /// @brief poll 대상 소켓과 이벤트 (WinSock WSAPOLLFD)
+    using PollDescriptor = WSAPOLLFD;
+#else
+    /// @brief 소켓 핸들 타입 (POSIX 파일 디스크립터, 실패 시 -1)
+    using SocketHandle = int;
+
+    /// @brief 유효하지 않은 소켓 핸들
+    inline constexpr SocketHandle INVALID_SOCKET_HANDLE{-1};
+
+    /// @brief poll 대상 소켓과 이벤트 (POSIX pollfd)
+    using PollDescriptor = pollfd;
+#endif
+
+    /// @brief MAC 주소를 저장하는 타입 (6바이트 고정 크기 배열)
+    /// @details IEEE 802 표준에 따른 6바이트 하드웨어 주소를 저장
+    ///          네트워크 인터페이스 카드의 고유 물리적 주소를 나타냄
+    using MacAddress = std::array<std::byte, 6U>;
+
+    /// @brief Wake-on-LAN 매직 패킷을 저장하는 타입 (총 102바이트)
+    /// @details WOL 표준에 따른 매직 패킷 구조:
+    ///          - 6바이트 동기화 헤더 (0xFF 6개)
+    ///          - 16회 반복되는 대상 MAC 주소 (6바이트 × 16 = 96바이트)
+    ///          - 총 102바이트로 구성된 Wake-on-LAN 패킷
+    using MagicPacket = std::array<std::byte, 102U>;
+
+    ///	@brief Wake-on-LAN 패킷 전송 결과를 나타내는 열거형
+    /// @details 각 단계에서 발생할 수 있는 오류 상황을 구분하여 정의
+    ///          디버깅 및 오류 처리 시 정확한 원인 파악을 위해 세분화됨
+    enum class WolErrorCode : std::uint8_t
+    {
+        // 각 값은 프로그램의 종료 코드와 JSON 출력의 "code" 값으로 사용되므로 바꾸지 않음
+        // 새 오류는 사용하지 않은 다음 값으로 추가
+
+        // 성공
+        Success = 0U, /// 성공
+
+        // Config 파일 관련
+        // Config 파일을 찾는 과정에서 발생하는 오류
+        FailedToGetExecutionPath = 1U, /// 실행 파일 경로를 얻을 수 없음
+        InvalidExecutionPath = 2U, /// 유효하지 않은 실행 파일 경로
+
+        // Config 파일을 읽는 과정에서 발생하는 오류
+        ConfigFileNotFound = 3U, /// Config 파일을 찾을 수 없음
+        CannotAccessConfigFile = 4U, /// Config 파일에 접근 권한이 없음
+        TargetNotFound = 5U, /// Config 파일에서 대상 섹션을 찾을 수 없음
+        FailedToReadMacAddress = 6U, /// Config 파일에서 Mac 주소를 읽을 수 없음
+        InvalidMacAddress = 7U, /// 유효하지 않은 MAC 주소
+        FailedToReadBroadcastIp = 8U, /// Config 파일에서 브로드캐스트 주소를 읽을 수 없음
+        InvalidBroadcastIp = 9U, /// 유효하지 않은 브로드캐스트 주소
+        FailedToReadPort = 10U, /// Config 파일에서 포트 읽을 수 없음
+        InvalidPort = 11U, /// 유효하지 않은 포트
+
+        // WOL 매직 패킷을 보내는 과정에서 발생하는 오류
+        WinsockInitializationFailed = 12U, /// Winsock 라이브러리 초기화 실패
+        SocketCreationFailed = 13U, /// UDP 소켓 생성 실패
+        BroadcastSetupFailed = 14U, /// 브로드캐스트 소켓 옵션 설정 실패
+        PacketSendFailed = 15U, /// 패킷 전송 과정에서 네트워크 오류 발생
+
+        // 상주 서비스(--daemon)와 클라이언트(--client) 관련
+        ControlSocketFailed = 17U, /// 제어 소켓 생성 또는 통신 실패
+        DaemonAlreadyRunning = 18U, /// 상주 서비스가 이미 실행 중
+        DaemonNotRunning = 19U, /// 상주 서비스에 연결할 수 없음
+        InvalidCommand = 20U, /// 알 수 없는 제어 명령
+
+        // 명령줄 관련
+        InvalidArgument = 21U, /// 알 수 없거나 잘못 조합된 명령줄 옵션
+
+        // 전송 후 대상 장치 확인(--verify) 관련
+        InvalidHostIp = 22U, /// 대상 장치의 IP 주소(HostIp)가 없거나 유효하지 않음
+        HostNotResponding = 23U, /// 제한 시간 안에 대상 장치가 응답하지 않음
+        ProbeUnavailable = 24U, /// 확인 방법을 사용할 수 없음 (권한 부족 또는 지원하지 않는 플랫폼)
+
+        // 전송 속도 제한 관련
+        InvalidRack = 25U, /// 대상 장치의 랙 번호(Rack)가 유효하지 않음
+
+        // 여러 네트워크 인터페이스로 전송(--interface) 관련
+        InterfaceNotFound = 26U, /// 지정한 네트워크 인터페이스가 없거나 사용할 수 있는 인터페이스가 없음
+        InterfaceBindFailed = 27U, /// 네트워크 인터페이스 주소에 소켓을 바인딩하지 못함
+
+        // 기타
+        UnexpectedException = 16U /// 예상치 못한 예외 상황
+    };
+
+    /// @brief WOL 결과를 문자열로 변환
+    ///	@param result WOL 결과
+    ///	@return 결과 설명 문자열
+    [[nodiscard]] std::wstring WolErrorCodeToString(const WolErrorCode result) noexcept;
+
+    /// @brief WOL 결과를 바뀌지 않는 식별자 문자열로 변환
+    ///	@param result WOL 결과
+    ///	@return 열거자 이름 (예: L"InvalidMacAddress"), JSON 출력의 "error" 값으로 사용
+    [[nodiscard]] const wchar_t* WolErrorCodeToName(const WolErrorCode result) noexcept;
+
+    /// @brief 두 문자열이 대소문자 구분 없이 같은지 확인
+    /// @details INI 파일의 섹션명과 키명 비교에 사용 (GetPrivateProfileStringW와 동일한 규칙)
+    [[nodiscard]] bool EqualsIgnoreCase(const std::wstring_view lhs, const std::wstring_view rhs) noexcept;
+
+    /// @brief 문자열 앞뒤의 공백 문자를 제거
+    [[nodiscard]] std::wstring_view TrimWhitespace(std::wstring_view text) noexcept;
+
+    /// @brief 문자열을 소문자로 변환
+    /// @details INI 파일의 섹션명 색인 키로 사용 (EqualsIgnoreCase()와 같은 규칙)
+    [[nodiscard]] std::wstring ToLowerCase(const std::wstring_view text);
+
+    /// @brief UTF-8 문자열을 wchar_t 문자열로 변환
+    /// @details wchar_t가 2바이트인 플랫폼(Windows)에서는 UTF-16으로, 4바이트인 플랫폼에서는 UTF-32로 변환
+    ///          잘못된 UTF-8 바이트열은 U+FFFD로 대체하여 이후 유효성 검사에서 걸러지도록 함
+    ///          코드 페이지(CP_ACP)나 로캘에 의존하지 않음
+    [[nodiscard]] std::wstring Utf8ToWide(const std::string_view text);
+
+    /// @brief wchar_t 문자열을 UTF-8 문자열로 변환
+    /// @details Utf8ToWide()의 역변환 (wchar_t가 2바이트인 플랫폼에서는 UTF-16 서로게이트 쌍을 해석)
+    ///          짝이 맞지 않는 서로게이트는 U+FFFD로 대체
+    [[nodiscard]] std::string WideToUtf8(const std::wstring_view text);
+
+    /// @brief 메모리에 한 번 읽어 들인 INI 파일
+    /// @details 파일 전체를 한 번만 읽어 섹션과 키/값을 색인하고, 이후 조회 시에는 파일을 다시 읽지 않음
+    ///          (GetPrivateProfileStringW는 키 하나를 읽을 때마다 파일을 다시 열고 처음부터 검색함)
+    ///          GetPrivateProfileStringW와 같은 규칙을 따름
+    ///          - ';'로 시작하는 줄은 주석
+    ///          - 섹션명, 키명, 값의 앞뒤 공백은 제거
+    ///          - 섹션명과 키명은 대소문자를 구분하지 않음
+    ///          - 첫 번째 섹션 이전의 키는 무시
+    ///          - 같은 섹션에 같은 키가 여러 번 나타나면 첫 번째 값을 사용
+    /// @note 파일은 모든 플랫폼에서 UTF-8(BOM 허용)로 해석
+    class IniFile final
+    {
+    public:
+        /// @brief 섹션의 키/값 하나
+        struct Key final
+        {
+            /// @brief 키명
+            std::wstring mName{};
+
+            /// @brief 값
+            std::wstring mValue{};
+        };
+
+        /// @brief 섹션 하나
+        /// @details 섹션마다 키 수가 적으므로 키는 나타난 순서대로 보관하고 순차 검색
+        struct Section final
+        {
+            /// @brief 섹션명 ([섹션명]에서 앞뒤 공백을 제거한 값)
+            std::wstring mName{};
+
+            /// @brief 키/값 목록 (파일에 나타난 순서)
+            std::vector<Key> mKeys{};
+
+            /// @brief 키 값을 읽음
+            /// @param key 키명 (대소문자 구분 없음)
+            /// @param defaultValue 키가 없을 때 사용할 기본값
+            /// @param value 읽은 값 출력
+            void GetValue(std::wstring_view key, std::wstring_view defaultValue,
+                          std::wstring& value) const;
+        };
+
+        /// @brief 기본 생성자
+        IniFile() = default;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        IniFile(const IniFile& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        IniFile(IniFile&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        IniFile& operator=(const IniFile& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        IniFile& operator=(IniFile&& other) noexcept = delete;
+
+        /// @brief 소멸자 - 기본 소멸자 사용
+        ~IniFile() = default;
+
+        /// @brief INI 파일을 한 번 읽어 해석
+        /// @param path INI 파일 경로
+        /// @return 성공 시 WolErrorCode::Success, 파일을 열 수 없는 경우 WolErrorCode::CannotAccessConfigFile
+        [[nodiscard]] WolErrorCode Load(const std::wstring& path);
+
+        /// @brief 메모리에 있는 INI 내용을 해석
+        /// @param content UTF-8로 인코딩된 INI 내용 (BOM 허용)
+        /// @details 이전에 해석한 내용은 지워짐
+        void Parse(std::string_view content);
+
+        /// @brief INI 파일의 내용을 해석하지 않고 그대로 읽음
+        /// @param path INI 파일 경로
+        /// @param content 읽은 내용 출력 (UTF-8)
+        /// @return 성공 시 WolErrorCode::Success, 파일을 열 수 없는 경우 WolErrorCode::CannotAccessConfigFile
+        [[nodiscard]] static WolErrorCode ReadContent(const std::wstring& path, std::string& content);
+
+        /// @brief INI 내용을 해석하지 않고 섹션 머리글 줄을 기준으로 나눔
+        /// @param content UTF-8로 인코딩된 INI 내용 (BOM 허용)
+        /// @param chunks 나눈 내용 출력 (content를 가리킴)
+        /// @details 첫 글자(공백/탭 제외)가 '['인 줄에서 새 조각을 시작하며, 첫 섹션 이전의 내용도 하나의 조각이 됨
+        ///          각 조각을 Parse()로 해석한 결과를 이어 붙이면 전체를 Parse()로 해석한 결과와 같음
+        ///          (ASCII가 아닌 공백 뒤에 머리글이 오는 경우처럼 한 조각에 여러 섹션이 들어갈 수 있음)
+        static void SplitSections(std::string_view content, std::vector<std::string_view>& chunks);
+
+        /// @brief 모든 섹션을 파일에 나타난 순서대로 반환
+        [[nodiscard]] const std::vector<Section>& GetSections() const noexcept { return mSections; }
+
+        /// @brief 이름으로 섹션을 찾음
+        /// @param name 섹션명 (대소문자 구분 없음)
+        /// @return 같은 이름의 첫 번째 섹션, 없으면 nullptr
+        [[nodiscard]] const Section* FindSection(std::wstring_view name) const;
+
+    private:
+        /// @brief 섹션 목록 (파일에 나타난 순서)
+        std::vector<Section> mSections{};
+
+        /// @brief 소문자로 변환한 섹션명으로 mSections의 위치를 찾기 위한 색인
+        /// @details 같은 이름의 섹션이 여러 번 나타나면 첫 번째 섹션의 위치
+        std::unordered_map<std::wstring, std::size_t> mSectionIndex{};
+    };
+
+    /// @brief MAC 주소 문자열 변환 오류
+    enum class MacAddressParseError : std::uint8_t
+    {
+        None = 0U, /// 성공
+        Empty, /// 빈 문자열
+        InvalidLength, /// 문자열 길이가 지원하는 형식(17자, 14자, 12자)과 다름
+        InvalidSeparator, /// 구분자 위치의 문자가 형식의 구분자가 아님
+        InvalidHexDigit /// 16진수 자리의 문자가 16진수(0-9, A-F, a-f)가 아님
+    };
+
+    /// @brief MAC 주소 문자열 변환 결과
+    struct MacAddressParseResult final
+    {
+        /// @brief 오류 종류 (성공 시 MacAddressParseError::None)
+        MacAddressParseError mError{MacAddressParseError::None};
+
+        /// @brief 오류가 발생한 문자의 위치 (InvalidSeparator, InvalidHexDigit인 경우)
+        std::size_t mPosition{0U};
+
+        /// @brief 변환에 성공했는지 확인
+        [[nodiscard]] constexpr bool IsSuccess() const noexcept { return mError == MacAddressParseError::None; }
+    };
+
+    /// @brief MAC 주소의 16진수 자릿수 (12자리)
+    inline constexpr std::size_t MAC_ADDRESS_HEX_DIGIT_COUNT{std::tuple_size_v<MacAddress> * 2U};
+
+    /// @brief 바이트마다 구분자가 있는 MAC 주소 문자열의 길이 ("XX-XX-XX-XX-XX-XX", "XX:XX:XX:XX:XX:XX", 17자)
+    inline constexpr std::size_t MAC_ADDRESS_SEPARATED_LENGTH{MAC_ADDRESS_HEX_DIGIT_COUNT + 5U};
+
+    /// @brief 4자리마다 '.'이 있는 MAC 주소 문자열(Cisco 형식)의 길이 ("XXXX.XXXX.XXXX", 14자)
+    inline constexpr std::size_t MAC_ADDRESS_DOTTED_LENGTH{MAC_ADDRESS_HEX_DIGIT_COUNT + 2U};
+
+    /// @brief 16진수가 아닌 문자를 나타내는 HEX_DIGIT_TABLE 값
+    inline constexpr std::uint8_t INVALID_HEX_DIGIT{0xFFU};
+
+    /// @brief ASCII 문자를 16진수 값(0 ~ 15)으로 변환하는 표
+    /// @details 16진수가 아닌 문자는 INVALID_HEX_DIGIT
+    inline constexpr std::array<std::uint8_t, 128U> HEX_DIGIT_TABLE = []() constexpr
+    {
+        std::array<std::uint8_t, 128U> table{};
+        for (std::size_t i = 0U; i < table.size(); ++i)
+        {
+            table[i] = INVALID_HEX_DIGIT;
+        }
+
+        for (std::uint8_t i = 0U; i < 10U; ++i)
+        {
+            table['0' + i] = i;
+        }
+
+        for (std::uint8_t i = 0U; i < 6U; ++i)
+        {
+            table['A' + i] = static_cast<std::uint8_t>(10U + i);
+            table['a' + i] = static_cast<std::uint8_t>(10U + i);
+        }
+
+        return table;
+    }();
+
+    /// @brief 문자 하나를 16진수 값으로 변환
+    /// @return 16진수 값(0 ~ 15), 16진수가 아닌 경우 INVALID_HEX_DIGIT
+    [[nodiscard]] constexpr std::uint8_t HexDigitValue(const wchar_t ch) noexcept
+    {
+        const auto code = static_cast<std::uint32_t>(ch);
+        return code < HEX_DIGIT_TABLE.size() ? HEX_DIGIT_TABLE[code] : INVALID_HEX_DIGIT;
+    }
+
+    /// @brief MAC 주소 문자열을 검증하고 바이트 배열로 변환
+    /// @param text 변환할 MAC 주소 문자열
+    /// @param macAddress 변환된 MAC 주소 바이트 배열 출력 (실패 시 변환된 앞부분만 유효)
+    /// @return 변환 결과 (실패 시 오류 종류와 위치)
+    /// @details 지원하는 MAC 주소 형식 (문자열 길이로 구분):
+    ///          - "XX-XX-XX-XX-XX-XX" (Windows, 17자)
+    ///          - "XX:XX:XX:XX:XX:XX" (Linux, 17자)
+    ///          - "XXXX.XXXX.XXXX" (Cisco 스위치, 14자)
+    ///          - "XXXXXXXXXXXX" (DHCP 임대 목록 등 구분자 없음, 12자)
+    ///          문자열을 한 번만 순회하며 검증과 변환을 함께 수행
+    ///          메모리 할당과 로캘에 의존하지 않으며 컴파일 시점 상수 식에서도 사용 가능
+    /// @note 대소문자를 구분하지 않으며, 한 문자열 안에서 서로 다른 구분자를 섞어 쓸 수 없음
+    [[nodiscard]] constexpr MacAddressParseResult ParseMacAddress(const std::wstring_view text,
+                                                                  MacAddress& macAddress) noexcept
+    {
+        if (text.empty())
+            return {MacAddressParseError::Empty, 0U};
+
+        // 형식별 구분자 사이의 16진수 자릿수와 구분자
+        std::size_t groupDigitCount = MAC_ADDRESS_HEX_DIGIT_COUNT;
+        wchar_t separator = L'\0';
+        switch (text.length())
+        {
+        case MAC_ADDRESS_SEPARATED_LENGTH:
+            // 첫 번째 구분자로 형식을 정하고 나머지 구분자가 같은지 검사
+            groupDigitCount = 2U;
+            separator = text[2];
+            if (separator != L'-' && separator != L':')
+                return {MacAddressParseError::InvalidSeparator, 2U};
+            break;
+
+        case MAC_ADDRESS_DOTTED_LENGTH:
+            groupDigitCount = 4U;
+            separator = L'.';
+            break;
+
+        case MAC_ADDRESS_HEX_DIGIT_COUNT:
+            break;
+
+        default:
+            return {MacAddressParseError::InvalidLength, 0U};
+        }
+
+        std::size_t position = 0U;
+        std::uint8_t high = 0U;
+        for (std::size_t digit = 0U; digit < MAC_ADDRESS_HEX_DIGIT_COUNT; ++digit)
+        {
+            if (digit > 0U && (digit % groupDigitCount) == 0U)
+            {
+                if (text[position] != separator)
+                    return {MacAddressParseError::InvalidSeparator, position};
+
+                ++position;
+            }
+
+            const std::uint8_t value = HexDigitValue(text[position]);
+            if (value == INVALID_HEX_DIGIT)
+                return {MacAddressParseError::InvalidHexDigit, position};
+
+            ++position;
+
+            // 짝수 번째 자리는 상위 4비트, 홀수 번째 자리는 하위 4비트
+            if ((digit % 2U) == 0U)
+            {
+                high = value;
+                continue;
+            }
+
+            macAddress[digit / 2U] = static_cast<std::byte>((high << 4U) | value);
+        }
+
+        return {};
+    }
+
+    static_assert([]() constexpr
+                  {
+                      constexpr MacAddress expected{std::byte{0x00}, std::byte{0x11}, std::byte{0x22},
+                                                    std::byte{0xAA}, std::byte{0xBB}, std::byte{0xCC}};
+                      const auto parses = [&expected](const std::wstring_view text) constexpr
+                      {
+                          MacAddress address{};
+                          if (ParseMacAddress(text, address).IsSuccess() == false)
+                              return false;
+
+                          for (std::size_t i = 0U; i < address.size(); ++i)
+                          {
+                              if (address[i] != expected[i])
+                                  return false;
+                          }
+
+                          return true;
+                      };
+                      const auto fails = [](const std::wstring_view text, const MacAddressParseError error,
+                                            const std::size_t position) constexpr
+                      {
+                          MacAddress address{};
+                          const MacAddressParseResult result = ParseMacAddress(text, address);
+                          return result.mError == error && result.mPosition == position;
+                      };
+
+                      return parses(L"00-11-22-AA-BB-CC") && parses(L"00:11:22:aa:bb:cc") && parses(L"0011.22aA.BbcC")
+                          && parses(L"001122AABBCC") && fails(L"", MacAddressParseError::Empty, 0U)
+                          && fails(L"00-11:22-AA-BB-CC", MacAddressParseError::InvalidSeparator, 5U)
+                          && fails(L"00:11:22:AA:BB-CC", MacAddressParseError::InvalidSeparator, 14U)
+                          && fails(L"00.11.22.AA.BB.CC", MacAddressParseError::InvalidSeparator, 2U)
+                          && fails(L"00-11-22.AA-BB-CC", MacAddressParseError::InvalidSeparator, 8U)
+                          && fails(L"0011-22AA-BBCC", MacAddressParseError::InvalidSeparator, 4U)
+                          && fails(L"001122AABBC", MacAddressParseError::InvalidLength, 0U)
+                          && fails(L"001122AABBCCD", MacAddressParseError::InvalidLength, 0U)
+                          && fails(L"00-11-22-AA-BB-C", MacAddressParseError::InvalidLength, 0U)
+                          && fails(L"G0-11-22-AA-BB-CC", MacAddressParseError::InvalidHexDigit, 0U)
+                          && fails(L"00-11-22-AG-BB-CC", MacAddressParseError::InvalidHexDigit, 10U)
+                          && fails(L"00-11-22-AA-BB-C\u00FF", MacAddressParseError::InvalidHexDigit, 16U)
+                          && fails(L"0011.22zz.BBCC", MacAddressParseError::InvalidHexDigit, 7U)
+                          && fails(L"00112233445G", MacAddressParseError::InvalidHexDigit, 11U);
+                  }(),
+                  "MAC 주소 변환이 잘못됨");
+
+    /// @brief IPv4 주소 문자열을 정수로 변환
+    /// @param text 변환할 IPv4 주소 문자열 (예: "192.168.0.255")
+    /// @param address 변환된 주소 출력 (호스트 바이트 순서, 실패 시 0)
+    /// @return 변환에 성공한 경우 true
+    /// @details WolConfig::IsValidBroadcastIpAddress()와 같은 규칙으로 검사
+    ///          - 점으로 구분된 4개의 옥텟, 각 옥텟은 0-255 범위의 10진수
+    ///          - 선행 0은 허용하지 않음 (예: "01.02.03.04"는 무효)
+    ///          메모리 할당과 로캘, 코드 페이지에 의존하지 않으며 컴파일 시점 상수 식에서도 사용 가능
+    [[nodiscard]] constexpr bool ParseIpv4Address(const std::wstring_view text, std::uint32_t& address) noexcept
+    {
+        address = 0U;
+
+        std::uint32_t result = 0U;
+        std::uint32_t octet = 0U;
+        std::size_t octetCount = 0U;
+        std::size_t digitCount = 0U;
+        for (std::size_t i = 0U; i <= text.length(); ++i)
+        {
+            // 점을 만나거나 문자열 끝에 도달한 경우 옥텟 하나가 끝남
+            if (i == text.length() || text[i] == L'.')
+            {
+                if (digitCount == 0U || octetCount == 4U)
+                    return false;
+
+                result = (result << 8U) | octet;
+                ++octetCount;
+                octet = 0U;
+                digitCount = 0U;
+                continue;
+            }
+
+            if (text[i] < L'0' || text[i] > L'9')
+                return false;
+
+            // 선행 0 금지 (두 자리 이상인데 0으로 시작)
+            if (digitCount == 1U && octet == 0U)
+                return false;
+
+            octet = (octet * 10U) + static_cast<std::uint32_t>(text[i] - L'0');
+            ++digitCount;
+            if (octet > 255U)
+                return false;
+        }
+
+        if (octetCount != 4U)
+            return false;
+
+        address = result;
+        return true;
+    }
+
+    /// @brief "A.B.C.D" 또는 CIDR 표기 "A.B.C.D/길이" 형식의 IPv4 주소를 변환
+    /// @param text 변환할 문자열 (예: "192.168.10.23/24")
+    /// @param address 변환된 주소 출력 (호스트 바이트 순서, 실패 시 0)
+    /// @param prefixLength 접두사 길이 출력 (1 ~ 32, "/길이"가 없으면 0)
+    /// @return 변환에 성공한 경우 true
+    /// @details 주소 부분은 ParseIpv4Address()와 같은 규칙, 접두사 길이는 선행 0 없는 1 ~ 32
+    [[nodiscard]] constexpr bool ParseIpv4Cidr(const std::wstring_view text, std::uint32_t& address,
+                                               std::uint32_t& prefixLength) noexcept
+    {
+        prefixLength = 0U;
+
+        const std::size_t slash = text.find(L'/');
+        if (ParseIpv4Address(text.substr(0U, slash), address) == false)
+            return false;
+
+        if (slash == std::wstring_view::npos)
+            return true;
+
+        const std::wstring_view lengthText = text.substr(slash + 1U);
+        if (lengthText.empty() || lengthText.length() > 2U || lengthText[0] == L'0')
+        {
+            address = 0U;
+            return false;
+        }
+
+        std::uint32_t length = 0U;
+        for (const wchar_t ch : lengthText)
+        {
+            if (ch < L'0' || ch > L'9')
+            {
+                address = 0U;
+                return false;
+            }
+
+            length = (length * 10U) + static_cast<std::uint32_t>(ch - L'0');
+        }
+
+        if (length > 32U)
+        {
+            address = 0U;
+            return false;
+        }
+
+        prefixLength = length;
+        return true;
+    }
+
+    /// @brief 주소와 접두사 길이로 서브넷의 지정 브로드캐스트(directed broadcast) 주소를 계산
+    /// @param address 서브넷 안의 주소 (호스트 바이트 순서)
+    /// @param prefixLength 접두사 길이 (1 ~ 30, /31과 /32에는 브로드캐스트 주소가 없음)
+    /// @return 호스트 부분의 비트를 모두 1로 채운 주소 (호스트 바이트 순서, 예: 192.168.10.23/24 → 192.168.10.255)
+    /// @details 전역 브로드캐스트(255.255.255.255)는 라우터를 넘지 못하지만, 지정 브로드캐스트는 라우터가
+    ///          해당 서브넷으로 전달하므로(ip directed-broadcast 허용 시) 다른 VLAN의 대상도 깨울 수 있음
+    [[nodiscard]] constexpr std::uint32_t GetDirectedBroadcast(const std::uint32_t address,
+                                                               const std::uint32_t prefixLength) noexcept
+    {
+        return address | (0xFFFFFFFFU >> prefixLength);
+    }
+
+    static_assert(GetDirectedBroadcast(0xC0A80A17U, 24U) == 0xC0A80AFFU && GetDirectedBroadcast(0x0A010203U, 20U) == 0x0A010FFFU,
+                  "지정 브로드캐스트 주소 계산이 잘못됨");
+
+    /// @brief IPv6 주소 바이트 배열 (네트워크 바이트 순서)
+    using Ipv6Address = std::array<std::uint8_t, 16U>;
+
+    /// @brief IPv6 주소 문자열을 바이트 배열로 변환
+    /// @param text 변환할 IPv6 주소 문자열 (예: "ff02::1", "ff05:0:0:0:0:0:1:3")
+    /// @param address 변환된 주소 출력 (실패 시 모두 0)
+    /// @return 변환에 성공한 경우 true
+    /// @details RFC 4291 2.2의 콜론 16진수 표기 (대소문자 구분 없음)
+    ///          - 16비트 그룹 8개, 각 그룹은 1 ~ 4자리 16진수
+    ///          - 연속된 0 그룹은 "::"로 한 번만 생략 가능
+    ///          - 끝에 IPv4 주소를 붙인 표기(::ffff:1.2.3.4)는 멀티캐스트 주소에 쓰이지 않으므로 지원하지 않음
+    ///          메모리 할당과 로캘에 의존하지 않으며 컴파일 시점 상수 식에서도 사용 가능
+    [[nodiscard]] constexpr bool ParseIpv6Address(const std::wstring_view text, Ipv6Address& address) noexcept
+    {
+        address = {};
+
+        std::array<std::uint16_t, 8U> groups{};
+        std::size_t groupCount = 0U;
+        std::size_t gapPosition = groups.size(); // "::" 뒤의 첫 그룹 위치 (없으면 groups.size())
+        std::size_t i = 0U;
+        if (text.substr(0U, 2U) == L"::")
+        {
+            gapPosition = 0U;
+            i = 2U;
+        }
+
+        while (i < text.length())
+        {
+            std::uint32_t group = 0U;
+            std::size_t digitCount = 0U;
+            for (; i < text.length() && text[i] != L':'; ++i)
+            {
+                const std::uint8_t value = HexDigitValue(text[i]);
+                if (value == INVALID_HEX_DIGIT || digitCount == 4U)
+                    return false;
+
+                group = (group << 4U) | value;
+                ++digitCount;
+            }
+
+            if (digitCount == 0U || groupCount == groups.size())
+                return false;
+
+            groups[groupCount++] = static_cast<std::uint16_t>(group);
+            if (i == text.length())
+                break;
+
+            // ':' 다음에는 그룹이, "::" 다음에는 그룹이나 문자열 끝이 와야 함
+            ++i;
+            if (i < text.length() && text[i] == L':')
+            {
+                if (gapPosition != groups.size())
+                    return false;
+
+                gapPosition = groupCount;
+                ++i;
+            }
+            else if (i == text.length())
+            {
+                return false;
+            }
+        }
+
+        // "::"가 없으면 8개, 있으면 생략된 그룹이 하나 이상이어야 함
+        const bool hasGap = gapPosition != groups.size();
+        if ((hasGap == false && groupCount != groups.size()) || (hasGap && groupCount == groups.size()))
+            return false;
+
+        // 생략된 0 그룹만큼 "::" 뒤의 그룹을 뒤로 이동
+        const std::size_t gapLength = groups.size() - groupCount;
+        for (std::size_t group = 0U; group < groupCount; ++group)
+        {
+            const std::size_t position = group < gapPosition ? group : group + gapLength;
+            address[position * 2U] = static_cast<std::uint8_t>(groups[group] >> 8U);
+            address[(position * 2U) + 1U] = static_cast<std::uint8_t>(groups[group] & 0xFFU);
+        }
+
+        return true;
+    }
+
+    /// @brief "그룹%범위" 형식의 IPv6 멀티캐스트 주소를 변환
+    /// @param text 변환할 문자열 (예: "ff02::1%eth0", "ff02::1%12", "ff05::1")
+    /// @param group 변환된 멀티캐스트 그룹 출력 (실패 시 모두 0)
+    /// @param scope '%' 뒤의 범위(인터페이스 이름 또는 번호) 출력 (없으면 빈 문자열)
+    /// @return 주소가 멀티캐스트(ff00::/8)이고 '%' 뒤가 비어 있지 않은 경우 true
+    /// @details 잠든 장치는 이웃 탐색(NDP)에 응답하지 않으므로 유니캐스트 주소로는 매직 패킷이 전달되지 않음
+    ///          범위는 링크 로컬 그룹(ff02::/16)이 나갈 인터페이스를 고르며, ResolveScopeId()로 번호로 변환
+    [[nodiscard]] constexpr bool ParseIpv6Multicast(const std::wstring_view text, Ipv6Address& group,
+                                                    std::wstring_view& scope) noexcept
+    {
+        scope = {};
+
+        const std::size_t percent = text.find(L'%');
+        if (ParseIpv6Address(text.substr(0U, percent), group) == false || group[0] != 0xFFU)
+        {
+            group = {};
+            return false;
+        }
+
+        if (percent != std::wstring_view::npos)
+        {
+            scope = text.substr(percent + 1U);
+            if (scope.empty())
+            {
+                group = {};
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static_assert([]() constexpr
+                  {
+                      Ipv6Address address{};
+                      std::wstring_view scope{};
+                      return ParseIpv6Address(L"FF02:0::0:1", address) && address[0] == 0xFFU && address[1] == 0x02U
+                          && address[15] == 0x01U && ParseIpv6Address(L"::", address) && ParseIpv6Address(L"ff02::1::2", address) == false
+                          && ParseIpv6Address(L"ff02::1:", address) == false && ParseIpv6Address(L"1:2:3:4:5:6:7:8:9", address) == false
+                          && ParseIpv6Address(L"ff02::10000", address) == false && ParseIpv6Multicast(L"ff02::1%eth0", address, scope)
+                          && scope == L"eth0" && ParseIpv6Multicast(L"::1", address, scope) == false
+                          && ParseIpv6Multicast(L"ff02::1%", address, scope) == false;
+                  }(),
+                  "IPv6 멀티캐스트 주소 변환이 잘못됨");
+
+    /// @brief IPv6 멀티캐스트 그룹과 전송할 인터페이스(범위)
+    /// @details IPv4 대상은 그룹이 모두 0 (IsSet()이 false)
+    struct Ipv6Multicast final
+    {
+        /// @brief 멀티캐스트 그룹 (네트워크 바이트 순서, 예: ff02::1)
+        Ipv6Address mGroup{};
+
+        /// @brief 범위 ID (전송할 인터페이스 번호, 0이면 운영체제가 경로에 따라 선택)
+        std::uint32_t mScopeId{0U};
+
+        /// @brief IPv6 멀티캐스트 대상인지 확인
+        [[nodiscard]] constexpr bool IsSet() const noexcept { return mGroup[0] == 0xFFU; }
+    };
+
+    /// @brief IPv6 범위 문자열을 범위 ID(인터페이스 번호)로 변환
+    /// @param scope 인터페이스 이름(Linux: eth0 등) 또는 번호(Windows: ipconfig의 "%12" 등), 빈 문자열이면 0
+    /// @param scopeId 변환된 범위 ID 출력 (실패 시 0)
+    /// @return 빈 문자열이거나 번호 또는 존재하는 인터페이스 이름이면 true
+    [[nodiscard]] bool ResolveScopeId(const std::wstring_view scope, std::uint32_t& scopeId) noexcept;
+
+    /// @brief IPv6 멀티캐스트 주소를 "그룹%범위" 형식의 문자열로 변환
+    /// @param multicast 변환할 주소
+    /// @param text 변환된 문자열 출력 (null 문자로 끝남, 예: "ff02::1%eth0")
+    /// @details RFC 5952 표기 (소문자, 그룹의 선행 0 생략, 가장 긴 연속된 0 그룹 두 개 이상을 "::"로 생략)
+    ///          범위는 인터페이스 이름을 알 수 있으면 이름, 아니면 번호로 표시하고 0이면 생략
+    void FormatIpv6Address(const Ipv6Multicast& multicast, std::array<wchar_t, 64U>& text) noexcept;
+
+    /// @brief MAC 주소를 "XX-XX-XX-XX-XX-XX" 형식의 문자열로 변환
+    /// @param macAddress 변환할 MAC 주소 바이트 배열
+    /// @param text 변환된 문자열 출력 (null 문자로 끝남)
+    void FormatMacAddress(const MacAddress& macAddress,
+                          std::array<wchar_t, MAC_ADDRESS_SEPARATED_LENGTH + 1U>& text) noexcept;
+
+    /// @brief IPv4 주소를 "A.B.C.D" 형식의 문자열로 변환
+    /// @param address 변환할 주소 (네트워크 바이트 순서)
+    /// @param text 변환된 문자열 출력 (null 문자로 끝남, "255.255.255.255" 15자 + null 문자)
+    void FormatIpv4Address(const std::uint32_t address, std::array<wchar_t, 16U>& text) noexcept;
+
+    /// @brief Wake-on-LAN 대상 장치 하나의 설정
+    /// @details INI 파일의 대상 섹션 하나에 대응하는 설정 값
+    ///          - 섹션명을 대상 이름으로 사용
+    ///          - MAC 주소, 브로드캐스트 IP 주소, 포트 번호 저장
+    ///          - 문자열은 설정 파일에 적힌 그대로 출력용으로 보관하고,
+    ///            전송에는 설정을 읽을 때 한 번 변환해 둔 바이너리 값(mMacBytes, mBroadcastAddr)만 사용
+    struct WolTarget final
+    {
+        /// @brief 대상 이름 (INI 섹션명, 예: "Target.Rack01-02")
+        std::wstring mName{};
+
+        /// @brief 대상 장치의 MAC 주소 (예: "00-11-22-AA-BB-CC")
+        std::wstring mMacAddress{};
+
+        /// @brief WOL 패킷 전송을 위한 브로드캐스트 IP 주소 (예: "192.168.0.255")
+        /// @details IPv6 멀티캐스트 그룹과 범위도 사용 가능 (예: "ff02::1%eth0")
+        std::wstring mBroadcastIp{};
+
+        /// @brief mMacAddress를 변환한 MAC 주소 바이트 배열
+        MacAddress mMacBytes{};
+
+        /// @brief mBroadcastIp를 변환한 브로드캐스트 주소 (네트워크 바이트 순서, IPv6 대상이면 0)
+        in_addr mBroadcastAddr{};
+
+        /// @brief mBroadcastIp를 변환한 IPv6 멀티캐스트 주소 (IPv4 대상이면 IsSet()이 false)
+        Ipv6Multicast mMulticast{};
+
+        /// @brief WOL 패킷 전송을 위한 대상 포트 번호
+        /// @details 초기화 시에는 유효하지 않은 값(0)으로 초기화
+        std::uint16_t mPort{0};
+
+        /// @brief 대상 장치 자신의 IP 주소 (선택, 예: "192.168.0.10" 또는 CIDR 표기 "192.168.0.10/24")
+        std::wstring mHostIp{};
+
+        /// @brief mHostIp를 변환한 주소 (네트워크 바이트 순서, 지정하지 않았다면 0)
+        in_addr mHostAddr{};
+
+        /// @brief TCP 연결로 확인할 때 사용할 포트 번호 (선택, 지정하지 않았다면 0)
+        std::uint16_t mProbePort{0};
+
+        /// @brief 대상 장치가 설치된 랙 번호 (선택, 1~65535, 지정하지 않았다면 0)
+        /// @details 랙별 전원 투입 속도 제한(PacingPolicy::mRackHostsPerSecond)에 사용
+        std::uint16_t mRack{0};
+    };
+
+    /// @brief 읽기 전용으로 메모리에 매핑한 파일
+    /// @details 파일 전체를 매핑하고 소멸될 때 매핑을 해제
+    ///          - Windows: CreateFileMappingW() / MapViewOfFile()
+    ///          - 그 외: mmap()
+    class MappedFile final
+    {
+    public:
+        /// @brief 기본 생성자
+        MappedFile() noexcept = default;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        MappedFile(const MappedFile& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        MappedFile(MappedFile&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        MappedFile& operator=(const MappedFile& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        MappedFile& operator=(MappedFile&& other) noexcept = delete;
+
+        /// @brief 소멸자 - 매핑 해제
+        ~MappedFile() noexcept { Close(); }
+
+        /// @brief 파일 전체를 읽기 전용으로 매핑
+        /// @param path 매핑할 파일 경로
+        /// @return 성공 시 true, 파일이 없거나 비어있거나 매핑에 실패한 경우 false
+        [[nodiscard]] bool Open(const std::wstring& path) noexcept;
+
+        /// @brief 매핑 해제
+        void Close() noexcept;
+
+        /// @brief 매핑된 파일 내용의 시작 주소를 반환 (매핑하지 않은 경우 nullptr)
+        [[nodiscard]] const std::byte* GetData() const noexcept { return mData; }
+
+        /// @brief 매핑된 파일의 크기를 반환
+        [[nodiscard]] std::size_t GetSize() const noexcept { return mSize; }
+
+    private:
+#ifdef _WIN32
+        /// @brief 파일 핸들
+        HANDLE mFile{INVALID_HANDLE_VALUE};
+
+        /// @brief 파일 매핑 핸들
+        HANDLE mMapping{nullptr};
+#endif
+
+        /// @brief 매핑된 파일 내용의 시작 주소
+        const std::byte* mData{nullptr};
+
+        /// @brief 매핑된 파일의 크기
+        std::size_t mSize{0U};
+    };
+
+    /// @brief 설정 파일을 컴파일한 대상 데이터베이스
+    /// @details 검증을 마친 대상 설정을 고정 크기 레코드 배열로 저장한 바이너리 파일
+    ///          시작할 때 파일을 메모리에 매핑하여 INI 해석과 MAC/IP 검증 없이 바로 사용
+    ///          파일 구조 (모든 값은 생성한 플랫폼의 바이트 순서):
+    ///          - Header (48바이트): 식별자, 형식 버전, 원본 설정 파일의 수정 시각/크기, 레코드 수, 체크섬
+    ///          - Record × mRecordCount (레코드당 56바이트)
+    ///          - 대상 이름과 IPv6 범위 문자열 풀 (UTF-8, mNameLength 바이트, null 문자 없음)
+    ///          원본 설정 파일의 수정 시각이나 크기가 다르거나 형식/체크섬이 맞지 않는 파일은 사용하지 않음
+    ///          IPv6 범위 ID(인터페이스 번호)는 재부팅이나 인터페이스를 다시 만들면 바뀌므로 Open()에서 범위 문자열을 다시 변환하고,
+    ///          변환할 수 없거나 저장된 번호와 다르면 사용하지 않음 (설정 파일에서 다시 생성)
+    /// @note 생성한 플랫폼과 바이트 순서가 다른 플랫폼에서는 사용할 수 없음
+    class TargetDatabase final
+    {
+    public:
+        /// @brief 원본 설정 파일의 상태
+        /// @details 데이터베이스가 현재 설정 파일로부터 생성된 것인지 확인하는 데 사용
+        struct SourceStamp final
+        {
+            /// @brief 마지막 수정 시각 (std::filesystem::file_time_type의 틱 값)
+            std::uint64_t mModifiedTime{0U};
+
+            /// @brief 파일 크기 (바이트)
+            std::uint64_t mSize{0U};
+        };
+
+        /// @brief 데이터베이스 파일 헤더
+        struct Header final
+        {
+            /// @brief 파일 식별자 (MAGIC)
+            std::array<char, 8U> mMagic{};
+
+            /// @brief 파일 형식 버전 (FORMAT_VERSION)
+            std::uint32_t mVersion{0U};
+
+            /// @brief 생성한 플랫폼의 바이트 순서 확인용 값 (BYTE_ORDER_MARK)
+            std::uint32_t mByteOrderMark{0U};
+
+            /// @brief 원본 설정 파일의 상태
+            SourceStamp mSource{};
+
+            /// @brief 레코드 수
+            std::uint32_t mRecordCount{0U};
+
+            /// @brief 이름과 범위 문자열 풀의 길이 (바이트)
+            std::uint32_t mNameLength{0U};
+
+            /// @brief 헤더 뒤의 모든 내용(레코드, 이름 문자열 풀)의 체크섬 (ComputeChecksum())
+            std::uint64_t mChecksum{0U};
+        };
+
+        /// @brief 검증을 마친 대상 하나
+        struct Record final
+        {
+            /// @brief 대상 장치의 MAC 주소
+            MacAddress mMacBytes{};
+
+            /// @brief 대상 포트 번호 (1~65535)
+            std::uint16_t mPort{0U};
+
+            /// @brief 브로드캐스트 주소 (네트워크 바이트 순서, in_addr::s_addr)
+            std::uint32_t mBroadcastAddress{0U};
+
+            /// @brief 이름 문자열 풀에서 대상 이름의 시작 위치 (바이트)
+            std::uint32_t mNameOffset{0U};
+
+            /// @brief 대상 이름의 길이 (UTF-8 바이트 수)
+            std::uint32_t mNameLength{0U};
+
+            /// @brief 대상 장치 자신의 IP 주소 (네트워크 바이트 순서, 지정하지 않았다면 0)
+            std::uint32_t mHostAddress{0U};
+
+            /// @brief TCP 연결로 확인할 때 사용할 포트 번호 (지정하지 않았다면 0)
+            std::uint16_t mProbePort{0U};
+
+            /// @brief 대상 장치가 설치된 랙 번호 (지정하지 않았다면 0)
+            std::uint16_t mRack{0U};
+
+            /// @brief IPv6 멀티캐스트 주소 (IPv4 대상이면 그룹이 모두 0)
+            /// @details 범위 ID는 생성할 때 변환한 값이며, Open()에서 mScopeOffset의 범위 문자열로 다시 확인함
+            Ipv6Multicast mMulticast{};
+
+            /// @brief 문자열 풀에서 IPv6 범위 문자열(BroadcastIp의 '%' 뒤, 인터페이스 이름 또는 번호)의 시작 위치 (바이트)
+            std::uint32_t mScopeOffset{0U};
+
+            /// @brief IPv6 범위 문자열의 길이 (UTF-8 바이트 수, 범위를 지정하지 않았거나 IPv4 대상이면 0)
+            std::uint32_t mScopeLength{0U};
+        };
+
+        /// @brief 기본 생성자
+        TargetDatabase() noexcept = default;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        TargetDatabase(const TargetDatabase& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        TargetDatabase(TargetDatabase&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        TargetDatabase& operator=(const TargetDatabase& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        TargetDatabase& operator=(TargetDatabase&& other) noexcept = delete;
+
+        /// @brief 소멸자 - 기본 소멸자 사용
+        ~TargetDatabase() noexcept = default;
+
+        /// @brief 컴파일된 데이터베이스 파일을 매핑
+        /// @param path 데이터베이스 파일 경로
+        /// @param source 원본 설정 파일의 현재 상태 (파일에 기록된 값과 같아야 함)
+        /// @return 매핑하여 사용할 수 있으면 true, 파일이 없거나 오래되었거나 손상된 경우,
+        ///         IPv6 범위의 인터페이스가 없어졌거나 번호가 바뀐 경우 false
+        /// @details 헤더와 체크섬, 레코드의 문자열 범위를 확인하고, IPv6 범위 문자열은 ResolveScopeId()로 다시 변환하여
+        ///          저장된 범위 ID와 비교 (그 외 레코드 내용은 해석하지 않음)
+        [[nodiscard]] bool Open(const std::wstring& path, const SourceStamp& source) noexcept;
+
+        /// @brief 검증을 마친 대상 목록으로 데이터베이스를 메모리에 생성
+        /// @param targets WolConfig에서 로드한 대상 목록
+        /// @param source 원본 설정 파일의 상태
+        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        [[nodiscard]] WolErrorCode Build(const std::vector<WolTarget>& targets, const SourceStamp& source) noexcept;
+
+        /// @brief Build()로 생성한 데이터베이스를 파일로 저장
+        /// @param path 데이터베이스 파일 경로
+        /// @return 성공 시 true
+        /// @details 임시 파일에 기록한 뒤 교체하여, 저장 중에 실행한 다른 프로세스가 쓰다 만 파일을 읽지 않도록 함
+        [[nodiscard]] bool Save(const std::wstring& path) const noexcept;
+
+        /// @brief 대상 수를 반환
+        [[nodiscard]] std::size_t GetCount() const noexcept { return mHeader != nullptr ? mHeader->mRecordCount : 0U; }
+
+        /// @brief 대상 하나를 반환
+        /// @param index 대상 위치 (0 ~ GetCount() - 1, 설정 파일의 섹션 순서)
+        [[nodiscard]] const Record& GetRecord(const std::size_t index) const noexcept
+        {
+            assert(index < GetCount());
+            return mRecords[index];
+        }
+
+        /// @brief 대상 이름(INI 섹션명)을 UTF-8 문자열로 반환
+        [[nodiscard]] std::string_view GetName(const Record& record) const noexcept
+        {
+            return {mNames + record.mNameOffset, record.mNameLength};
+        }
+
+        /// @brief IPv6 범위 문자열을 UTF-8 문자열로 반환 (범위가 없으면 빈 문자열)
+        [[nodiscard]] std::string_view GetScope(const Record& record) const noexcept
+        {
+            return {mNames + record.mScopeOffset, record.mScopeLength};
+        }
+
+        /// @brief 파일의 현재 수정 시각과 크기를 읽음
+        /// @param path 파일 경로
+        /// @param source 파일 상태 출력
+        /// @return 성공 시 true
+        [[nodiscard]] static bool GetSourceStamp(const std::wstring& path, SourceStamp& source) noexcept;
+
+        /// @brief 파일 식별자
+        static constexpr std::array<char, 8U> MAGIC{'W', 'O', 'L', 'T', 'G', 'T', 'D', 'B'};
+
+        /// @brief 파일 형식 버전 (Header, Record 구조가 바뀌면 증가)
+        static constexpr std::uint32_t FORMAT_VERSION{5U};
+
+        /// @brief 바이트 순서 확인용 값
+        static constexpr std::uint32_t BYTE_ORDER_MARK{0x01020304U};
+
+    private:
+        /// @brief 체크섬 계산
+        /// @details 8바이트 단위로 섞는 FNV-1a 변형을 4개의 독립된 누적값으로 나누어 계산 (손상 검출 용도, 보안 용도 아님)
+        ///          누적값 사이에 의존성이 없어 곱셈 지연 시간이 겹쳐지므로 한 개의 누적값보다 빠름
+        [[nodiscard]] static std::uint64_t ComputeChecksum(const std::byte* data,
+                                                           std::size_t size) noexcept;
+
+        /// @brief 데이터베이스 내용을 검증하고 헤더/레코드/이름 포인터를 설정
+        /// @param data 데이터베이스 내용의 시작 주소
+        /// @param size 데이터베이스 내용의 크기
+        /// @param source 원본 설정 파일의 현재 상태
+        /// @return 사용할 수 있는 내용이면 true
+        [[nodiscard]] bool Attach(const std::byte* data, std::size_t size,
+                                  const SourceStamp& source) noexcept;
+
+        /// @brief IPv6 레코드의 범위 문자열을 다시 변환하여 저장된 범위 ID가 지금도 맞는지 확인
+        /// @return 모든 IPv6 레코드의 범위를 변환할 수 있고 저장된 번호와 같으면 true
+        /// @pre Attach()에 성공해야 함
+        [[nodiscard]] bool AreScopeIdsCurrent() const noexcept;
+
+        /// @brief 헤더/레코드/이름 포인터 초기화
+        void Detach() noexcept;
+
+    private:
+        /// @brief 매핑된 데이터베이스 파일 (Open()으로 연 경우)
+        MappedFile mMappedFile;
+
+        /// @brief 메모리에 생성한 데이터베이스 내용 (Build()로 생성한 경우)
+        std::vector<std::byte> mBuffer{};
+
+        /// @brief 헤더
+        const Header* mHeader{nullptr};
+
+        /// @brief 레코드 배열
+        const Record* mRecords{nullptr};
+
+        /// @brief 이름 문자열 풀 (UTF-8)
+        const char* mNames{nullptr};
+    };
+
+    static_assert(sizeof(TargetDatabase::Header) == 48U, "데이터베이스 헤더 크기가 파일 형식과 달라짐");
+    static_assert(sizeof(TargetDatabase::Record) == 56U, "데이터베이스 레코드 크기가 파일 형식과 달라짐");
+
+    /// @brief 한 시점에 로드된 대상 장치 목록
+    /// @details 생성된 뒤에는 변경하지 않으며 std::shared_ptr<const TargetSnapshot>으로 공유
+    ///          설정을 다시 읽으면 새 스냅샷을 만들어 교체하므로, 이전 스냅샷을 사용 중인 전송은 그대로 완료됨
+    struct TargetSnapshot final
+    {
+        /// @brief 설정 파일의 섹션 조각 하나에서 로드된 대상의 범위
+        struct SectionRange final
+        {
+            /// @brief mTargets에서 첫 번째 대상의 위치
+            std::size_t mFirst{0U};
+
+            /// @brief 대상 수 (대상 섹션이 아니면 0)
+            std::size_t mCount{0U};
+
+            /// @brief mContent에서 조각 원본 텍스트의 시작 위치
+            std::size_t mOffset{0U};
+
+            /// @brief 조각 원본 텍스트의 길이
+            std::size_t mLength{0U};
+        };
+
+        /// @brief 대상 장치 목록 (INI 파일의 섹션 순서)
+        std::vector<WolTarget> mTargets{};
+
+        /// @brief 스냅샷을 만들 때 읽은 설정 파일의 원본 텍스트
+        /// @details 다음 Reload()에서 해시가 같은 조각의 텍스트를 비교하여 해시 충돌로 다른 섹션을 재사용하지 않도록 유지
+        std::string mContent{};
+
+        /// @brief 섹션 조각(IniFile::SplitSections())의 원본 텍스트 해시로 로드된 대상의 범위를 찾기 위한 색인
+        /// @details 같은 해시의 조각이 여러 번 나타나면 첫 번째 조각의 범위
+        std::unordered_map<std::uint64_t, SectionRange> mSections{};
+
+        /// @brief 스냅샷을 만들 때 읽은 설정 파일의 수정 시각/크기
+        TargetDatabase::SourceStamp mSource{};
+    };
+
+    /// @brief 설정 파일을 다시 읽은 결과
+    /// @details 내용이 바뀐 대상은 mReloaded와 mDropped에 모두 포함
+    struct ConfigReloadResult final
+    {
+        /// @brief 섹션 내용이 그대로여서 이전 스냅샷에서 재사용한 대상 수
+        std::size_t mUnchanged{0U};
+
+        /// @brief 새로 추가되었거나 내용이 바뀌어 다시 해석하고 검증한 대상 수
+        std::size_t mReloaded{0U};
+
+        /// @brief 이전 스냅샷의 대상 중 재사용되지 않은 대상 수 (삭제되었거나 내용이 바뀐 대상)
+        std::size_t mDropped{0U};
+    };
+
+    /// @brief Wake-on-LAN 기능을 위한 설정 구조체
+    /// @details WOL 대상 장치들의 설정 정보를 관리하는 클래스
+    ///          - 대상 장치별 MAC 주소, 브로드캐스트 IP 주소 및 포트 번호 저장
+    ///          - INI 파일을 통한 설정 로드 기능 제공
+    ///          - 하나의 설정 파일에 여러 대상 장치(섹션)를 지정 가능
+    struct WolConfig final
+    {
+    public:
+        /// @brief 기본 생성자
+        /// @details 대상 목록은 빈 상태로 초기화
+        WolConfig() = default;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        WolConfig(const WolConfig& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        WolConfig(WolConfig&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        WolConfig& operator=(const WolConfig& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        WolConfig& operator=(WolConfig&& other) noexcept = delete;
+
+        /// @brief 소멸자 - 기본 소멸자 사용
+        ~WolConfig() = default;
+
+        /// @brief 지정된 INI 파일에서 모든 대상 장치의 설정을 로드
+        /// @return 설정 로드 및 유효성 검사 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        /// @post 성공 시 INI 파일의 섹션 순서대로 대상 장치 설정을 담은 스냅샷이 현재 스냅샷이 됨
+        /// @details INI 파일 구조:
+        ///          "Target" 또는 "Target."으로 시작하는 섹션 하위에 다음 키들이 존재해야 함
+        ///          - MacAddress: 대상 장치의 MAC 주소 (필수)
+        ///          - BroadcastIp: 브로드캐스트 IP 주소 (기본값: HostIp가 CIDR 표기이면 그 서브넷의 지정 브로드캐스트, 아니면 255.255.255.255)
+        ///          - Port: WOL 패킷 전송 포트 (기본값: 9)
+        ///          - HostIp: 대상 장치 자신의 IP 주소 (선택, --verify tcp/icmp에 필요, "A.B.C.D/길이" CIDR 표기 가능)
+        ///          - ProbePort: --verify tcp로 확인할 때 연결할 포트 (선택, 기본값: --verify-port)
+        ///          - Rack: 대상 장치가 설치된 랙 번호 (선택, 1 ~ 65535, --rack-rate로 랙별 전송 속도를 제한할 때 사용)
+        /// @note 로드된 설정값들의 유효성을 검증
+        ///       - MAC 주소가 비어있지 않은지 확인, 유효하지 않음 문자가 포함되어 있지 않는지, 양식에 맞는지
+        ///       - 브로드캐스트 IP가 비어있지 않은지 확인, IP 주소에 유효하지 않은 문자가 포함되어 있는지, 양식에 맞는지
+        ///       - 포트 번호가 유효한지 확인 (0 < port < 65535(UINT16_MAX))
+        ///       하나의 대상이라도 유효하지 않으면 전체 로드가 실패하며 대상 목록은 비워짐
+        /// @warning 모든 예외는 내부에서 처리되며 false 반환으로 오류 표시
+        [[nodiscard]] WolErrorCode LoadFromIni() noexcept;
+
+        /// @brief 설정 파일을 다시 읽어 바뀐 섹션만 반영
+        /// @param result 재사용/다시 검증/제외된 대상 수 출력
+        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        /// @details 설정 파일을 섹션 머리글 기준의 조각으로 나누고(IniFile::SplitSections()),
+        ///          원본 텍스트가 현재 스냅샷과 같은 조각(해시로 찾은 뒤 길이와 텍스트를 비교)의 대상은 해석과 검증 없이 그대로 재사용
+        ///          - 재사용한 IPv6 대상의 범위 ID는 다시 변환 (인터페이스가 다시 만들어지면 번호가 바뀜),
+        ///            범위에 해당하는 인터페이스가 없어졌다면 그 조각을 다시 해석하여 오류를 보고
+        ///          바뀌었거나 새로 추가된 조각만 IniFile로 해석하고 LoadTarget()으로 검증
+        ///          - 새 스냅샷은 별도로 만든 뒤 원자적으로 교체하므로 GetSnapshot()으로 얻은 스냅샷을 사용 중인 전송을 막지 않음
+        ///          - 패킷 캐시(MagicPacketCache)는 MAC 주소를 키로 사용하므로 재사용된 대상의 매직 패킷은 그대로 캐시에 남음
+        ///          - 현재 스냅샷이 없다면 모든 섹션을 새로 로드
+        /// @note 실패 시 현재 스냅샷은 바뀌지 않음 (잘못 수정된 설정 파일로 기존 대상이 사라지지 않음)
+        /// @warning 여러 스레드에서 동시에 호출하지 않아야 함 (GetSnapshot()은 동시에 호출 가능)
+        [[nodiscard]] WolErrorCode Reload(ConfigReloadResult& result) noexcept;
+
+        /// @brief 현재 스냅샷을 만든 뒤 설정 파일이 바뀌었는지 확인
+        /// @return 설정 파일의 수정 시각이나 크기가 현재 스냅샷과 다르면 true, 현재 스냅샷이 없어도 true
+        /// @details 설정 파일 감시는 이 함수를 주기적으로 호출하여 수행 (플랫폼별 파일 변경 알림 API는 사용하지 않음)
+        [[nodiscard]] bool IsModified() const noexcept;
+
+        /// @brief 현재 스냅샷을 반환
+        /// @return 현재 스냅샷, 로드된 설정이 없다면 nullptr
+        /// @details 다른 스레드의 Reload()와 동시에 호출 가능하며, 반환된 스냅샷은 교체된 뒤에도 유효함
+        [[nodiscard]] std::shared_ptr<const TargetSnapshot> GetSnapshot() const noexcept
+        {
+            return std::atomic_load(&mSnapshot);
+        }
+
+        /// @brief 로드된 대상 장치 목록을 반환
+        /// @return INI 파일의 섹션 순서대로 정렬된 대상 목록, 설정 파일이 유효하지 않다면 빈 목록을 반환함
+        /// @warning 반환된 참조는 다음 LoadFromIni()/Reload()/LoadDatabase() 호출 전까지만 유효
+        ///          다른 스레드에서 Reload()를 호출하는 경우 GetSnapshot()을 사용해야 함
+        [[nodiscard]] const std::vector<WolTarget>& GetTargets() const noexcept;
+
+        /// @brief 실행 파일 위치를 기반으로 설정 파일 절대 경로를 가져옴
+        ///	@param configFilePath 설정 파일의 전체 경로 (예: "C:\WOL\config.ini")
+        /// @return 설정 파일 절대 경로를 얻어올 수 있으면 WolErrorCode::Success, 아니라면 적절한 WolErrorCode 값
+        /// @details 현재 실행중인 프로그램의 디렉토리에서 config.ini 파일 경로 생성
+        ///          - GetModuleFileNameW API(Windows) 또는 /proc/self/exe(Linux)를 사용하여 실행 파일 경로 획득
+        ///          - 디렉토리 부분만 추출하여 설정 파일명과 결합
+        ///			 - 설정 파일 절대 경로를 얻는데 실패한 경우 configFilePath은 빈 문자열
+        /// @warning 반환된 경로의 파일 존재 여부는 별도로 확인 필요
+        [[nodiscard]] WolErrorCode GetConfigFilePath(std::wstring& configFilePath) const noexcept;
+
+        /// @brief 실행 파일 위치 대신 사용할 설정 파일 경로를 지정
+        /// @param configFilePath 설정 파일 경로 (상대 경로는 현재 작업 폴더 기준, 빈 문자열이면 실행 파일 위치 사용)
+        /// @note 이후 GetConfigFilePath()를 사용하는 모든 경로(데이터베이스, 제어 소켓)가 이 파일의 폴더를 기준으로 함
+        void SetConfigFilePath(std::wstring configFilePath) { mConfigFilePath = std::move(configFilePath); }
+
+        /// @brief 컴파일된 대상 데이터베이스를 로드
+        /// @param database 로드된 대상 데이터베이스 출력
+        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        /// @details 설정 파일과 같은 폴더의 CONFIG_DATABASE_FILE_NAME 파일이 설정 파일의 현재 수정 시각/크기로
+        ///          생성된 것이면 매핑하여 그대로 사용 (INI 해석과 MAC/IP 검증 생략)
+        ///          그렇지 않으면 LoadFromIni()로 설정 파일을 읽고 검증한 뒤 데이터베이스를 새로 생성하여 저장
+        ///          - 데이터베이스 파일 저장에 실패해도 메모리에 생성한 데이터베이스로 계속 진행
+        /// @note 데이터베이스 파일을 사용한 경우 GetTargets()는 빈 목록을 반환
+        [[nodiscard]] WolErrorCode LoadDatabase(TargetDatabase& database) noexcept;
+
+    private:
+        /// @brief 설정 파일을 읽어 새 스냅샷을 만듦
+        /// @param previous 재사용할 이전 스냅샷 (없으면 nullptr)
+        /// @param snapshot 새 스냅샷 출력
+        /// @param result 재사용/다시 검증/제외된 대상 수 출력
+        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        [[nodiscard]] WolErrorCode BuildSnapshot(const TargetSnapshot* previous,
+                                                 std::shared_ptr<const TargetSnapshot>& snapshot,
+                                                 ConfigReloadResult& result) const noexcept;
+
+        /// @brief 대상 장치 섹션인지 확인
+        /// @param name 섹션명
+        /// @return "Target" 또는 "Target."으로 시작하는 섹션이면 true
+        [[nodiscard]] bool IsTargetSection(std::wstring_view name) const noexcept;
+
+        /// @brief 섹션 조각의 원본 텍스트 해시를 계산 (FNV-1a)
+        [[nodiscard]] static std::uint64_t HashSectionText(std::string_view text) noexcept;
+
+        /// @brief 재사용한 대상들의 IPv6 범위 ID를 현재 네트워크 인터페이스 번호로 다시 변환
+        /// @param targets 대상 목록
+        /// @param first 변환할 첫 번째 대상의 위치 (이후 모든 대상을 변환, IPv4 대상은 건너뜀)
+        /// @return 모든 범위를 변환한 경우 true, 범위에 해당하는 인터페이스가 없는 대상이 있으면 false
+        [[nodiscard]] static bool RefreshScopeIds(std::vector<WolTarget>& targets, std::size_t first) noexcept;
+
+        /// @brief 설정 파일의 섹션 하나에서 대상 장치 설정을 로드
+        /// @param section 읽을 섹션
+        /// @param target 로드된 대상 장치 설정 출력
+        /// @return 설정 로드 및 유효성 검사 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        [[nodiscard]] WolErrorCode LoadTarget(const IniFile::Section& section, WolTarget& target) const;
+
+        /// @brief 로드된 설정 매개변수들의 유효성을 검증
+        /// @param target 검증할 대상 장치 설정
+        /// @return 모든 설정 매개변수가 유효한 경우 true, 그렇지 않으면 false
+        /// @details 포괄적인 검증 항목들:
+        ///          - MAC 주소: 길이, 형식, 유효 문자 검사
+        ///          - 브로드캐스트 IP: 길이, 형식, 유효 문자 검사
+        ///          - 포트 번호: 유효 범위 검사 (1-65535(UINT16_MAX))
+        /// @note 실제 네트워크 연결성이나 장치 존재 여부는 확인하지 않음
+        ///       형식적 유효성만을 검증하여 기본적인 오류를 사전 차단
+        [[nodiscard]] WolErrorCode IsConfigurationValid(const WolTarget& target) const noexcept;
+
+        /// @brief MAC 주소 형식의 유효성을 검증
+        /// @param macAddress 검증할 MAC 주소 문자열
+        /// @return MAC 주소가 유효한 형식인 경우 WolErrorCode::Success, 그렇지 않으면 WolErrorCode::InvalidMacAddress
+        /// @details ParseMacAddress()로 검증하고, 실패한 경우 오류 종류와 위치를 출력
+        ///          - "XX-XX-XX-XX-XX-XX", "XX:XX:XX:XX:XX:XX", "XXXX.XXXX.XXXX", "XXXXXXXXXXXX"
+        ///          - 여기서 X는 16진수 값 (0-9, A-F, a-f)
+        /// @note 대소문자를 구분하지 않으며, 혼합된 구분자는 허용하지 않음
+        [[nodiscard]] WolErrorCode IsValidMacAddress(std::wstring_view macAddress) const noexcept;
+
+        /// @brief IP 주소 형식의 유효성을 검증
+        /// @param broadcastIpAddress 검증할 브로드캐스트 Ip 주소 문자열
+        /// @return 브로드캐스트 Ip 주소가 유효한 IPv4 또는 IPv6 멀티캐스트 형식인 경우 WolErrorCode::Success, 그렇지 않으면 적절한 오류 코드
+        /// @details IPv4 주소 형식 검증:
+        ///          - "A.B.C.D" 형식 (점으로 구분된 4개의 8비트 값)
+        ///          - 각 옥텟은 0-255 범위의 정수
+        ///          - 선행 0은 허용하지 않음 (예: "01.02.03.04"는 무효)
+        ///          콜론(:)이 있으면 IPv6 멀티캐스트 주소로 검증 (ParseIpv6Multicast(), 예: "ff02::1%eth0")
+        /// @note 잠든 장치는 이웃 탐색(NDP)에 응답하지 않으므로 IPv6 유니캐스트 주소는 지원하지 않음
+        [[nodiscard]] WolErrorCode IsValidBroadcastIpAddress(std::wstring_view broadcastIpAddress) const noexcept;
+
+        /// @brif 브로드캐스트 Ip 주소의 개별 옥텟을 검증
+        ///	@param octet 검증할 옥텟 문자열 (예: "255")
+        ///	@return 유효하다면 WolErrorCode::success, 그렇지 않다면 적합한 WolErrorCode 값
+        [[nodiscard]] WolErrorCode IsValidateIpOctet(std::wstring_view octet) const noexcept;
+
+    private:
+#ifdef _WIN32
+        /// @brief Windows 경로의 최대 길이 제한
+        /// @details GetModuleFileNameW API에서 사용하는 경로 버퍼 크기
+        ///          Windows MAX_PATH 상수(260자)를 사용
+        /// @note 긴 경로는 지원하지 않음
+        static constexpr std::size_t MAX_PATH_LENGTH{MAX_PATH};
+#endif
+
+        /// @brief IP 주소의 최대 허용 길이
+        /// @details IPv4 주소의 최대 길이:
+        ///          - "255.255.255.255" (15자)
+        ///			 - 기본 15 + 1(null terminator)로 16자
+        static constexpr std::size_t IP_ADDRESS_LENGTH{16U};
+
+        /// @brief 최대 유효 포트 번호
+        /// @details TCP/UDP 포트 번호의 유효 범위: 1-65535
+        ///          0번 포트는 예약되어 있어 사용 불가
+        static constexpr std::uint32_t MAX_VALID_PORT{UINT16_MAX};
+
+        /// @brief 기본 WOL 포트
+        ///	@details 9번 포트가 WOL 시 일반적으로 사용되는 포트
+        static constexpr std::uint16_t DEFAULT_PORT{9U};
+
+        /// @brief 대상 섹션명 접두사
+        /// @details "Target" 섹션 또는 "Target."으로 시작하는 섹션을 대상 장치로 취급
+        static constexpr std::wstring_view TARGET_SECTION_PREFIX{L"Target"};
+
+        /// @brief 현재 스냅샷
+        /// @details 설정 파일이 유효하지 않거나 로드 전이라면 nullptr
+        ///          다른 스레드와 공유하므로 std::atomic_load() / std::atomic_store()로만 접근
+        std::shared_ptr<const TargetSnapshot> mSnapshot{};
+
+        /// @brief SetConfigFilePath()로 지정한 설정 파일 경로 (비어 있으면 실행 파일 위치 사용)
+        std::wstring mConfigFilePath{};
+    };
+
+    /// @brief WinSock SocketHandle 리소스를 RAII 방식으로 관리하는 클래스
+    /// @details 소멸자에서 closesocket()을 자동 호출하여 자원 누수를 방지
+    class Socket final
+    {
+    public:
+        // socket 유효한 SocketHandle 핸들 또는 INVALID_SOCKET_HANDLE (기본값)
+        /// @note 기본값은 INVALID_SOCKET이며, 이후 Set()으로 설정할 수 있음
+        explicit Socket(const SocketHandle& socket = INVALID_SOCKET_HANDLE) noexcept;
+
+        /// @brief 소멸자
+        /// @details 소켓이 유효하다면 closesocket() 호출 후 INVALID_SOCKET으로 초기화
+        ~Socket() noexcept;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        Socket(const Socket& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        Socket(Socket&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        Socket& operator=(const Socket& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        Socket& operator=(Socket&& other) noexcept = delete;
+
+        /// @brief 새로운 SocketHandle 값을 설정
+        /// @param socket 새로 할당받은 유효한 소켓 핸들
+        /// @note 이전 소켓이 열려 있다면 closesocket()으로 닫고 교체
+        void Set(const SocketHandle& socket) noexcept;
+
+        /// @brief 내부의 raw SocketHandle 핸들을 반환
+        [[nodiscard]] SocketHandle Get() const noexcept { return mSocket; }
+
+        /// @brief SocketHandle 핸들의 소유권을 포기하고 반환
+        /// @return 보관 중이던 SocketHandle 핸들, 이후 내부 핸들은 INVALID_SOCKET으로 초기화
+        /// @note 반환된 핸들은 호출자가 닫아야 함
+        [[nodiscard]] SocketHandle Release() noexcept;
+
+    private:
+        /// @brief 내부 소켓 핸들을 닫고 INVALID_SOCKET으로 초기화
+        /// @details 유효한 경우에만 closesocket()을 호출
+        void Close() noexcept;
+
+    private:
+        /// @brief WinSock에서 사용되는 SocketHandle 핸들
+        SocketHandle mSocket;
+    };
+
+    /// @brief WinSock 초기화/해제를 보장하는 RAII 유틸리티 클래스
+    /// @details WSAStartup()을 호출해 WinSock 환경을 초기화하고
+    ///			소멸자에서 WSACleanup()을 자동 호출
+    ///			단일 스레드 또는 모듈 내에서 중복 초기화를 방지하기 위해 참조 카운트를 사용
+    ///			POSIX 플랫폼에서는 소켓 라이브러리 초기화가 필요 없으므로 참조 카운트만 관리
+    class WsaGuard final
+    {
+    public:
+        /// @brief 기본 생성자
+        WsaGuard() noexcept = default;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        WsaGuard(const WsaGuard& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        WsaGuard(WsaGuard&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        WsaGuard& operator=(const WsaGuard& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        WsaGuard& operator=(WsaGuard&& other) noexcept = delete;
+
+        /// @brief 소멸자
+        /// @details Initialize()에 성공한 인스턴스만 참조 카운트를 감소시키고, 0이 되면 WSACleanup() 호출
+        ~WsaGuard() noexcept;
+
+        /// @brief WinSock 환경을 초기화합니다.
+        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 에러 코드
+        /// @note 참조 카운트를 증가시켜 중복 초기화를 안전하게 처리
+        ///       이미 초기화된 인스턴스에서 다시 호출하면 아무 작업도 하지 않음
+        WolErrorCode Initialize();
+
+    private:
+#ifdef _WIN32
+        /// @brief WSAStartup()에서 채워지는 구조체
+        WSADATA mWsaData{};
+#endif
+
+        /// @brief 이 인스턴스가 Initialize()에 성공했는지 여부
+        /// @note 초기화하지 않은 인스턴스가 소멸될 때 참조 카운트를 감소시키지 않도록 사용
+        bool mInitialized{false};
+
+        /// @brief 현재 활성화된 초기화 인스턴스의 수
+        /// @note 전역 정적 변수이며, Initialize() 성공 시 증가, 소멸자에서 감소
+        ///       여러 스레드의 세션(WakeOnLanAsyncSender의 전송 스레드 등)이 공유하므로 mRefCountMutex를 잡고 접근
+        static unsigned long long mRefCount;
+
+        /// @brief mRefCount와 WSAStartup()/WSACleanup() 호출을 보호하는 뮤텍스
+        /// @note 한 스레드의 WSACleanup()이 다른 스레드의 WSAStartup()과 겹쳐 열린 소켓이 무효화되지 않도록 함께 보호
+        static std::mutex mRefCountMutex;
+    };
+
+    /// @brief 매직 패킷의 동기화 헤더 (0xFF 6바이트)
+    inline constexpr std::array<std::byte, 6U> MAGIC_PACKET_HEADER{
+        std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}};
+
+    /// @brief 매직 패킷에서 MAC 주소를 반복하는 횟수
+    inline constexpr std::size_t MAGIC_PACKET_MAC_REPEAT_COUNT{16U};
+
+    static_assert(MAGIC_PACKET_HEADER.size() + (std::tuple_size_v<MacAddress> * MAGIC_PACKET_MAC_REPEAT_COUNT)
+                      == std::tuple_size_v<MagicPacket>,
+                  "매직 패킷은 6바이트 헤더와 MAC 주소 16회로 구성되어야 함");
+
+    /// @brief 매직 패킷을 생성
+    /// @param macBytes 대상 장치의 MAC 주소 바이트 배열
+    /// @param packet 생성된 매직 패킷(102바이트) 출력
+    /// @details 첫 6바이트는 0xFF 동기화 헤더로, 이후 MAC 주소를 16회 반복하여 패킷을 구성
+    ///          모든 복사 크기가 컴파일 시점 상수이므로 컴파일러가 MAC 주소를 레지스터에 한 번 읽고 저장 명령만 생성함
+    ///          (방금 쓴 메모리를 더 큰 폭으로 다시 읽으면 저장-적재 전달(store forwarding)이 실패하여 느려지므로
+    ///          중간 블록을 만들지 않고 패킷에 바로 기록, benchmarks/MagicPacketBenchmark.cpp 참고)
+    void CreateMagicPacket(const MacAddress& macBytes, MagicPacket& packet) noexcept;
+
+    /// @brief 여러 매직 패킷을 연속된 버퍼에 생성
+    /// @param macAddresses 대상 장치의 MAC 주소 배열의 첫 번째 요소
+    /// @param count 생성할 패킷 수
+    /// @param packets 생성된 매직 패킷 출력 (count개, 102바이트 간격으로 연속 배치)
+    /// @details 대량 전송 시 패킷 버퍼를 한 번에 채우기 위해 사용
+    void CreateMagicPackets(const MacAddress* const macAddresses, const std::size_t count,
+                            MagicPacket* const packets) noexcept;
+
+    /// @brief MAC 주소별로 완성된 매직 패킷을 보관하는 캐시
+    /// @details 같은 장치에 반복 전송할 때 패킷 생성을 건너뛰고 보관된 패킷을 복사만 하도록 함
+    ///          - 최근에 사용한 순서로 항목을 유지하고, 용량을 넘으면 가장 오래 사용하지 않은 항목을 제거(LRU)
+    ///          - 항목 하나는 패킷(102바이트)과 키, 목록/해시 노드를 합쳐 약 200바이트를 사용하므로
+    ///            기본 용량(DEFAULT_CAPACITY)에서 최대 약 800KB를 사용
+    class MagicPacketCache final
+    {
+    public:
+        /// @brief 생성자
+        /// @param capacity 보관할 최대 패킷 수 (0이면 보관하지 않고 매번 생성)
+        explicit MagicPacketCache(const std::size_t capacity = DEFAULT_CAPACITY) noexcept : mCapacity(capacity) {}
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        MagicPacketCache(const MagicPacketCache& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        MagicPacketCache(MagicPacketCache&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        MagicPacketCache& operator=(const MagicPacketCache& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        MagicPacketCache& operator=(MagicPacketCache&& other) noexcept = delete;
+
+        /// @brief 소멸자 - 기본 소멸자 사용
+        ~MagicPacketCache() noexcept = default;
+
+        /// @brief MAC 주소에 해당하는 매직 패킷을 반환
+        /// @param macAddress 대상 장치의 MAC 주소 바이트 배열
+        /// @param packet 매직 패킷(102바이트) 출력
+        /// @details 보관된 패킷이 없으면 새로 생성하여 보관
+        ///          보관에 실패(메모리 부족)하더라도 생성한 패킷은 그대로 출력
+        void GetPacket(const MacAddress& macAddress, MagicPacket& packet) noexcept;
+
+        /// @brief 보관할 최대 패킷 수를 설정
+        /// @param capacity 보관할 최대 패킷 수 (현재 항목 수보다 작으면 오래된 항목부터 제거)
+        void SetCapacity(std::size_t capacity) noexcept;
+
+        /// @brief 보관할 최대 패킷 수를 반환
+        [[nodiscard]] std::size_t GetCapacity() const noexcept { return mCapacity; }
+
+        /// @brief 현재 보관 중인 패킷 수를 반환
+        [[nodiscard]] std::size_t GetSize() const noexcept { return mEntries.size(); }
+
+        /// @brief 보관된 패킷을 사용한 횟수를 반환
+        [[nodiscard]] std::uint64_t GetHitCount() const noexcept { return mHitCount; }
+
+        /// @brief 패킷을 새로 생성한 횟수를 반환
+        [[nodiscard]] std::uint64_t GetMissCount() const noexcept { return mMissCount; }
+
+        /// @brief 용량 초과로 제거한 항목 수를 반환
+        [[nodiscard]] std::uint64_t GetEvictionCount() const noexcept { return mEvictionCount; }
+
+        /// @brief 보관된 모든 패킷을 제거 (통계 값은 유지)
+        void Clear() noexcept;
+
+        /// @brief 기본 최대 패킷 수
+        static constexpr std::size_t DEFAULT_CAPACITY{4096U};
+
+    private:
+        /// @brief 보관된 패킷 항목
+        struct Entry final
+        {
+            /// @brief MAC 주소를 정수로 변환한 키 (ToKey())
+            std::uint64_t mKey{0U};
+
+            /// @brief 완성된 매직 패킷
+            MagicPacket mPacket{};
+        };
+
+        /// @brief MAC 주소 6바이트를 해시 키로 사용할 정수로 변환
+        [[nodiscard]] static std::uint64_t ToKey(const MacAddress& macAddress) noexcept;
+
+        /// @brief 가장 오래 사용하지 않은 항목부터 항목 수가 capacity 이하가 될 때까지 제거
+        void EvictTo(std::size_t capacity) noexcept;
+
+    private:
+        /// @brief 보관할 최대 패킷 수
+        std::size_t mCapacity;
+
+        /// @brief 보관된 패킷 목록 (앞쪽일수록 최근에 사용)
+        std::list<Entry> mEntries;
+
+        /// @brief 키로 mEntries의 항목을 찾기 위한 색인
+        std::unordered_map<std::uint64_t, std::list<Entry>::iterator> mIndex;
+
+        /// @brief 보관된 패킷을 사용한 횟수
+        std::uint64_t mHitCount{0U};
+
+        /// @brief 패킷을 새로 생성한 횟수
+        std::uint64_t mMissCount{0U};
+
+        /// @brief 용량 초과로 제거한 항목 수
+        std::uint64_t mEvictionCount{0U};
+    };
+
+    /// @brief 일정한 속도로 채워지는 토큰 버킷
+    /// @details 초당 mRate개씩 토큰이 채워지며 최대 mCapacity개까지 모임
+    ///          토큰 하나당 패킷 하나를 보낼 수 있으므로, 오랫동안 보내지 않았더라도 한 번에 mCapacity개까지만 보낼 수 있음
+    ///          속도가 0이면 제한하지 않음
+    class TokenBucket final
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /// @brief 기본 생성자 (제한하지 않음)
+        TokenBucket() noexcept = default;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        TokenBucket(const TokenBucket& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        TokenBucket(TokenBucket&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        TokenBucket& operator=(const TokenBucket& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        TokenBucket& operator=(TokenBucket&& other) noexcept = delete;
+
+        /// @brief 소멸자 - 기본 소멸자 사용
+        ~TokenBucket() noexcept = default;
+
+        /// @brief 속도와 용량을 설정하고 버킷을 가득 채움
+        /// @param rate 초당 채워지는 토큰 수 (0이면 제한하지 않음)
+        /// @param capacity 최대 토큰 수 (1 이상)
+        /// @param now 현재 시각
+        void Reset(double rate, double capacity, Clock::time_point now) noexcept;
+
+        /// @brief 속도를 제한하는지 확인
+        [[nodiscard]] bool IsLimited() const noexcept { return mRate > 0.0; }
+
+        /// @brief 토큰이 하나 이상 있는지 확인 (now까지 채운 뒤 확인)
+        [[nodiscard]] bool HasToken(Clock::time_point now) noexcept;
+
+        /// @brief 토큰 하나를 사용
+        /// @pre HasToken()이 true를 반환한 직후여야 함
+        void Take() noexcept
+        {
+            assert(IsLimited() == false || mTokens >= 1.0);
+            mTokens -= 1.0;
+        }
+
+        /// @brief 토큰이 count개가 될 때까지 남은 시간을 반환 (이미 있거나 제한하지 않으면 0)
+        /// @param count 필요한 토큰 수 (용량보다 크면 용량까지만 기다림)
+        [[nodiscard]] Clock::duration GetWaitTime(double count = 1.0) const noexcept;
+
+        /// @brief 최대 토큰 수를 반환
+        [[nodiscard]] double GetCapacity() const noexcept { return mCapacity; }
+
+    private:
+        /// @brief 마지막으로 채운 뒤 지난 시간만큼 토큰을 채움
+        void Refill(Clock::time_point now) noexcept;
+
+    private:
+        /// @brief 초당 채워지는 토큰 수 (0이면 제한하지 않음)
+        double mRate{0.0};
+
+        /// @brief 최대 토큰 수
+        double mCapacity{0.0};
+
+        /// @brief 현재 토큰 수
+        double mTokens{0.0};
+
+        /// @brief 마지막으로 토큰을 채운 시각
+        Clock::time_point mLastRefill{};
+    };
+
+    /// @brief 매직 패킷 전송 속도 제한 설정
+    /// @details 수천 대를 한 번에 깨우면 동시에 전원이 들어와 PDU 차단기가 내려가거나
+    ///          스위치 CPU가 브로드캐스트로 포화될 수 있으므로 두 가지 토큰 버킷으로 전송 속도를 제한
+    ///          - 전체: 초당 패킷 수 (mPacketsPerSecond, 버킷 용량 mPacketBurst)
+    ///          - 랙별: 랙 하나에서 초당 켜지는 대상 수 (mRackHostsPerSecond, 버킷 용량 mRackBurst, Rack을 지정한 대상만)
+    ///          속도가 0이면 해당 제한을 사용하지 않으며, 버킷 용량이 0이면 초당 한도의 1/10(최소 1)을 사용
+    struct PacingPolicy final
+    {
+        /// @brief 초당 최대 패킷 수 (0이면 제한하지 않음)
+        double mPacketsPerSecond{0.0};
+
+        /// @brief 한 번에 연속으로 보낼 수 있는 최대 패킷 수 (0이면 자동)
+        std::uint32_t mPacketBurst{0U};
+
+        /// @brief 랙별 초당 최대 전송 대상 수 (0이면 제한하지 않음)
+        double mRackHostsPerSecond{0.0};
+
+        /// @brief 랙별로 한 번에 연속으로 보낼 수 있는 최대 대상 수 (0이면 자동)
+        std::uint32_t mRackBurst{0U};
+
+        /// @brief 제한을 하나라도 사용하는지 확인
+        [[nodiscard]] bool IsEnabled() const noexcept { return mPacketsPerSecond > 0.0 || mRackHostsPerSecond > 0.0; }
+    };
+
+    /// @brief 전송 속도 제한 통계 (제한 값을 조정할 때 참고)
+    struct PacingStats final
+    {
+        /// @brief 속도 제한을 거쳐 전송한 패킷 수
+        std::uint64_t mPacketsSent{0U};
+
+        /// @brief 한 번에 허용된 패킷 묶음(SendChunk() 호출로 나누기 전)의 수
+        std::uint64_t mBursts{0U};
+
+        /// @brief 가장 큰 패킷 묶음의 패킷 수
+        std::uint64_t mLargestBurst{0U};
+
+        /// @brief 전체 초당 패킷 수 한도 때문에 묶음을 끊은 횟수
+        std::uint64_t mPacketLimitHits{0U};
+
+        /// @brief 랙별 한도 때문에 패킷을 뒤로 미룬 횟수 (같은 패킷을 여러 번 미루면 각각 셈)
+        std::uint64_t mRackDeferrals{0U};
+
+        /// @brief 토큰이 채워지기를 기다린 횟수
+        std::uint64_t mWaits{0U};
+
+        /// @brief 토큰이 채워지기를 기다린 시간의 합
+        std::chrono::microseconds mWaitTime{0};
+    };
+
+    /// @brief 매직 패킷을 전송할 주소 (IPv4 브로드캐스트 또는 IPv6 멀티캐스트)
+    /// @details sendto()/sendmmsg()에 그대로 넘길 수 있도록 두 주소 구조체를 겹쳐 둠
+    ///          두 구조체 모두 주소 계열(sin_family, sin6_family)로 시작하므로 mIpv4.sin_family로 계열을 구분
+    union DestinationAddress
+    {
+        /// @brief IPv6 멀티캐스트 주소 (가장 큰 멤버를 먼저 선언하여 값 초기화 시 전체를 0으로 채움)
+        sockaddr_in6 mIpv6;
+
+        /// @brief IPv4 브로드캐스트 주소
+        sockaddr_in mIpv4;
+    };
+
+    /// @brief IPv6 주소인지 확인
+    [[nodiscard]] inline bool IsIpv6Destination(const DestinationAddress& destAddr) noexcept
+    {
+        return destAddr.mIpv4.sin_family == AF_INET6;
+    }
+
+    /// @brief 주소 계열에 맞는 주소 구조체의 크기를 반환 (sendto()의 주소 길이)
+    [[nodiscard]] inline int GetDestinationLength(const DestinationAddress& destAddr) noexcept
+    {
+        return IsIpv6Destination(destAddr) ? static_cast<int>(sizeof(sockaddr_in6)) : static_cast<int>(sizeof(sockaddr_in));
+    }
+
+    /// @brief 일괄 전송을 위해 미리 준비된 매직 패킷
+    /// @details 패킷 생성과 대상 주소 변환을 전송 전에 끝내 두어 전송 루프에서는 sendto()만 수행
+    struct WolPacket final
+    {
+        /// @brief 완성된 매직 패킷(102바이트)
+        MagicPacket mPacket{};
+
+        /// @brief 전송할 브로드캐스트 또는 멀티캐스트 주소
+        DestinationAddress mDestAddr{};
+
+        /// @brief 대상 장치가 설치된 랙 번호 (랙별 속도 제한용, 지정하지 않았다면 0)
+        std::uint16_t mRack{0U};
+    };
+
+    /// @brief 로컬 네트워크 인터페이스의 IPv4 주소 하나
+    /// @details 여러 네트워크에 연결된 장비에서 인터페이스마다 바인딩한 소켓으로 전송할 때 사용
+    struct NetworkInterface final
+    {
+        /// @brief 인터페이스 이름 (Linux: eth0 등, Windows: 어댑터 이름(이더넷 등))
+        std::wstring mName{};
+
+        /// @brief 인터페이스의 IPv4 주소 (네트워크 바이트 순서)
+        std::uint32_t mAddress{0U};
+    };
+
+    /// @brief 네트워크 인터페이스별 전송 결과
+    struct InterfaceSendStats final
+    {
+        /// @brief 전송한 인터페이스
+        NetworkInterface mInterface{};
+
+        /// @brief 인터페이스 소켓을 연 결과 (실패했다면 이 인터페이스로는 전송하지 않음)
+        WolErrorCode mOpenResult{WolErrorCode::Success};
+
+        /// @brief 전송에 성공한 패킷 수
+        std::uint64_t mPacketsSent{0U};
+
+        /// @brief 전송에 실패한 패킷 수
+        std::uint64_t mSendErrors{0U};
+
+        /// @brief 마지막으로 실패한 전송의 시스템 오류 코드 (Linux: errno, Windows: WSAGetLastError(), 실패가 없다면 0)
+        int mLastError{0};
+
+        /// @brief 인터페이스의 결과를 반환 (소켓을 열지 못했다면 그 오류, 전송에 실패한 패킷이 있다면 WolErrorCode::PacketSendFailed)
+        [[nodiscard]] WolErrorCode GetResult() const noexcept
+        {
+            if (mOpenResult != WolErrorCode::Success)
+                return mOpenResult;
+
+            return mSendErrors != 0U ? WolErrorCode::PacketSendFailed : WolErrorCode::Success;
+        }
+    };
+
+    /// @brief 지연 시간 분포 (마이크로초 단위 로그-선형 구간)
+    /// @details 16µs 미만은 1µs 단위, 그 이상은 2의 거듭제곱 구간마다 8개의 하위 구간으로 나누어 셈 (상대 오차 12.5% 이하)
+    ///          기록할 때 메모리를 할당하지 않으므로 전송 스레드에서 그대로 사용
+    class LatencyHistogram final
+    {
+    public:
+        /// @brief 지연 시간을 기록
+        /// @param latency 지연 시간
+        /// @param count 같은 지연 시간을 가진 항목 수 (묶음으로 전송한 패킷 수)
+        void Record(std::chrono::nanoseconds latency, std::uint64_t count = 1U) noexcept;
+
+        /// @brief 다른 분포를 더함
+        void Merge(const LatencyHistogram& other) noexcept;
+
+        /// @brief 백분위 지연 시간을 반환
+        /// @param percentile 백분위 (0 ~ 100)
+        /// @return 해당 항목이 속한 구간의 상한 (기록이 없다면 0)
+        [[nodiscard]] std::chrono::microseconds GetPercentile(double percentile) const noexcept;
+
+        /// @brief 가장 큰 지연 시간을 반환
+        [[nodiscard]] std::chrono::microseconds GetMax() const noexcept { return mMax; }
+
+        /// @brief 기록한 항목 수를 반환
+        [[nodiscard]] std::uint64_t GetCount() const noexcept { return mCount; }
+
+        /// @brief 마이크로초 값이 속하는 구간 번호를 반환
+        [[nodiscard]] static constexpr std::size_t GetBucketIndex(std::uint64_t micros) noexcept
+        {
+            if (micros < LINEAR_LIMIT)
+                return static_cast<std::size_t>(micros);
+
+            std::size_t exponent = 4U;
+            while (exponent < 63U && (micros >> (exponent + 1U)) != 0U)
+            {
+                ++exponent;
+            }
+
+            const auto subBucket = static_cast<std::size_t>((micros >> (exponent - 3U)) & (SUB_BUCKETS - 1U));
+            return LINEAR_LIMIT + ((exponent - 4U) * SUB_BUCKETS) + subBucket;
+        }
+
+        /// @brief 구간에 속하는 가장 큰 마이크로초 값을 반환
+        [[nodiscard]] static constexpr std::uint64_t GetBucketUpperBound(std::size_t index) noexcept
+        {
+            if (index < LINEAR_LIMIT)
+                return index;
+
+            const std::size_t exponent = 4U + ((index - LINEAR_LIMIT) / SUB_BUCKETS);
+            const std::uint64_t subBucket = (index - LINEAR_LIMIT) % SUB_BUCKETS;
+            const std::uint64_t next = SUB_BUCKETS + subBucket + 1U;
+            return exponent == 63U && subBucket == SUB_BUCKETS - 1U ? UINT64_MAX : (next << (exponent - 3U)) - 1U;
+        }
+
+        /// @brief 1µs 단위로 세는 범위
+        static constexpr std::uint64_t LINEAR_LIMIT{16U};
+
+        /// @brief 2의 거듭제곱 구간마다의 하위 구간 수
+        static constexpr std::uint64_t SUB_BUCKETS{8U};
+
+        /// @brief 전체 구간 수 (64비트 값 전체)
+        static constexpr std::size_t BUCKET_COUNT{LINEAR_LIMIT + ((64U - 4U) * SUB_BUCKETS)};
+
+    private:
+        /// @brief 구간별 항목 수
+        std::array<std::uint64_t, BUCKET_COUNT> mBuckets{};
+
+        /// @brief 기록한 항목 수
+        std::uint64_t mCount{0U};
+
+        /// @brief 가장 큰 지연 시간
+        std::chrono::microseconds mMax{0};
+    };
+
+    static_assert(LatencyHistogram::GetBucketIndex(15U) == 15U && LatencyHistogram::GetBucketIndex(16U) == 16U
+                      && LatencyHistogram::GetBucketIndex(17U) == 16U && LatencyHistogram::GetBucketIndex(18U) == 17U
+                      && LatencyHistogram::GetBucketIndex(UINT64_MAX) == LatencyHistogram::BUCKET_COUNT - 1U
+                      && LatencyHistogram::GetBucketUpperBound(16U) == 17U && LatencyHistogram::GetBucketUpperBound(23U) == 31U
+                      && LatencyHistogram::GetBucketIndex(LatencyHistogram::GetBucketUpperBound(100U)) == 100U
+                      && LatencyHistogram::GetBucketIndex(LatencyHistogram::GetBucketUpperBound(100U) + 1U) == 101U
+                      && LatencyHistogram::GetBucketUpperBound(LatencyHistogram::BUCKET_COUNT - 1U) == UINT64_MAX,
+                  "지연 시간 구간 계산이 잘못됨");
+
+    /// @brief 전송 스레드 하나의 전송 통계
+    struct SendWorkerStats final
+    {
+        /// @brief 전송에 성공한 패킷 수 (인터페이스를 지정했다면 인터페이스별 전송을 각각 셈)
+        std::uint64_t mPacketsSent{0U};
+
+        /// @brief 전송에 실패한 패킷 수
+        std::uint64_t mSendErrors{0U};
+
+        /// @brief 처리한 패킷 묶음 수
+        std::uint64_t mChunks{0U};
+
+        /// @brief 다른 스레드의 몫에서 가져와 처리한 패킷 묶음 수
+        std::uint64_t mStolenChunks{0U};
+
+        /// @brief 전송에 사용한 시간의 합 (스레드가 묶음을 처리하기 시작해서 더 가져올 묶음이 없을 때까지)
+        std::chrono::nanoseconds mActiveTime{0};
+
+        /// @brief 패킷별 대기열에 추가된 시각(일괄 전송 시작)부터 그 패킷의 전송 호출이 끝날 때까지의 시간
+        LatencyHistogram mLatency{};
+
+        /// @brief 초당 처리한 패킷 수 (전송에 사용한 시간 기준, 기록이 없다면 0)
+        [[nodiscard]] double GetPacketsPerSecond() const noexcept
+        {
+            const double seconds = std::chrono::duration<double>(mActiveTime).count();
+            return seconds > 0.0 ? static_cast<double>(mPacketsSent + mSendErrors) / seconds : 0.0;
+        }
+    };
+
+    /// @brief 사용할 수 있는 로컬 네트워크 인터페이스를 조회
+    /// @param interfaces 켜져 있고 브로드캐스트를 지원하는 인터페이스의 IPv4 주소 목록 출력 (루프백 제외)
+    /// @return 조회에 성공한 경우 WolErrorCode::Success, 실패한 경우 WolErrorCode::InterfaceNotFound
+    /// @details 주소가 여러 개인 인터페이스는 주소마다 항목 하나
+    ///          Linux: getifaddrs(), Windows: GetAdaptersAddresses()
+    [[nodiscard]] WolErrorCode GetNetworkInterfaces(std::vector<NetworkInterface>& interfaces) noexcept;
+
+    /// @brief 이름이나 주소로 네트워크 인터페이스를 선택
+    /// @param names 인터페이스 이름 또는 IPv4 주소 목록 ("all"이 있으면 모든 인터페이스, 대소문자 구분 없음)
+    /// @param selected 선택한 인터페이스 출력 (GetNetworkInterfaces()의 순서, 중복 없음)
+    /// @return 모든 이름에 해당하는 인터페이스를 찾은 경우 WolErrorCode::Success,
+    ///         찾지 못한 이름이 있거나 사용할 수 있는 인터페이스가 없으면 WolErrorCode::InterfaceNotFound
+    /// @details 이름이 같은 인터페이스의 주소가 여러 개이면 모두 선택
+    [[nodiscard]] WolErrorCode SelectNetworkInterfaces(const std::vector<std::wstring>& names,
+                                                       std::vector<NetworkInterface>& selected) noexcept;
+
+    /// @brief 데이터그램을 전송할 방식
+    enum class SendBackend : std::uint8_t
+    {
+        /// @brief 소켓 API로 전송 (Linux: sendmmsg(), 그 외: sendto())
+        Socket,
+
+        /// @brief io_uring 요청으로 전송 (Linux 전용, 사용할 수 없으면 Socket 방식으로 전송)
+        IoUring,
+    };
+
+    /// @brief 전송 방식의 이름을 반환 (--send-backend 값, 상주 서비스의 status 응답에 사용)
+    [[nodiscard]] constexpr std::wstring_view SendBackendToName(const SendBackend backend) noexcept
+    {
+        return backend == SendBackend::IoUring ? L"io_uring" : L"socket";
+    }
+
+    /// @brief io_uring 제출/완료 큐로 데이터그램을 전송하는 클래스 (WakeOnLanInternal.h에 정의)
+    class IoUringQueue;
+
+    /// @brief 초기화된 브로드캐스트 소켓을 유지하며 매직 패킷을 반복 전송하는 세션 클래스
+    /// @details WinSock 초기화(WsaGuard)와 소켓 생성, SO_BROADCAST/SIO_UDP_CONNRESET 설정을
+    ///          Open()에서 한 번만 수행하고, 이후 Send()는 패킷 조회(MagicPacketCache)와 sendto() 호출만 수행
+    ///          - 여러 대상에게 연속으로 전송하거나 프로그램에 포함하여 반복 전송할 때 사용
+    ///          - SetPacing()으로 전송 속도를 제한하면 Send()와 SendBatch()는 토큰이 채워질 때까지 기다리며 전송
+    ///          - SetInterfaces()로 네트워크 인터페이스를 지정하면 인터페이스마다 그 주소에 바인딩한 소켓으로
+    ///            모든 패킷을 전송 (여러 네트워크에 연결된 장비에서 255.255.255.255가 한 인터페이스로만 나가는 문제 방지)
+    ///          - 세션이 소멸될 때 소켓을 닫고 WsaGuard 참조 카운트를 감소시킴
+    class WakeOnLanSession final
+    {
+    public:
+        /// @brief 기본 생성자
+        /// @details 소켓은 Open()을 호출하기 전까지 생성되지 않음
+        WakeOnLanSession() noexcept;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        WakeOnLanSession(const WakeOnLanSession& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        WakeOnLanSession(WakeOnLanSession&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        WakeOnLanSession& operator=(const WakeOnLanSession& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        WakeOnLanSession& operator=(WakeOnLanSession&& other) noexcept = delete;
+
+        /// @brief 소멸자 - 기본 소멸자 사용
+        /// @details 멤버 선언의 역순으로 소켓이 먼저 닫힌 뒤 WinSock 환경이 정리됨
+        ///          (IoUringQueue와 SendWorker가 정의된 WakeOnLan.cpp에서 정의)
+        ~WakeOnLanSession() noexcept;
+
+        /// @brief WinSock을 초기화하고 브로드캐스트 전송용 UDP 소켓을 생성
+        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        /// @note 이미 열린 세션에서 다시 호출하면 아무 작업도 하지 않음
+        [[nodiscard]] WolErrorCode Open() noexcept;
+
+        /// @brief 세션이 열려 있는지 확인
+        /// @return Open()에 성공한 경우 true
+        [[nodiscard]] bool IsOpen() const noexcept { return mSocket.Get() != INVALID_SOCKET_HANDLE; }
+
+        /// @brief 매직 패킷 하나를 전송
+        /// @param macAddress 대상 장치의 MAC 주소 바이트 배열
+        /// @param destAddr 전송할 브로드캐스트 또는 멀티캐스트 주소 (WakeOnLanSender::SetupDestination()으로 설정)
+        /// @param rack 대상 장치가 설치된 랙 번호 (랙별 속도 제한용, 0이면 전체 제한만 적용)
+        /// @return 전송에 성공한 경우 WolErrorCode::Success, 실패한 경우 적절한 WolErrorCode 값
+        /// @pre Open()에 성공한 세션이어야 함
+        [[nodiscard]] WolErrorCode Send(const MacAddress& macAddress, const DestinationAddress& destAddr,
+                                        std::uint16_t rack = 0U) noexcept;
+
+        /// @brief 미리 준비된 매직 패킷들을 일괄 전송
+        /// @param packets 전송할 패킷 목록
+        /// @param results 패킷별 전송 결과 출력 (packets와 같은 순서, 같은 크기)
+        /// @return 결과 목록을 준비한 경우 WolErrorCode::Success, 실패한 경우 적절한 WolErrorCode 값
+        /// @details 패킷 목록을 GetBatchSize() 크기의 묶음으로 나누어 SendChunk()로 전송
+        ///          개별 패킷의 전송 실패는 results에 기록하고 나머지 패킷의 전송을 계속함
+        ///          전송 속도를 제한하는 경우 SendPaced()로 전송
+        /// @pre Open()에 성공한 세션이어야 함
+        [[nodiscard]] WolErrorCode SendBatch(const std::vector<WolPacket>& packets,
+                                             std::vector<WolErrorCode>& results) noexcept;
+
+        /// @brief 한 번에 전송할 패킷 묶음의 크기를 설정
+        /// @param batchSize 묶음 크기 (1 ~ MAX_BATCH_SIZE 범위로 보정됨)
+        void SetBatchSize(std::size_t batchSize) noexcept;
+
+        /// @brief 한 번에 전송할 패킷 묶음의 크기를 반환
+        [[nodiscard]] std::size_t GetBatchSize() const noexcept { return mBatchSize; }
+
+        /// @brief 전송 속도 제한을 설정하고 통계를 초기화
+        /// @param policy 속도 제한 설정 (IsEnabled()가 false이면 제한하지 않음)
+        void SetPacing(const PacingPolicy& policy) noexcept;
+
+        /// @brief 전송 속도 제한 설정을 반환
+        [[nodiscard]] const PacingPolicy& GetPacing() const noexcept { return mPacing; }
+
+        /// @brief 전송 속도 제한 통계를 반환
+        [[nodiscard]] const PacingStats& GetPacingStats() const noexcept { return mPacingStats; }
+
+        /// @brief 패킷을 전송할 네트워크 인터페이스를 설정
+        /// @param interfaces 전송할 인터페이스 목록 (비어 있으면 운영체제가 경로에 따라 인터페이스를 선택)
+        /// @details 인터페이스마다 그 주소에 바인딩한 소켓을 Open()에서 만들고, 모든 패킷을 각 인터페이스로 한 번씩 전송
+        ///          - 인터페이스들은 별도의 스레드에서 동시에 전송
+        ///          - 패킷은 하나 이상의 인터페이스로 전송에 성공하면 성공으로 간주하고, 인터페이스별 결과는 GetInterfaceStats()로 확인
+        ///          - 전송 속도 제한은 인터페이스마다 적용 (인터페이스 하나의 전송 속도가 제한 값을 넘지 않음)
+        /// @throw std::bad_alloc 목록을 복사할 메모리를 할당하지 못한 경우
+        /// @pre Open()을 호출하기 전이어야 함
+        void SetInterfaces(const std::vector<NetworkInterface>& interfaces);
+
+        /// @brief 네트워크 인터페이스별 전송 결과를 반환 (SetInterfaces()의 순서, 지정하지 않았다면 비어 있음)
+        [[nodiscard]] const std::vector<InterfaceSendStats>& GetInterfaceStats() const noexcept { return mInterfaceStats; }
+
+        /// @brief 패킷을 전송할 방식을 설정
+        /// @param backend 전송 방식 (SendBackend::IoUring을 사용할 수 없으면 Open()에서 SendBackend::Socket으로 대체)
+        /// @pre Open()을 호출하기 전이어야 함
+        void SetSendBackend(const SendBackend backend) noexcept
+        {
+            assert(IsOpen() == false);
+            mSendBackend = backend;
+        }
+
+        /// @brief 실제로 사용하는 전송 방식을 반환
+        /// @details io_uring을 사용할 수 없거나 전송 중 io_uring 오류로 소켓 API로 바꾼 경우 SendBackend::Socket
+        [[nodiscard]] SendBackend GetActiveSendBackend() const noexcept;
+
+        /// @brief 일괄 전송에 사용할 스레드 수를 설정
+        /// @param threadCount 스레드 수 (1 ~ MAX_SEND_THREADS 범위로 보정됨)
+        /// @details 2 이상이면 Open()에서 스레드마다 자신의 소켓(인터페이스를 지정했다면 인터페이스마다 하나씩)과 io_uring 큐를 만들고,
+        ///          일괄 전송할 패킷 묶음들을 스레드 수만큼의 몫으로 나누어 동시에 전송
+        ///          - 자신의 몫을 끝낸 스레드는 다른 스레드의 몫에서 남은 묶음을 가져와 전송 (느린 인터페이스나 서브넷이 있어도 쉬는 스레드가 없음)
+        ///          - 1이면 인터페이스를 지정한 경우에만 인터페이스마다 스레드 하나로 전송
+        /// @pre Open()을 호출하기 전이어야 함
+        void SetSendThreads(std::size_t threadCount) noexcept;
+
+        /// @brief 일괄 전송에 사용할 스레드 수를 반환
+        [[nodiscard]] std::size_t GetSendThreads() const noexcept { return mSendThreads; }
+
+        /// @brief 전송 스레드별 통계를 반환 (일괄 전송에 사용한 적이 있는 스레드까지, 0번은 호출한 스레드)
+        [[nodiscard]] const std::vector<SendWorkerStats>& GetWorkerStats() const noexcept { return mWorkerStats; }
+
+        /// @brief MAC 주소에 해당하는 매직 패킷을 반환
+        /// @param macAddress 대상 장치의 MAC 주소 바이트 배열
+        /// @param packet 매직 패킷(102바이트) 출력
+        /// @details 세션의 패킷 캐시에서 찾고, 없으면 생성하여 보관
+        void GetMagicPacket(const MacAddress& macAddress, MagicPacket& packet) noexcept
+        {
+            mPacketCache.GetPacket(macAddress, packet);
+        }
+
+        /// @brief 세션의 매직 패킷 캐시를 반환 (용량 설정 및 적중/생성 횟수 조회용)
+        [[nodiscard]] MagicPacketCache& GetPacketCache() noexcept { return mPacketCache; }
+
+        /// @brief 세션의 매직 패킷 캐시를 반환 (적중/생성 횟수 조회용)
+        [[nodiscard]] const MagicPacketCache& GetPacketCache() const noexcept { return mPacketCache; }
+
+        /// @brief 기본 패킷 묶음 크기
+        static constexpr std::size_t DEFAULT_BATCH_SIZE{64U};
+
+        /// @brief 최대 패킷 묶음 크기
+        /// @details 한 번의 시스템 호출로 넘길 수 있는 메시지 수의 일반적인 상한(UIO_MAXIOV)
+        static constexpr std::size_t MAX_BATCH_SIZE{1024U};
+
+        /// @brief IPv6 멀티캐스트 패킷의 홉 제한
+        static constexpr int IPV6_MULTICAST_HOP_LIMIT{64};
+
+        /// @brief io_uring 제출 큐의 크기
+        /// @details 링 메모리가 RLIMIT_MEMLOCK(기본 64KiB)에 포함되는 커널(5.12 미만)에서도 만들 수 있는 크기
+        ///          묶음이 더 크면 나누어 제출
+        static constexpr unsigned int IO_URING_ENTRIES{256U};
+
+        /// @brief 최대 전송 스레드 수
+        static constexpr std::size_t MAX_SEND_THREADS{64U};
+
+    private:
+        /// @brief 호출한 스레드(0번) 외의 전송 스레드가 사용하는 소켓과 io_uring 큐 (WakeOnLan.cpp에 정의)
+        struct SendWorker;
+
+        /// @brief 전송 스레드 하나의 몫 (다른 스레드가 가져갈 수 있도록 다음 항목 위치를 원자적으로 증가)
+        /// @details 스레드마다 다른 캐시 라인을 사용하도록 크기와 정렬을 64바이트로 맞춤
+        struct alignas(64) SendShard final
+        {
+            /// @brief 다음에 처리할 항목 위치
+            std::atomic<std::size_t> mNext{0U};
+
+            /// @brief 몫의 끝 위치 (포함하지 않음)
+            std::size_t mEnd{0U};
+
+            /// @brief 64바이트로 맞추기 위한 여백
+            std::array<std::byte, 64U - sizeof(std::atomic<std::size_t>) - sizeof(std::size_t)> mPadding{};
+        };
+
+        /// @brief 패킷들을 mBatchSize 크기의 묶음으로 나누어 전송
+        /// @param packets 전송할 패킷 목록의 첫 번째 패킷
+        /// @param count 패킷 수
+        /// @param results 패킷별 전송 결과 출력 (count개)
+        /// @details (경로, 묶음) 항목들을 전송 스레드 수만큼의 연속된 몫으로 나누고 스레드마다 자신의 몫부터 전송
+        ///          - 경로는 인터페이스를 지정하지 않았다면 세션 소켓 하나, 지정했다면 열린 인터페이스마다 하나와 IPv6 대상용 하나
+        ///          - mSendThreads가 2 이상이면 스레드마다 자신의 소켓과 큐를 사용하고, 자신의 몫을 끝내면 다른 몫의 남은 항목을 가져옴
+        ///          - mSendThreads가 1이면 경로마다 스레드 하나가 그 경로의 소켓과 큐로 전송 (소켓과 큐를 공유하지 않도록 가져오지 않음)
+        ///          - 하나 이상의 경로로 전송한 패킷을 성공으로 기록
+        /// @throw std::bad_alloc 경로별 결과 목록이나 스레드별 통계를 할당하지 못한 경우
+        void SendPackets(const WolPacket* packets, std::size_t count, WolErrorCode* results);
+
+        /// @brief 패킷 묶음 하나를 전송
+        /// @param ipv4Socket IPv4 패킷을 전송할 소켓
+        /// @param ipv6Socket IPv6 패킷을 전송할 소켓
+        /// @param queue 전송에 사용할 io_uring 큐 (열려 있지 않으면 소켓 API로 전송)
+        /// @param packets 전송할 패킷 묶음의 첫 번째 패킷
+        /// @param count 묶음의 패킷 수 (1 ~ mBatchSize)
+        /// @param results 패킷별 전송 결과 출력 (count개, 소켓이 INVALID_SOCKET인 주소 계열의 패킷은 WolErrorCode::SocketCreationFailed)
+        /// @return 마지막으로 실패한 전송의 시스템 오류 코드 (실패가 없다면 0)
+        /// @details Linux에서는 주소 계열이 같은 연속된 패킷을 io_uring 요청으로 한꺼번에 제출하거나
+        ///          (큐가 열려 있는 경우) sendmmsg() 한 번의 시스템 호출로 전송
+        ///          WinSock에는 여러 데이터그램을 한 번에 전송하는 API(sendmmsg)가 없으므로
+        ///          준비된 버퍼를 순서대로 sendto()로 전송
+        ///          서로 다른 소켓과 큐로는 여러 스레드에서 동시에 호출할 수 있음
+        int SendChunk(SocketHandle ipv4Socket, SocketHandle ipv6Socket, IoUringQueue& queue,
+                      const WolPacket* packets, std::size_t count, WolErrorCode* results) const noexcept;
+
+        /// @brief IPv6 멀티캐스트 전송용 소켓을 반환 (처음 호출할 때 생성)
+        /// @param socket 전송 스레드의 IPv6 소켓 (세션의 mSocket6 또는 SendWorker::mSocket6)
+        /// @return IPv6 소켓, IPv6를 사용할 수 없는 환경이면 INVALID_SOCKET_HANDLE (이후 다시 만들지 않음)
+        [[nodiscard]] SocketHandle GetIpv6Socket(Socket& socket) noexcept;
+
+        /// @brief SO_BROADCAST를 설정한 UDP 소켓을 생성
+        /// @param socket 생성된 소켓 출력
+        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        [[nodiscard]] WolErrorCode OpenBroadcastSocket(Socket& socket) const noexcept;
+
+        /// @brief 전송 스레드 하나의 소켓과 io_uring 큐를 생성
+        /// @param worker 생성한 소켓과 큐 출력
+        /// @param useIoUring io_uring 큐를 열지 여부
+        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        /// @details 세션에서 열지 못한 인터페이스의 소켓은 만들지 않음 (nullptr)
+        /// @throw std::bad_alloc 인터페이스별 소켓 목록을 할당하지 못한 경우
+        [[nodiscard]] WolErrorCode OpenWorker(SendWorker& worker, bool useIoUring) const;
+
+        /// @brief 네트워크 인터페이스 주소에 바인딩한 브로드캐스트 소켓을 생성
+        /// @param networkInterface 바인딩할 인터페이스
+        /// @param socket 생성된 소켓 출력
+        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        /// @details 원본 주소가 인터페이스 주소로 정해지면 255.255.255.255도 그 인터페이스로 전송됨
+        ///          (Linux와 Windows 모두 제한 브로드캐스트의 출력 인터페이스를 원본 주소로 선택)
+        [[nodiscard]] WolErrorCode OpenInterfaceSocket(const NetworkInterface& networkInterface,
+                                                       Socket& socket) const noexcept;
+
+        /// @brief 전송 속도 제한에 따라 패킷들을 나누어 전송
+        /// @param packets 전송할 패킷 목록
+        /// @param results 패킷별 전송 결과 (packets와 같은 크기로 준비된 상태)
+        /// @details 토큰이 있는 만큼의 패킷을 목록 순서대로 모아 하나의 묶음으로 SendChunk()에 넘기고,
+        ///          보낼 수 있는 패킷이 없으면 가장 먼저 토큰이 채워질 때까지 기다림
+        ///          랙 토큰이 없는 패킷은 건너뛰고(뒤로 미루고) 다른 랙의 패킷을 먼저 보냄
+        void SendPaced(const std::vector<WolPacket>& packets, std::vector<WolErrorCode>& results);
+
+        /// @brief 랙의 토큰 버킷을 반환 (처음 사용하는 랙이면 가득 찬 버킷을 생성)
+        [[nodiscard]] TokenBucket& GetRackBucket(std::uint16_t rack, TokenBucket::Clock::time_point now);
+
+        /// @brief 패킷 하나를 보낼 수 있을 때까지 기다린 뒤 토큰을 사용 (Send()용)
+        /// @param rack 대상 장치가 설치된 랙 번호 (0이면 전체 제한만 적용)
+        void WaitForToken(std::uint16_t rack);
+
+        /// @brief 지정한 시간 동안 기다리고 통계에 기록
+        void WaitFor(TokenBucket::Clock::duration wait);
+
+        /// @brief UDP 소켓을 초기화
+        /// @param socket 생성된 소켓 핸들이 저장될 변수
+        /// @param family 주소 계열 (AF_INET 또는 AF_INET6)
+        /// @return 초기화 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        /// @note SOCK_DGRAM, IPPROTO_UDP 옵션으로 소켓을 생성합니다.
+        [[nodiscard]] WolErrorCode InitializeSocket(Socket& socket, int family = AF_INET) const noexcept;
+
+    private:
+        /// @brief 세션이 유지되는 동안 WinSock 환경을 유지
+        /// @note 소켓보다 먼저 선언하여 소켓이 닫힌 뒤에 WSACleanup()이 호출되도록 함
+        WsaGuard mWsaGuard;
+
+        /// @brief SO_BROADCAST가 설정된 UDP 소켓
+        Socket mSocket;
+
+        /// @brief IPv6 멀티캐스트 전송용 UDP 소켓 (IPv6 대상에게 처음 전송할 때 생성)
+        Socket mSocket6;
+
+        /// @brief IPv6 소켓을 만들 수 없는 환경인지 여부 (실패를 반복해서 출력하지 않도록 사용)
+        bool mIpv6Unavailable{false};
+
+        /// @brief 한 번에 전송할 패킷 묶음의 크기
+        std::size_t mBatchSize{DEFAULT_BATCH_SIZE};
+
+        /// @brief MAC 주소별 완성된 매직 패킷
+        MagicPacketCache mPacketCache;
+
+        /// @brief 전송 속도 제한 설정
+        PacingPolicy mPacing{};
+
+        /// @brief 전체 초당 패킷 수 제한
+        TokenBucket mPacketBucket;
+
+        /// @brief 랙 번호별 초당 대상 수 제한
+        std::unordered_map<std::uint16_t, TokenBucket> mRackBuckets{};
+
+        /// @brief 전송 속도 제한 통계
+        PacingStats mPacingStats{};
+
+        /// @brief 네트워크 인터페이스별 전송 결과 (SetInterfaces()의 순서)
+        std::vector<InterfaceSendStats> mInterfaceStats{};
+
+        /// @brief 네트워크 인터페이스별 바인딩한 소켓 (mInterfaceStats와 같은 순서, 열지 못한 인터페이스는 nullptr)
+        std::vector<std::unique_ptr<Socket>> mInterfaceSockets{};
+
+        /// @brief 요청한 전송 방식
+        SendBackend mSendBackend{SendBackend::Socket};
+
+        /// @brief 세션 소켓(mSocket, mSocket6)으로 전송할 때 사용하는 io_uring 큐 (Open()에서 생성)
+        std::unique_ptr<IoUringQueue> mIoUring{};
+
+        /// @brief 네트워크 인터페이스별 io_uring 큐 (mInterfaceSockets와 같은 순서, 인터페이스 스레드마다 자신의 큐만 사용)
+        std::vector<std::unique_ptr<IoUringQueue>> mInterfaceQueues{};
+
+        /// @brief 일괄 전송에 사용할 스레드 수
+        std::size_t mSendThreads{1U};
+
+        /// @brief 1번부터의 전송 스레드가 사용하는 소켓과 큐 (mSendThreads가 2 이상일 때 mSendThreads - 1개, 0번은 세션의 소켓과 큐)
+        std::vector<std::unique_ptr<SendWorker>> mWorkers{};
+
+        /// @brief 전송 스레드별 통계
+        std::vector<SendWorkerStats> mWorkerStats{};
+    };
+
+    ///	@brief WOL 패킷 전송 클래스
+    /// @details 설정 파일의 문자열 값을 바이너리 값으로 변환한 뒤 WakeOnLanSession으로 전송
+    class WakeOnLanSender final
+    {
+    public:
+        /// @brief 기본 생성자
+        WakeOnLanSender() noexcept = default;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        WakeOnLanSender(const WakeOnLanSender& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        WakeOnLanSender(WakeOnLanSender&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        WakeOnLanSender& operator=(const WakeOnLanSender& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        WakeOnLanSender& operator=(WakeOnLanSender&& other) noexcept = delete;
+
+        /// @brief 소멸자 - 기본 소멸자 사용
+        ~WakeOnLanSender() noexcept = default;
+
+        ///	@brief WOL 매직 패킷을 전송합니다.
+        ///	@param macAddress 대상 장치의 MAC 주소 (예: "00:11:22:AA:BB:CC")
+        ///	@param broadcastAddress 브로드캐스트 주소
+        ///	@param port 포트 번호
+        ///	@return 전송에 성공한 경우 WolErrorCode::Success, 실패한 경우 적절한 WolErrorCode 값
+        /// @note 호출할 때마다 세션을 새로 열고 닫음. 반복 전송 시에는 WakeOnLanSession을 직접 사용
+        [[nodiscard]] WolErrorCode SendMagicPacket(std::wstring_view macAddress,
+                                                   std::wstring_view broadcastAddress,
+                                                   std::uint16_t port) const noexcept;
+
+        ///	@brief 여러 대상 장치에 WOL 매직 패킷을 전송합니다.
+        ///	@param targets 매직 패킷을 전송할 대상 장치 목록
+        ///	@param results 대상별 전송 결과 출력 (targets와 같은 순서, 같은 크기)
+        ///	@return WinSock 초기화 및 소켓 생성에 성공한 경우 WolErrorCode::Success, 실패한 경우 적절한 WolErrorCode 값
+        /// @details 세션을 한 번만 열고 같은 소켓으로 모든 대상에게 전송
+        ///          개별 대상의 전송 실패는 results에 기록하고 나머지 대상의 전송을 계속함
+        [[nodiscard]] WolErrorCode SendMagicPackets(const std::vector<WolTarget>& targets,
+                                                    std::vector<WolErrorCode>& results) const noexcept;
+
+        ///	@brief 이미 열린 세션으로 여러 대상 장치에 WOL 매직 패킷을 전송합니다.
+        /// @param session Open()에 성공한 세션
+        ///	@param targets 매직 패킷을 전송할 대상 장치 목록
+        ///	@param results 대상별 전송 결과 출력 (targets와 같은 순서, 같은 크기)
+        ///	@return 결과 목록을 준비한 경우 WolErrorCode::Success, 실패한 경우 적절한 WolErrorCode 값
+        [[nodiscard]] WolErrorCode SendMagicPackets(WakeOnLanSession& session,
+                                                    const std::vector<WolTarget>& targets,
+                                                    std::vector<WolErrorCode>& results) const noexcept;
+
+        ///	@brief 컴파일된 대상 데이터베이스의 모든 대상 장치에 WOL 매직 패킷을 전송합니다.
+        ///	@param database 매직 패킷을 전송할 대상 데이터베이스
+        ///	@param results 대상별 전송 결과 출력 (데이터베이스의 레코드 순서, 같은 크기)
+        ///	@return WinSock 초기화 및 소켓 생성에 성공한 경우 WolErrorCode::Success, 실패한 경우 적절한 WolErrorCode 값
+        [[nodiscard]] WolErrorCode SendMagicPackets(const TargetDatabase& database,
+                                                    std::vector<WolErrorCode>& results) const noexcept;
+
+        ///	@brief 이미 열린 세션으로 컴파일된 대상 데이터베이스의 모든 대상 장치에 WOL 매직 패킷을 전송합니다.
+        /// @param session Open()에 성공한 세션
+        ///	@param database 매직 패킷을 전송할 대상 데이터베이스
+        ///	@param results 대상별 전송 결과 출력 (데이터베이스의 레코드 순서, 같은 크기)
+        ///	@return 결과 목록을 준비한 경우 WolErrorCode::Success, 실패한 경우 적절한 WolErrorCode 값
+        [[nodiscard]] WolErrorCode SendMagicPackets(WakeOnLanSession& session,
+                                                    const TargetDatabase& database,
+                                                    std::vector<WolErrorCode>& results) const noexcept;
+
+        /// @brief 브로드캐스트 대상 주소를 설정
+        /// @param broadcastAddress 브로드캐스트 주소 (네트워크 바이트 순서)
+        /// @param port 대상 포트 번호 (1~65535)
+        /// @param destAddr 설정된 sockaddr_in 구조체 출력
+        void SetupBroadcastAddress(const in_addr& broadcastAddress, std::uint16_t port,
+                                   sockaddr_in& destAddr) const noexcept;
+
+        /// @brief 대상 주소를 설정 (IPv6 멀티캐스트 그룹이 지정되었다면 IPv6, 아니면 IPv4 브로드캐스트)
+        /// @param broadcastAddress IPv4 브로드캐스트 주소 (네트워크 바이트 순서)
+        /// @param multicast IPv6 멀티캐스트 그룹과 범위 ID
+        /// @param port 대상 포트 번호 (1~65535)
+        /// @param destAddr 설정된 대상 주소 출력
+        void SetupDestination(const in_addr& broadcastAddress, const Ipv6Multicast& multicast,
+                              std::uint16_t port, DestinationAddress& destAddr) const noexcept;
+
+        /// @brief 대상 장치 설정으로 전송할 매직 패킷을 준비
+        /// @param session 매직 패킷을 조회할 세션 (세션의 패킷 캐시 사용)
+        /// @param target 대상 장치 설정 (WolConfig에서 변환한 바이너리 값 사용)
+        /// @param packet 완성된 매직 패킷과 대상 주소 출력
+        void PreparePacket(WakeOnLanSession& session, const WolTarget& target,
+                           WolPacket& packet) const noexcept;
+
+        /// @brief 대상 데이터베이스의 레코드로 전송할 매직 패킷을 준비
+        /// @param session 매직 패킷을 조회할 세션 (세션의 패킷 캐시 사용)
+        /// @param record 대상 데이터베이스의 레코드
+        /// @param packet 완성된 매직 패킷과 대상 주소 출력
+        void PreparePacket(WakeOnLanSession& session, const TargetDatabase::Record& record,
+                           WolPacket& packet) const noexcept;
+
+    private:
+        /// @brief 준비된 패킷들을 목적지(브로드캐스트 또는 멀티캐스트 주소, 포트)별로 모아 전송
+        /// @param session Open()에 성공한 세션
+        /// @param packets 전송할 패킷 목록
+        /// @param results 패킷별 전송 결과 출력 (packets의 원래 순서, 같은 크기)
+        /// @return 결과 목록을 준비한 경우 WolErrorCode::Success, 실패한 경우 적절한 WolErrorCode 값
+        /// @details 여러 서브넷(VLAN)의 대상이 섞여 있어도 브로드캐스트 도메인마다 하나의 연속된 일괄 전송이 되도록
+        ///          목적지가 처음 나타난 순서를 유지하며 안정적으로 재배치 (계수 정렬, O(n))
+        ///          이미 목적지별로 모여 있으면 재배치하지 않음
+        ///          IPv6 목적지는 (인터페이스 수 정도로) 적으므로 해시 대신 목록에서 순차 검색
+        /// @throw std::bad_alloc 재배치용 메모리를 할당하지 못한 경우
+        [[nodiscard]] WolErrorCode SendGroupedByDestination(WakeOnLanSession& session,
+                                                            const std::vector<WolPacket>& packets,
+                                                            std::vector<WolErrorCode>& results) const;
+    };
+
+    /// @brief 매직 패킷을 보낸 뒤 대상 장치가 켜졌는지 확인하는 방법
+    enum class ProbeMethod : std::uint8_t
+    {
+        TcpConnect, /// 대상 IP 주소의 TCP 포트에 연결 (연결 거부(RST)도 운영체제가 응답한 것이므로 켜진 것으로 판단)
+        IcmpEcho, /// 대상 IP 주소에 ICMP Echo 요청 (ping)
+        Neighbor, /// ARP/이웃 테이블에 대상의 MAC 주소가 완성된 항목으로 나타나는지 확인
+    };
+
+    /// @brief 확인할 대상 하나
+    struct ProbeTarget final
+    {
+        /// @brief 대상 장치의 MAC 주소 (ProbeMethod::Neighbor에서 사용)
+        MacAddress mMacBytes{};
+
+        /// @brief 대상 장치 자신의 IP 주소 (네트워크 바이트 순서, 0이면 알 수 없음)
+        /// @details ProbeMethod::TcpConnect, ProbeMethod::IcmpEcho에는 반드시 필요
+        ///          ProbeMethod::Neighbor에서는 지정된 경우 주소 확인(ARP)을 유도하는 데 사용
+        std::uint32_t mHostAddress{0U};
+
+        /// @brief 연결할 TCP 포트 (ProbeMethod::TcpConnect에서 사용)
+        std::uint16_t mPort{0U};
+    };
+
+    /// @brief 대상 하나의 확인 결과
+    struct ProbeResult final
+    {
+        /// @brief 확인 결과 (응답하면 WolErrorCode::Success, 아직 응답하지 않았다면 WolErrorCode::HostNotResponding)
+        WolErrorCode mResult{WolErrorCode::HostNotResponding};
+
+        /// @brief LivenessProber::Start() 호출부터 응답을 확인할 때까지 걸린 시간
+        std::chrono::milliseconds mTimeToAlive{0};
+
+        /// @brief 보낸 확인 요청 수 (TCP 연결 시도, ICMP Echo 요청, 이웃 테이블 조회 횟수)
+        std::uint32_t mAttempts{0U};
+    };
+
+    /// @brief 여러 대상 장치가 켜졌는지 동시에 확인하는 클래스
+    /// @details 모든 확인 요청을 non-blocking 소켓으로 보내고 poll()(WinSock: WSAPoll())로 한 스레드에서 응답을 기다림
+    ///          대상마다 스레드나 blocking 호출을 사용하지 않으므로 수천 대를 동시에 확인할 수 있음
+    ///          - TCP: 대상마다 연결을 시도하고, ATTEMPT_INTERVAL 안에 끝나지 않으면 닫고 다시 시도
+    ///                 동시에 진행하는 연결 수는 열 수 있는 파일 수에 맞추어 제한 (GetMaxConnectsInFlight())
+    ///          - ICMP: 하나의 소켓으로 ATTEMPT_INTERVAL마다 응답하지 않은 모든 대상에게 Echo 요청을 보냄
+    ///                  Linux/macOS는 권한이 필요 없는 ICMP 데이터그램 소켓을 먼저 사용하고, 안 되면 raw 소켓 사용
+    ///                  Windows는 raw 소켓을 사용하므로 관리자 권한이 필요
+    ///          - 이웃 테이블: ATTEMPT_INTERVAL마다 테이블(Linux: /proc/net/arp, Windows: GetIpNetTable2())을 읽고,
+    ///                        대상 IP 주소를 아는 경우 작은 UDP 패킷을 보내 주소 확인을 유도
+    ///                        (꺼진 장치의 오래된 항목은 주소 확인에 실패하면서 미완성 상태로 바뀜)
+    ///          사용 순서: Open() > Start() > 모든 대상이 응답하거나 제한 시간이 지날 때까지 Poll() 반복
+    class LivenessProber final
+    {
+    public:
+        /// @brief 기본 생성자
+        LivenessProber() noexcept;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        LivenessProber(const LivenessProber& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        LivenessProber(LivenessProber&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        LivenessProber& operator=(const LivenessProber& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        LivenessProber& operator=(LivenessProber&& other) noexcept = delete;
+
+        /// @brief 소멸자 - 기본 소멸자 사용
+        /// @details 진행 중인 연결 시도의 소켓은 mConnectSockets가 소멸될 때 닫힘
+        ///          (IoUringQueue가 정의된 WakeOnLan.cpp에서 정의)
+        ~LivenessProber() noexcept;
+
+        /// @brief 확인 방법을 정하고 필요한 소켓을 준비
+        /// @param method 확인 방법
+        /// @return 성공 시 WolErrorCode::Success, 확인 방법을 사용할 수 없으면 WolErrorCode::ProbeUnavailable,
+        ///         그 외 실패 시 적절한 WolErrorCode 값
+        [[nodiscard]] WolErrorCode Open(ProbeMethod method) noexcept;
+
+        /// @brief 대상 목록의 확인을 시작 (이전 확인 상태는 버림)
+        /// @param targets 확인할 대상 목록 (결과는 같은 순서의 위치로 조회)
+        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        /// @details 응답 시간(ProbeResult::mTimeToAlive)은 이 함수를 호출한 시각부터 측정
+        ///          ProbeMethod::TcpConnect, ProbeMethod::IcmpEcho에서 IP 주소가 없는 대상은
+        ///          확인하지 않고 WolErrorCode::InvalidHostIp 결과가 됨
+        /// @pre Open()에 성공해야 함
+        [[nodiscard]] WolErrorCode Start(const std::vector<ProbeTarget>& targets) noexcept;
+
+        /// @brief 시기가 된 확인 요청을 보내고 응답을 최대 wait 동안 기다림
+        /// @param wait 최대 대기 시간 (다음 확인 요청을 보낼 시각이 먼저 오면 그때 반환)
+        /// @param alive 이번 호출에서 응답을 확인한 대상의 위치 출력
+        /// @return 성공 시 WolErrorCode::Success, poll() 실패 시 WolErrorCode::UnexpectedException
+        [[nodiscard]] WolErrorCode Poll(std::chrono::milliseconds wait, std::vector<std::size_t>& alive) noexcept;
+
+        /// @brief 아직 응답하지 않은 대상 수를 반환
+        [[nodiscard]] std::size_t GetPendingCount() const noexcept { return mPendingCount; }
+
+        /// @brief 대상 하나의 확인 결과를 반환
+        /// @param index 대상 위치 (Start()에 전달한 목록의 순서)
+        [[nodiscard]] const ProbeResult& GetResult(const std::size_t index) const noexcept
+        {
+            assert(index < mResults.size());
+            return mResults[index];
+        }
+
+        /// @brief 동시에 진행하는 TCP 연결 시도의 최대 수를 반환
+        [[nodiscard]] std::size_t GetMaxConnectsInFlight() const noexcept { return mMaxConnectsInFlight; }
+
+        /// @brief 확인 요청 간격 (TCP 연결 시도 하나의 제한 시간 겸용)
+        static constexpr std::chrono::milliseconds ATTEMPT_INTERVAL{1000};
+
+        /// @brief 동시에 진행하는 TCP 연결 시도의 최대 수 (열 수 있는 파일 수가 더 적으면 그에 맞추어 줄임)
+        static constexpr std::size_t MAX_CONNECTS_IN_FLIGHT{4096U};
+
+        /// @brief ICMP 소켓의 송수신 버퍼 크기 (운영체제 상한을 넘으면 상한으로 제한됨)
+        static constexpr int ICMP_SOCKET_BUFFER_SIZE{8 * 1024 * 1024};
+
+        /// @brief 이웃 테이블 확인을 유도하기 위한 UDP 패킷을 보낼 포트 (discard)
+        static constexpr std::uint16_t NEIGHBOR_SOLICIT_PORT{9U};
+
+        /// @brief 확인 요청을 모아 한꺼번에 보낼 최대 개수
+        static constexpr std::size_t PROBE_BATCH_SIZE{256U};
+
+        /// @brief 확인 요청을 보낼 방식을 설정
+        /// @param backend 전송 방식 (SendBackend::IoUring을 사용할 수 없으면 Open()에서 소켓 API로 대체)
+        /// @pre Open()을 호출하기 전이어야 함
+        void SetSendBackend(const SendBackend backend) noexcept
+        {
+            assert(mOpened == false);
+            mSendBackend = backend;
+        }
+
+        /// @brief 소켓을 non-blocking 모드로 설정 (WakeOnLanAsyncSender의 완료 알림 소켓에도 사용)
+        [[nodiscard]] static bool SetNonBlocking(SocketHandle socket) noexcept;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        /// @brief ICMP Echo 요청/응답 (헤더 8바이트 + 대상 위치와 확인 회차를 담은 데이터 8바이트)
+        struct IcmpEchoPacket final
+        {
+            std::uint8_t mType{0U};
+            std::uint8_t mCode{0U};
+            std::uint16_t mChecksum{0U};
+            std::uint16_t mIdentifier{0U};
+            std::uint16_t mSequence{0U};
+            std::uint32_t mTargetIndex{0U};
+            std::uint32_t mSessionTag{0U};
+        };
+
+        static_assert(sizeof(IcmpEchoPacket) == 16U, "ICMP Echo 패킷 크기가 프로토콜과 달라짐");
+
+        /// @brief 시기가 된 확인 요청을 보냄
+        void StartAttempts(Clock::time_point now) noexcept;
+
+        /// @brief 대상 하나에 TCP 연결 시도를 시작
+        void StartConnect(std::size_t index, Clock::time_point now) noexcept;
+
+        /// @brief 끝난 TCP 연결 시도의 결과를 반영
+        void CompleteConnect(std::size_t index, Clock::time_point now) noexcept;
+
+        /// @brief 응답하지 않은 모든 대상에게 ICMP Echo 요청을 보냄
+        void SendEchoRequests() noexcept;
+
+        /// @brief 도착한 ICMP Echo 응답을 모두 읽어 반영
+        void ReceiveEchoReplies(Clock::time_point now) noexcept;
+
+        /// @brief 이웃 테이블을 읽어 반영하고, IP 주소를 아는 대상에게 주소 확인을 유도
+        void ScanNeighborTable(Clock::time_point now) noexcept;
+
+        /// @brief 확인 요청 하나를 묶음에 추가하고, 묶음이 가득 차면 전송
+        /// @param data 보낼 데이터 (최대 sizeof(IcmpEchoPacket) 바이트)
+        /// @param size 보낼 데이터의 크기
+        /// @param address 받을 주소
+        void QueueDatagram(const void* data, std::size_t size, const sockaddr_in& address) noexcept;
+
+        /// @brief 묶음에 모인 확인 요청을 전송
+        /// @details io_uring 큐가 열려 있으면 요청으로 한꺼번에 제출하고, 아니면 sendto()로 하나씩 전송
+        ///          송신 버퍼가 가득 차는 등 보내지 못한 요청은 다음 회차에 다시 보냄
+        void FlushDatagrams() noexcept;
+
+        /// @brief 대상이 응답한 것으로 기록
+        void MarkAlive(std::size_t index, Clock::time_point now) noexcept;
+
+        /// @brief 다음 확인 요청을 보낼 가장 이른 시각을 반환
+        [[nodiscard]] Clock::time_point GetNextAttemptTime() const noexcept;
+
+        /// @brief 인터넷 체크섬 (RFC 1071) 계산
+        [[nodiscard]] static std::uint16_t ComputeInternetChecksum(const std::uint8_t* data,
+                                                                   std::size_t size) noexcept;
+
+        /// @brief MAC 주소를 이웃 테이블 색인의 키로 변환
+        [[nodiscard]] static std::uint64_t ToKey(const MacAddress& macAddress) noexcept;
+
+    private:
+        /// @brief 확인하는 동안 WinSock 환경을 유지
+        /// @note 소켓보다 먼저 선언하여 소켓이 닫힌 뒤에 WSACleanup()이 호출되도록 함
+        WsaGuard mWsaGuard;
+
+        /// @brief 확인 방법
+        ProbeMethod mMethod{ProbeMethod::TcpConnect};
+
+        /// @brief Open()에 성공했는지 여부
+        bool mOpened{false};
+
+        /// @brief ICMP 소켓 (ProbeMethod::IcmpEcho) 또는 주소 확인 유도용 UDP 소켓 (ProbeMethod::Neighbor)
+        Socket mSocket;
+
+        /// @brief mSocket이 raw ICMP 소켓인지 여부 (받은 데이터가 IP 헤더로 시작하고 다른 프로세스의 응답도 받음)
+        bool mRawIcmp{false};
+
+        /// @brief ICMP Echo 식별자 (raw 소켓에서 이 프로세스의 응답을 구분)
+        std::uint16_t mEchoIdentifier{0U};
+
+        /// @brief Start()마다 바뀌는 값 (이전 확인에 대한 늦은 응답을 구분)
+        std::uint32_t mSessionTag{0U};
+
+        /// @brief 확인할 대상 목록
+        std::vector<ProbeTarget> mTargets{};
+
+        /// @brief 대상별 확인 결과
+        std::vector<ProbeResult> mResults{};
+
+        /// @brief 대상별 다음 확인 요청 시각 (TCP 연결 시도 중에는 그 시도의 제한 시각)
+        std::vector<Clock::time_point> mNextAttempts{};
+
+        /// @brief 대상별 진행 중인 TCP 연결 시도 소켓 (소켓은 이동할 수 없으므로 고정 크기 배열로 보관)
+        std::unique_ptr<Socket[]> mConnectSockets{};
+
+        /// @brief TCP 연결 시도가 진행 중인 대상의 위치
+        std::vector<std::size_t> mConnecting{};
+
+        /// @brief Poll() 한 번에서 응답을 확인한 대상의 위치 (대상 수만큼 미리 예약하여 추가할 때 할당하지 않음)
+        std::vector<std::size_t> mAlive{};
+
+        /// @brief MAC 주소별 대상 위치 (ProbeMethod::Neighbor)
+        std::unordered_multimap<std::uint64_t, std::size_t> mMacIndex{};
+
+        /// @brief poll()에 전달할 소켓 목록 (호출마다 다시 채우며 메모리는 재사용)
+        std::vector<PollDescriptor> mPollFds{};
+
+        /// @brief 동시에 진행하는 TCP 연결 시도의 최대 수
+        std::size_t mMaxConnectsInFlight{MAX_CONNECTS_IN_FLIGHT};
+
+        /// @brief 아직 응답하지 않은 대상 수
+        std::size_t mPendingCount{0U};
+
+        /// @brief Start()를 호출한 시각
+        Clock::time_point mStartTime{};
+
+        /// @brief 다음 ICMP Echo 요청 또는 이웃 테이블 확인 시각
+        Clock::time_point mNextRound{};
+
+        /// @brief 확인 요청을 보낼 방식
+        SendBackend mSendBackend{SendBackend::Socket};
+
+        /// @brief 확인 요청 전송용 io_uring 큐 (SendBackend::IoUring을 요청한 경우에만 Open()에서 생성)
+        std::unique_ptr<IoUringQueue> mIoUring{};
+
+        /// @brief 보낼 확인 요청의 데이터 (QueueDatagram()으로 모으고 FlushDatagrams()로 전송)
+        std::array<IcmpEchoPacket, PROBE_BATCH_SIZE> mBatchData{};
+
+        /// @brief 보낼 확인 요청의 데이터 크기
+        std::array<std::size_t, PROBE_BATCH_SIZE> mBatchSizes{};
+
+        /// @brief 보낼 확인 요청의 받을 주소
+        std::array<sockaddr_in, PROBE_BATCH_SIZE> mBatchAddresses{};
+
+        /// @brief 묶음에 모인 확인 요청 수
+        std::size_t mBatchCount{0U};
+    };
+
+    /// @brief 대상 위치별 만료 시각을 관리하는 타이머 휠 (hashed timing wheel)
+    /// @details 시간을 TICK 단위로 나누고 만료 틱을 SLOT_COUNT개의 슬롯에 해시하여 보관
+    ///          - 등록: 슬롯 하나에 추가 (O(1))
+    ///          - 만료 처리: 지난 틱의 슬롯만 확인 (대상 수와 관계없이 경과한 틱 수에 비례, 최대 SLOT_COUNT)
+    ///          - 한 바퀴(SLOT_COUNT × TICK)보다 먼 만료 시각은 같은 슬롯에 남아 있다가 해당 바퀴에 만료됨
+    ///          수만 개의 대기 중인 재전송을 스레드나 정렬된 목록 없이 관리하기 위해 사용
+    class TimerWheel final
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /// @brief 생성자
+        /// @param origin 틱 0에 해당하는 시각
+        explicit TimerWheel(const Clock::time_point origin = Clock::now()) noexcept
+            : mOrigin(origin)
+        {
+        }
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        TimerWheel(const TimerWheel& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        TimerWheel(TimerWheel&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        TimerWheel& operator=(const TimerWheel& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        TimerWheel& operator=(TimerWheel&& other) noexcept = delete;
+
+        /// @brief 소멸자 - 기본 소멸자 사용
+        ~TimerWheel() noexcept = default;
+
+        /// @brief 만료 시각을 등록
+        /// @param index 만료될 때 돌려받을 값 (대상 위치)
+        /// @param expiry 만료 시각 (TICK 단위로 올림, 이미 지난 시각이면 다음 Advance()에서 만료)
+        /// @details 같은 index를 여러 번 등록하면 각각 만료됨 (취소는 호출자가 만료 시 무시하는 방식으로 처리)
+        void Schedule(std::size_t index, Clock::time_point expiry);
+
+        /// @brief now까지 만료된 항목을 꺼냄
+        /// @param now 현재 시각
+        /// @param expired 만료된 항목의 index 출력 (기존 내용 뒤에 추가)
+        void Advance(Clock::time_point now, std::vector<std::size_t>& expired);
+
+        /// @brief 다음에 Advance()를 호출해야 할 시각을 반환
+        /// @return 이번 바퀴에서 가장 먼저 만료될 항목의 시각, 이번 바퀴에 만료될 항목이 없으면 바퀴가 한 번 돌았을 때의 시각,
+        ///         등록된 항목이 없으면 Clock::time_point::max()
+        /// @note 실제 만료 시각보다 이를 수는 있지만 늦지는 않음
+        [[nodiscard]] Clock::time_point GetNextExpiry() const noexcept;
+
+        /// @brief 등록된 항목 수를 반환
+        [[nodiscard]] std::size_t GetCount() const noexcept { return mCount; }
+
+        /// @brief 틱 간격
+        static constexpr std::chrono::milliseconds TICK{10};
+
+        /// @brief 슬롯 수 (2의 거듭제곱, 한 바퀴 = SLOT_COUNT × TICK = 5.12초)
+        static constexpr std::size_t SLOT_COUNT{512U};
+
+    private:
+        /// @brief 슬롯에 보관하는 항목
+        struct Entry final
+        {
+            /// @brief 만료 틱
+            std::uint64_t mExpiryTick{0U};
+
+            /// @brief 대상 위치
+            std::size_t mIndex{0U};
+        };
+
+        /// @brief 시각을 틱으로 변환 (올림)
+        [[nodiscard]] std::uint64_t ToTick(Clock::time_point time) const noexcept;
+
+    private:
+        /// @brief 틱 0에 해당하는 시각
+        Clock::time_point mOrigin;
+
+        /// @brief 슬롯별 항목 목록 (만료 틱 % SLOT_COUNT)
+        std::array<std::vector<Entry>, SLOT_COUNT> mSlots{};
+
+        /// @brief 마지막으로 처리한 틱 (이 틱까지의 슬롯은 처리됨)
+        std::uint64_t mCurrentTick{0U};
+
+        /// @brief 등록된 항목 수
+        std::size_t mCount{0U};
+    };
+
+    /// @brief 재전송 정책
+    struct RetryPolicy final
+    {
+        /// @brief 첫 번째 전송 후 첫 재전송까지의 간격
+        std::chrono::milliseconds mInitialInterval{5000};
+
+        /// @brief 재전송할 때마다 간격에 곱하는 값 (1 이상)
+        double mMultiplier{2.0};
+
+        /// @brief 간격을 무작위로 늘이거나 줄이는 비율 (0 ~ 1, 예: 0.2이면 ±20%)
+        /// @details 같은 시각에 시작한 수천 대의 재전송이 한 순간에 몰리지 않도록 분산
+        double mJitter{0.2};
+
+        /// @brief 대상별 최대 전송 횟수 (첫 번째 전송 포함, 1이면 재전송하지 않음)
+        std::uint32_t mMaxAttempts{5U};
+
+        /// @brief 간격의 상한 (지터 적용 전)
+        std::chrono::milliseconds mMaxInterval{60000};
+    };
+
+    /// @brief 응답하지 않은 대상에게 지수 백오프 간격으로 매직 패킷을 다시 보낼 시점을 정하는 스케줄러
+    /// @details 대상별 다음 재전송 시각을 TimerWheel에 등록하고, 만료된 대상 중 아직 응답하지 않은 대상만 돌려줌
+    ///          전송과 응답 확인은 호출자가 수행 (WakeOnLanSession::SendBatch(), LivenessProber::Poll())
+    ///          - n번째 전송 후의 간격: min(mInitialInterval × mMultiplier^(n-1), mMaxInterval) × (1 ± mJitter)
+    ///          - Cancel()한 대상(응답한 대상)은 만료되어도 무시 (타이머 휠에서 직접 제거하지 않음)
+    ///          - mMaxAttempts번 전송한 대상은 더 이상 등록하지 않음
+    class RetryScheduler final
+    {
+    public:
+        using Clock = TimerWheel::Clock;
+
+        /// @brief 기본 생성자
+        RetryScheduler() = default;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        RetryScheduler(const RetryScheduler& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        RetryScheduler(RetryScheduler&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        RetryScheduler& operator=(const RetryScheduler& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        RetryScheduler& operator=(RetryScheduler&& other) noexcept = delete;
+
+        /// @brief 소멸자 - 기본 소멸자 사용
+        ~RetryScheduler() noexcept = default;
+
+        /// @brief 첫 번째 전송을 마친 대상들의 재전송 일정을 시작
+        /// @param count 대상 수 (대상 위치는 0 ~ count - 1)
+        /// @param policy 재전송 정책
+        /// @param now 첫 번째 전송 시각
+        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        [[nodiscard]] WolErrorCode Start(std::size_t count, const RetryPolicy& policy,
+                                         Clock::time_point now) noexcept;
+
+        /// @brief 대상의 재전송을 중단 (응답을 확인한 대상)
+        void Cancel(const std::size_t index) noexcept
+        {
+            assert(index < mAttempts.size());
+            mCancelled[index] = true;
+        }
+
+        /// @brief 재전송할 시각이 된 대상을 꺼내고 다음 재전송을 예약
+        /// @param now 현재 시각
+        /// @param due 지금 재전송할 대상 위치 출력 (전송 횟수는 이미 증가된 상태)
+        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        [[nodiscard]] WolErrorCode Collect(Clock::time_point now, std::vector<std::size_t>& due) noexcept;
+
+        /// @brief 다음에 Collect()를 호출해야 할 시각을 반환 (예약된 재전송이 없으면 Clock::time_point::max())
+        [[nodiscard]] Clock::time_point GetNextDeadline() const noexcept { return mWheel->GetNextExpiry(); }
+
+        /// @brief 대상에게 보낸 횟수 (첫 번째 전송 포함)를 반환
+        [[nodiscard]] std::uint32_t GetAttempts(const std::size_t index) const noexcept
+        {
+            assert(index < mAttempts.size());
+            return mAttempts[index];
+        }
+
+        /// @brief 재전송이 예약된 대상 수를 반환
+        [[nodiscard]] std::size_t GetScheduledCount() const noexcept { return mWheel != nullptr ? mWheel->GetCount() : 0U; }
+
+    private:
+        /// @brief attempts번 전송한 뒤 다음 전송까지의 간격 (지터 적용)
+        [[nodiscard]] Clock::duration GetInterval(std::uint32_t attempts) noexcept;
+
+    private:
+        /// @brief 재전송 정책
+        RetryPolicy mPolicy{};
+
+        /// @brief 재전송 시각 (슬롯 배열이 크므로 힙에 보관)
+        std::unique_ptr<TimerWheel> mWheel{};
+
+        /// @brief 대상별 전송 횟수
+        std::vector<std::uint32_t> mAttempts{};
+
+        /// @brief 대상별 재전송 중단 여부 (std::vector<bool>의 비트 접근을 피하기 위해 std::uint8_t 사용)
+        std::vector<std::uint8_t> mCancelled{};
+
+        /// @brief 지터용 난수 생성기
+        std::minstd_rand mRandom{std::random_device{}()};
+
+        /// @brief Collect()에서 만료된 항목을 받는 버퍼 (호출마다 재사용)
+        std::vector<std::size_t> mExpired{};
+    };
+
+    /// @brief 제어 소켓(AF_UNIX) 파일 경로를 가져옴
+    /// @param config 설정 파일 경로를 얻기 위한 설정 객체
+    /// @param path 제어 소켓 파일 경로 출력 (설정 파일과 같은 폴더의 CONTROL_SOCKET_FILE_NAME)
+    /// @param address 제어 소켓 주소 출력
+    /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+    /// @details sockaddr_un::sun_path의 길이 제한(일반적으로 108바이트)을 넘는 경로는 사용할 수 없음
+    [[nodiscard]] WolErrorCode GetControlSocketAddress(const WolConfig& config,
+                                                       std::filesystem::path& path,
+                                                       sockaddr_un& address) noexcept;
+
+    /// @brief 비동기 깨우기 요청 하나의 결과
+    struct AsyncWakeResult final
+    {
+        /// @brief 결과 (확인을 요청했다면 응답한 경우 WolErrorCode::Success, 제한 시간 안에 응답하지 않으면 WolErrorCode::HostNotResponding)
+        WolErrorCode mResult{WolErrorCode::PacketSendFailed};
+
+        /// @brief 첫 번째 전송부터 응답을 확인할 때까지 걸린 시간 (확인하지 않았거나 응답하지 않았다면 없음)
+        std::optional<std::chrono::milliseconds> mTimeToAlive{};
+
+        /// @brief 전송 횟수 (다시 보낸 횟수 포함)
+        std::uint32_t mSendCount{0U};
+
+        /// @brief Wake() 호출부터 결과가 정해질 때까지 걸린 시간
+        std::chrono::microseconds mElapsed{0};
+    };
+
+    /// @brief 비동기 깨우기 요청의 확인 설정 (WakeOnLanAsyncSender::SetVerifyOptions())
+    struct AsyncVerifyOptions final
+    {
+        /// @brief 확인 방법
+        ProbeMethod mMethod{ProbeMethod::TcpConnect};
+
+        /// @brief 확인 제한 시간 (첫 번째 전송부터)
+        std::chrono::milliseconds mTimeout{180000};
+
+        /// @brief ProbePort를 지정하지 않은 대상을 TCP로 확인할 때 연결할 포트
+        std::uint16_t mDefaultPort{22U};
+
+        /// @brief 응답하지 않은 대상에게 다시 보낼 정책
+        RetryPolicy mRetryPolicy{};
+    };
+
+    /// @brief 이벤트 루프를 사용하는 서비스에 포함하기 위한 비동기 Wake-on-LAN 전송 클래스
+    /// @details Wake()는 요청을 대기열에 넣고 바로 반환하며, 전송과 확인은 내부 스레드 하나가 처리
+    ///          - 내부 스레드는 대기열에 모인 요청을 한 번의 일괄 전송(WakeOnLanSession::SendBatch())으로 보내므로
+    ///            동시에 많은 요청이 들어와도 요청마다 시스템 호출을 하지 않음
+    ///          - 확인을 요청한 대상은 모인 요청마다 LivenessProber 하나로 확인하고, 응답하지 않으면 재전송 정책에 따라 다시 보냄
+    ///          - 결과가 정해지면 완료 알림 소켓(GetNotifySocket())이 읽기 가능 상태가 되고,
+    ///            이벤트 루프 스레드에서 DispatchCompletions()를 호출하면 그 스레드에서 완료 콜백이 호출됨
+    ///            (epoll, poll(), WSAPoll(), select() 등 어떤 이벤트 루프에도 소켓 하나로 연결)
+    ///          사용 순서: (GetSession()과 SetVerifyOptions()로 설정) > Open() > Wake() 반복 > Close()
+    class WakeOnLanAsyncSender final
+    {
+    public:
+        /// @brief 완료 콜백 (DispatchCompletions()를 호출한 스레드에서 호출, 예외를 던지지 않아야 함)
+        using Completion = std::function<void(const AsyncWakeResult&)>;
+
+        /// @brief 기본 생성자
+        WakeOnLanAsyncSender() = default;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        WakeOnLanAsyncSender(const WakeOnLanAsyncSender& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        WakeOnLanAsyncSender(WakeOnLanAsyncSender&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        WakeOnLanAsyncSender& operator=(const WakeOnLanAsyncSender& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        WakeOnLanAsyncSender& operator=(WakeOnLanAsyncSender&& other) noexcept = delete;
+
+        /// @brief 소멸자 - Close()를 호출하여 남은 요청을 처리하고 완료 콜백을 호출
+        ~WakeOnLanAsyncSender() noexcept { Close(); }
+
+        /// @brief 세션과 완료 알림 소켓을 준비하고 내부 스레드를 시작
+        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        /// @note 이미 열려 있으면 아무 작업도 하지 않음
+        [[nodiscard]] WolErrorCode Open() noexcept;
+
+        /// @brief 내부 스레드를 멈추고 남은 완료 콜백을 호출한 스레드에서 호출
+        /// @details 대기열에 남은 요청은 전송한 뒤 멈추고, 확인 중인 대상은 WolErrorCode::HostNotResponding으로 완료
+        ///          Wake()와 동시에 호출하면 안 됨
+        void Close() noexcept;
+
+        /// @brief 열려 있는지 확인
+        [[nodiscard]] bool IsOpen() const noexcept { return mWorker.joinable(); }
+
+        /// @brief 매직 패킷 전송을 요청
+        /// @param target 대상 장치 설정 (WolConfig에서 변환한 바이너리 값 사용)
+        /// @param verify 전송 후 SetVerifyOptions()의 방법으로 켜졌는지 확인할지 여부
+        /// @param completion 결과가 정해지면 DispatchCompletions()에서 호출할 콜백
+        /// @return 요청을 대기열에 넣은 경우 WolErrorCode::Success, 실패한 경우 적절한 WolErrorCode 값 (콜백은 호출되지 않음)
+        ///         열리지 않았거나 Close()를 호출한 뒤라면 WolErrorCode::InvalidArgument
+        /// @details 어느 스레드에서나 호출할 수 있으며 전송을 기다리지 않음
+        [[nodiscard]] WolErrorCode Wake(const WolTarget& target, bool verify, Completion completion) noexcept;
+
+        /// @brief 완료 알림 소켓을 반환
+        /// @details 완료된 요청이 있으면 읽기 가능 상태가 됨 (직접 읽지 말고 DispatchCompletions()를 호출)
+        [[nodiscard]] SocketHandle GetNotifySocket() const noexcept { return mNotifyReceiver.Get(); }
+
+        /// @brief 완료된 요청의 콜백을 호출한 스레드에서 호출
+        /// @return 호출한 콜백 수
+        std::size_t DispatchCompletions() noexcept;
+
+        /// @brief 콜백을 아직 호출하지 않은 요청 수를 반환
+        [[nodiscard]] std::size_t GetPendingCount() const noexcept { return mPendingCount.load(std::memory_order_relaxed); }
+
+        /// @brief 전송에 사용할 세션을 반환 (전송 속도 제한, 인터페이스, 전송 방식 설정용)
+        /// @pre Open()을 호출하기 전에만 설정해야 함 (이후에는 내부 스레드가 사용)
+        [[nodiscard]] WakeOnLanSession& GetSession() noexcept { return mSession; }
+
+        /// @brief 확인 방법과 제한 시간, 재전송 정책을 설정
+        /// @pre Open()을 호출하기 전이어야 함
+        void SetVerifyOptions(const AsyncVerifyOptions& options) noexcept
+        {
+            assert(IsOpen() == false);
+            mVerifyOptions = options;
+        }
+
+        /// @brief 확인 중인 대상이 있을 때 내부 스레드가 응답과 새 요청을 확인하는 주기
+        static constexpr std::chrono::milliseconds VERIFY_POLL_INTERVAL{10};
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        /// @brief 대기열의 요청 하나
+        struct Request final
+        {
+            /// @brief 대상 장치 설정
+            WolTarget mTarget{};
+
+            /// @brief 켜졌는지 확인할지 여부
+            bool mVerify{false};
+
+            /// @brief 완료 콜백
+            Completion mCompletion{};
+
+            /// @brief Wake()를 호출한 시각
+            Clock::time_point mQueuedTime{};
+
+            /// @brief 완료 목록(Complete())이나 확인 목록으로 넘겼는지 여부
+            /// @details Run()에서 예외가 발생하면 넘기지 못한 요청만 오류로 완료
+            bool mHandedOver{false};
+        };
+
+        /// @brief 결과가 정해진 요청 하나
+        struct Completed final
+        {
+            /// @brief 결과
+            AsyncWakeResult mResult{};
+
+            /// @brief 완료 콜백
+            Completion mCompletion{};
+        };
+
+        /// @brief 한 번에 전송한 요청 중 확인 중인 요청들
+        struct Verification final
+        {
+            /// @brief 응답 확인
+            LivenessProber mProber;
+
+            /// @brief 재전송 일정
+            RetryScheduler mScheduler;
+
+            /// @brief 확인 중인 요청 (LivenessProber::Start()에 전달한 순서)
+            std::vector<Request> mRequests{};
+
+            /// @brief 재전송할 패킷 (mRequests와 같은 순서)
+            std::vector<WolPacket> mPackets{};
+
+            /// @brief 요청별 완료 여부 (std::vector<bool>의 비트 접근을 피하기 위해 std::uint8_t 사용)
+            std::vector<std::uint8_t> mCompleted{};
+
+            /// @brief 아직 완료되지 않은 요청 수
+            std::size_t mRemaining{0U};
+
+            /// @brief 확인 제한 시각
+            Clock::time_point mDeadline{};
+
+            /// @brief 재전송 일정을 시작했는지 여부 (전송 횟수 조회용)
+            bool mScheduled{false};
+        };
+
+        /// @brief 내부 스레드의 처리 루프
+        void Run() noexcept;
+
+        /// @brief 대기열에서 꺼낸 요청들을 한 번에 전송하고, 확인할 요청들의 확인을 시작
+        void SendRequests(std::vector<Request>& requests);
+
+        /// @brief 확인 중인 요청들의 응답을 확인하고, 재전송할 대상에게 다시 보내고, 제한 시간이 지난 요청을 완료
+        /// @param stopping 멈추는 중이면 확인 중인 모든 요청을 WolErrorCode::HostNotResponding으로 완료
+        void PollVerifications(bool stopping);
+
+        /// @brief 확인 중인 요청 하나를 완료
+        void CompleteVerification(Verification& verification, std::size_t index, WolErrorCode result);
+
+        /// @brief 처리 중 예외가 발생했을 때 완료 목록이나 확인 목록으로 넘기지 못한 요청을 WolErrorCode::UnexpectedException으로 완료
+        /// @param requests 처리하던 요청 목록
+        /// @param stopping 내부 스레드가 멈추는 중인지 여부
+        void CompleteFailedRequests(std::vector<Request>& requests, bool stopping) noexcept;
+
+        /// @brief 요청의 결과를 내부 스레드의 완료 목록에 추가 (FlushCompletions()에서 한꺼번에 넘김)
+        void Complete(Request& request, const AsyncWakeResult& result);
+
+        /// @brief 내부 스레드의 완료 목록을 이벤트 루프에 넘기고, 넘겨받을 목록이 비어 있었다면 완료 알림 소켓에 알림
+        void FlushCompletions();
+
+    private:
+        /// @brief 알림 소켓이 사용하는 동안 WinSock 환경을 유지
+        /// @note 소켓보다 먼저 선언하여 소켓이 닫힌 뒤에 WSACleanup()이 호출되도록 함
+        WsaGuard mWsaGuard;
+
+        /// @brief 내부 스레드가 사용하는 세션
+        WakeOnLanSession mSession;
+
+        /// @brief 확인 설정
+        AsyncVerifyOptions mVerifyOptions{};
+
+        /// @brief 완료 알림을 받는 루프백 UDP 소켓 (non-blocking, 이벤트 루프가 감시)
+        Socket mNotifyReceiver;
+
+        /// @brief 완료 알림을 보내는 루프백 UDP 소켓 (mNotifyReceiver에 연결됨)
+        Socket mNotifySender;
+
+        /// @brief mRequests와 mStopRequested를 보호
+        std::mutex mRequestMutex{};
+
+        /// @brief 새 요청이나 종료 요청을 내부 스레드에 알림
+        std::condition_variable mRequestCondition{};
+
+        /// @brief 아직 전송하지 않은 요청
+        std::vector<Request> mRequests{};
+
+        /// @brief 내부 스레드에 종료를 요청했는지 여부
+        /// @details 열리지 않은 동안에도 true이므로 Wake()는 이 값으로 요청을 받을 수 있는지 확인
+        bool mStopRequested{true};
+
+        /// @brief mCompleted를 보호
+        std::mutex mCompletionMutex{};
+
+        /// @brief 결과가 정해졌지만 아직 콜백을 호출하지 않은 요청
+        std::vector<Completed> mCompleted{};
+
+        /// @brief 콜백을 아직 호출하지 않은 요청 수
+        std::atomic<std::size_t> mPendingCount{0U};
+
+        /// @brief 이번 처리 주기에 결과가 정해진 요청 (내부 스레드만 사용, 요청마다 잠그지 않도록 모아서 넘김)
+        std::vector<Completed> mLocalCompleted{};
+
+        /// @brief 확인 중인 요청들 (내부 스레드만 사용)
+        std::list<Verification> mVerifications{};
+
+        /// @brief 내부 스레드
+        std::thread mWorker{};
+    };
+
+    /// @brief 상주하며 제어 소켓으로 받은 명령을 처리하는 Wake-on-LAN 서비스
+    /// @details 설정(스냅샷)과 전송 세션(소켓, 패킷 캐시)을 한 번만 준비해 두고
+    ///          실행 파일과 같은 폴더의 제어 소켓(CONTROL_SOCKET_FILE_NAME, AF_UNIX)으로 받은 명령을 처리
+    ///          - Windows 10 1803 이상은 AF_UNIX 소켓을 지원하므로 모든 플랫폼에서 같은 방식을 사용
+    ///          - 명령은 연결 하나에 한 줄(UTF-8)이며, 응답을 보낸 뒤 연결을 닫음
+    ///          - "wake", "wake-all"은 전송 스레드에서 받은 순서대로 처리하고, 나머지 명령은 제어 소켓 스레드에서 바로 처리
+    ///            (속도를 제한한 "wake-all"이 오래 걸려도 "status", "reload" 등은 기다리지 않음)
+    ///          - 명령을 기다리는 동안 설정 파일의 변경을 확인하여 바뀐 섹션만 다시 읽음 (WolConfig::Reload())
+    ///          명령:
+    ///          - "wake <대상 이름>": 이름이 같은 대상(대소문자 구분 없음)에 매직 패킷 전송
+    ///          - "wake-all": 모든 대상에 매직 패킷 전송
+    ///          - "reload": 설정 파일을 즉시 다시 읽음
+    ///          - "status": 대상 수, 처리를 기다리는 wake 요청 수와 패킷 캐시 상태 (전송 통계는 마지막으로 처리한 wake 요청까지)
+    ///          - "shutdown": 서비스 종료
+    ///          응답은 한 줄에 하나씩 "<WolErrorCode 값>\t<대상>\t<설명>" 형식
+    class WakeOnLanDaemon final
+    {
+    public:
+        /// @brief 기본 생성자
+        WakeOnLanDaemon() noexcept = default;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        WakeOnLanDaemon(const WakeOnLanDaemon& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        WakeOnLanDaemon(WakeOnLanDaemon&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        WakeOnLanDaemon& operator=(const WakeOnLanDaemon& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        WakeOnLanDaemon& operator=(WakeOnLanDaemon&& other) noexcept = delete;
+
+        /// @brief 소멸자
+        /// @details 전송 스레드를 종료하고 이 인스턴스가 만든 제어 소켓 파일을 삭제
+        ~WakeOnLanDaemon() noexcept;
+
+        /// @brief 서비스를 실행
+        /// @return 정상 종료 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        /// @details 설정 로드, 세션 열기, 제어 소켓 생성 후 "shutdown" 명령이나 RequestStop() 호출까지 명령을 처리
+        [[nodiscard]] WolErrorCode Run() noexcept;
+
+        /// @brief 실행 파일 위치 대신 사용할 설정 파일 경로를 지정 (WolConfig::SetConfigFilePath())
+        void SetConfigFilePath(std::wstring configFilePath) { mConfig.SetConfigFilePath(std::move(configFilePath)); }
+
+        /// @brief 전송 속도 제한을 설정 (WakeOnLanSession::SetPacing(), "status" 명령으로 통계 확인)
+        void SetPacing(const PacingPolicy& policy) noexcept { mSession.SetPacing(policy); }
+
+        /// @brief 패킷을 전송할 네트워크 인터페이스를 설정 (WakeOnLanSession::SetInterfaces(), "status" 명령으로 결과 확인)
+        /// @throw std::bad_alloc 목록을 복사할 메모리를 할당하지 못한 경우
+        void SetInterfaces(const std::vector<NetworkInterface>& interfaces) { mSession.SetInterfaces(interfaces); }
+
+        /// @brief 패킷을 전송할 방식을 설정 (WakeOnLanSession::SetSendBackend(), "status" 명령으로 실제 방식 확인)
+        void SetSendBackend(const SendBackend backend) noexcept { mSession.SetSendBackend(backend); }
+
+        /// @brief 일괄 전송에 사용할 스레드 수를 설정 (WakeOnLanSession::SetSendThreads(), "status" 명령으로 스레드별 통계 확인)
+        void SetSendThreads(const std::size_t threadCount) noexcept { mSession.SetSendThreads(threadCount); }
+
+        /// @brief 서비스 종료를 요청
+        /// @note 시그널 처리기에서 호출 가능 (명령 대기 주기(POLL_INTERVAL) 안에 종료됨)
+        static void RequestStop() noexcept { sStopRequested = 1; }
+
+        /// @brief 요청 한 줄의 최대 길이 (바이트)
+        static constexpr std::size_t MAX_REQUEST_LENGTH{4096U};
+
+        /// @brief 명령 대기 중 종료 요청과 설정 파일 변경을 확인하는 주기
+        static constexpr std::chrono::milliseconds POLL_INTERVAL{1000};
+
+        /// @brief 클라이언트가 요청을 보낼 때까지 기다리는 최대 시간
+        /// @details 요청을 보내지 않는 클라이언트가 다른 명령의 처리를 막지 않도록 제한
+        static constexpr std::chrono::milliseconds REQUEST_TIMEOUT{1000};
+
+    private:
+        /// @brief 제어 소켓을 생성하고 연결을 기다리기 시작
+        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+        /// @details 같은 경로의 제어 소켓에 연결할 수 있으면 이미 실행 중인 서비스가 있는 것으로 판단
+        ///          연결할 수 없는 남은 소켓 파일은 삭제 후 다시 생성
+        ///          POSIX에서는 소유자만 접근할 수 있는 권한(0600)으로 생성
+        [[nodiscard]] WolErrorCode OpenControlSocket() noexcept;
+
+        /// @brief 연결 하나의 요청을 읽고 응답
+        /// @param client accept()로 얻은 소켓 ("wake", "wake-all"이면 소유권을 전송 스레드로 넘김)
+        void HandleConnection(Socket& client) noexcept;
+
+        /// @brief 제어 소켓 스레드에서 처리하는 명령 한 줄을 실행
+        /// @param command 명령 (줄바꿈 제외, UTF-8)
+        /// @param response 응답 출력 (UTF-8)
+        void ExecuteCommand(std::string_view command, std::string& response);
+
+        /// @brief 전송 스레드에서 처리하는 명령("wake", "wake-all") 한 줄을 실행
+        /// @param command 명령 (줄바꿈 제외, UTF-8)
+        /// @param response 응답 출력 (UTF-8)
+        void ExecuteWakeCommand(std::string_view command, std::string& response);
+
+        /// @brief 전송 스레드가 처리할 명령인지 확인
+        [[nodiscard]] static bool IsWakeCommand(std::string_view command) noexcept;
+
+        /// @brief 전송 스레드 함수
+        /// @details 요청 목록을 한꺼번에 가져와 순서대로 처리하고, 종료가 요청되면 남은 요청을 모두 처리한 뒤 끝냄
+        void RunWakeWorker() noexcept;
+
+        /// @brief 전송 스레드를 종료하고 끝날 때까지 기다림
+        void StopWakeWorker() noexcept;
+
+        /// @brief 세션의 전송 방식, 패킷 캐시, 속도 제한, 인터페이스별/스레드별 통계를 mSessionStatus에 기록
+        /// @details 세션을 사용하는 스레드(Run() 시작 시 제어 소켓 스레드, 이후 전송 스레드)에서만 호출
+        void UpdateSessionStatus();
+
+        /// @brief 응답을 모두 보냄
+        static void SendResponse(SocketHandle client, std::string_view response) noexcept;
+
+        /// @brief 이름이 같은 대상에 매직 패킷을 전송
+        void WakeTarget(std::string_view name, std::string& response);
+
+        /// @brief 모든 대상에 매직 패킷을 전송
+        void WakeAllTargets(std::string& response);
+
+        /// @brief 설정 파일을 다시 읽음
+        void ReloadConfig(std::string& response);
+
+        /// @brief 현재 스냅샷으로 대상 이름 색인을 갱신
+        /// @details 스냅샷이 바뀐 경우(설정 파일을 다시 읽은 경우)에만 색인을 다시 만듦
+        void UpdateNameIndex();
+
+        /// @brief 응답에 결과 한 줄을 추가
+        static void AppendResult(std::string& response, WolErrorCode result, std::wstring_view subject,
+                                 std::wstring_view description);
+
+    private:
+        /// @brief 대상 장치 설정
+        WolConfig mConfig;
+
+        /// @brief 매직 패킷 전송기
+        WakeOnLanSender mSender;
+
+        /// @brief 모든 wake 요청이 공유하는 전송 세션 (소켓과 패킷 캐시 유지, Run()에서 연 뒤에는 전송 스레드만 사용)
+        WakeOnLanSession mSession;
+
+        /// @brief 연결을 기다리는 제어 소켓
+        Socket mListenSocket;
+
+        /// @brief 제어 소켓 파일 경로 (이 인스턴스가 생성한 경우에만 설정)
+        std::filesystem::path mSocketPath{};
+
+        /// @brief mNameIndex를 만든 스냅샷
+        std::shared_ptr<const TargetSnapshot> mIndexedSnapshot{};
+
+        /// @brief 소문자로 변환한 대상 이름으로 mIndexedSnapshot의 대상 위치를 찾기 위한 색인
+        std::unordered_map<std::wstring, std::size_t> mNameIndex{};
+
+        /// @brief 전송 스레드가 처리할 요청
+        struct WakeRequest final
+        {
+            /// @brief 응답을 보낼 연결
+            std::unique_ptr<Socket> mClient{};
+
+            /// @brief 명령 (줄바꿈 제외, UTF-8)
+            std::string mCommand{};
+        };
+
+        /// @brief mWakeRequests, mWakeStopRequested, mSessionStatus를 보호
+        mutable std::mutex mWakeMutex;
+
+        /// @brief 요청이 추가되거나 종료가 요청되면 전송 스레드를 깨움
+        std::condition_variable mWakeCondition;
+
+        /// @brief 전송 스레드가 처리할 요청 (받은 순서)
+        std::vector<WakeRequest> mWakeRequests{};
+
+        /// @brief 전송 스레드가 처리 중인 요청 (전송 스레드만 사용, 요청 목록과 교환하여 용량을 재사용)
+        std::vector<WakeRequest> mActiveWakeRequests{};
+
+        /// @brief 전송 스레드 종료 요청 여부
+        bool mWakeStopRequested{false};
+
+        /// @brief 처리를 기다리거나 처리 중인 요청 수 ("status" 응답용)
+        std::size_t mPendingWakeCount{0U};
+
+        /// @brief 마지막으로 기록한 세션 상태 ("status" 응답용, UpdateSessionStatus() 참고)
+        std::wstring mSessionStatus{};
+
+        /// @brief 전송 스레드
+        std::thread mWakeWorker{};
+
+        /// @brief "shutdown" 명령을 받았는지 여부
+        bool mShutdownRequested{false};
+
+        /// @brief RequestStop()으로 종료가 요청되었는지 여부 (시그널 처리기에서 설정)
+        static inline volatile std::sig_atomic_t sStopRequested{0};
+    };
+
+    /// @brief 실행 중인 Wake-on-LAN 서비스(WakeOnLanDaemon)에 명령을 보내는 클라이언트
+    class WakeOnLanControlClient final
+    {
+    public:
+        /// @brief 기본 생성자
+        WakeOnLanControlClient() noexcept = default;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        WakeOnLanControlClient(const WakeOnLanControlClient& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        WakeOnLanControlClient(WakeOnLanControlClient&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        WakeOnLanControlClient& operator=(const WakeOnLanControlClient& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        WakeOnLanControlClient& operator=(WakeOnLanControlClient&& other) noexcept = delete;
+
+        /// @brief 소멸자 - 기본 소멸자 사용
+        ~WakeOnLanControlClient() noexcept = default;
+
+        /// @brief 서비스에 명령 한 줄을 보내고 응답을 받음
+        /// @param command 명령 (UTF-8, 줄바꿈 제외)
+        /// @param response 응답 출력 (UTF-8, WakeOnLanDaemon 참고)
+        /// @return 응답을 받은 경우 WolErrorCode::Success, 서비스에 연결할 수 없으면 WolErrorCode::DaemonNotRunning
+        [[nodiscard]] WolErrorCode Execute(std::string_view command, std::string& response) noexcept;
+
+        /// @brief 서비스가 사용하는 설정 파일 경로를 지정 (제어 소켓은 설정 파일과 같은 폴더에 있음)
+        void SetConfigFilePath(std::wstring configFilePath) { mConfig.SetConfigFilePath(std::move(configFilePath)); }
+
+    private:
+        /// @brief 요청하는 동안 WinSock 환경을 유지
+        WsaGuard mWsaGuard;
+
+        /// @brief 제어 소켓 경로를 얻기 위한 설정
+        WolConfig mConfig;
+    };
+}
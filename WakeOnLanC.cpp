@@ -0,0 +1,197 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Wake-on-LAN(WOL) 라이브러리의 C 인터페이스 구현
+///
+/// @details
+/// WakeOnLanC.h에 선언한 함수를 WakeOnLan::WakeOnLanSession으로 구현
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "WakeOnLanC.h"
+
+#include "WakeOnLanInternal.h"
+
+/// @brief C 인터페이스의 전송 세션
+/// @details 패킷과 결과 목록을 세션에 유지하여 같은 크기 이하의 일괄 전송에서는 메모리를 다시 할당하지 않음
+struct wol_session final
+{
+    /// @brief 소켓을 유지하는 전송 세션
+    WakeOnLan::WakeOnLanSession mSession{};
+
+    /// @brief wol_send_batch()에서 재사용하는 패킷 목록
+    std::vector<WakeOnLan::WolPacket> mPackets{};
+
+    /// @brief wol_send_batch()에서 재사용하는 결과 목록
+    std::vector<WakeOnLan::WolErrorCode> mResults{};
+};
+
+namespace
+{
+    using WakeOnLan::WolErrorCode;
+
+    static_assert(WOL_SUCCESS == static_cast<int>(WolErrorCode::Success)
+                  && WOL_INVALID_MAC_ADDRESS == static_cast<int>(WolErrorCode::InvalidMacAddress)
+                  && WOL_INVALID_BROADCAST_IP == static_cast<int>(WolErrorCode::InvalidBroadcastIp)
+                  && WOL_INVALID_PORT == static_cast<int>(WolErrorCode::InvalidPort)
+                  && WOL_WINSOCK_INITIALIZATION_FAILED == static_cast<int>(WolErrorCode::WinsockInitializationFailed)
+                  && WOL_SOCKET_CREATION_FAILED == static_cast<int>(WolErrorCode::SocketCreationFailed)
+                  && WOL_BROADCAST_SETUP_FAILED == static_cast<int>(WolErrorCode::BroadcastSetupFailed)
+                  && WOL_PACKET_SEND_FAILED == static_cast<int>(WolErrorCode::PacketSendFailed)
+                  && WOL_UNEXPECTED_EXCEPTION == static_cast<int>(WolErrorCode::UnexpectedException)
+                  && WOL_INVALID_ARGUMENT == static_cast<int>(WolErrorCode::InvalidArgument),
+                  "C 인터페이스의 결과 코드가 WolErrorCode와 달라짐");
+
+    static_assert(sizeof(wol_destination) == 24U, "wol_destination 크기가 바인딩과 약속한 크기와 달라짐");
+
+    /// @brief WolErrorCode를 C 인터페이스의 반환 값으로 변환
+    [[nodiscard]] constexpr int ToResult(_In_ const WolErrorCode result) noexcept
+    {
+        return static_cast<int>(result);
+    }
+
+    /// @brief C 인터페이스의 전송 주소를 소켓 주소로 변환
+    /// @param destination 변환할 전송 주소
+    /// @param destAddr 변환된 소켓 주소 출력
+    /// @return 성공한 경우 WolErrorCode::Success, 포트가 0이면 WolErrorCode::InvalidPort,
+    ///         주소 계열이 잘못되었거나 IPv6 주소가 멀티캐스트 주소가 아니면 WolErrorCode::InvalidBroadcastIp
+    /// @details 잠든 장치는 이웃 탐색(NDP)에 응답하지 않으므로 IPv6는 설정 파일과 같이 멀티캐스트 주소만 허용
+    [[nodiscard]] WolErrorCode ToDestinationAddress(_In_ const wol_destination& destination,
+                                                    _Out_ WakeOnLan::DestinationAddress& destAddr) noexcept
+    {
+        destAddr = {};
+        if (destination.port == 0U)
+            return WolErrorCode::InvalidPort;
+
+        switch (destination.family)
+        {
+        case WOL_FAMILY_IPV4:
+            destAddr.mIpv4.sin_family = AF_INET;
+            destAddr.mIpv4.sin_port = htons(destination.port);
+            std::memcpy(&destAddr.mIpv4.sin_addr, destination.address, sizeof(destAddr.mIpv4.sin_addr));
+            return WolErrorCode::Success;
+
+        case WOL_FAMILY_IPV6:
+            if (destination.address[0] != 0xFFU)
+                return WolErrorCode::InvalidBroadcastIp;
+
+            destAddr.mIpv6.sin6_family = AF_INET6;
+            destAddr.mIpv6.sin6_port = htons(destination.port);
+            std::memcpy(&destAddr.mIpv6.sin6_addr, destination.address, sizeof(destAddr.mIpv6.sin6_addr));
+            destAddr.mIpv6.sin6_scope_id = destination.scope_id;
+            return WolErrorCode::Success;
+
+        default:
+            return WolErrorCode::InvalidBroadcastIp;
+        }
+    }
+}
+
+extern "C" int wol_session_open(wol_session** const session)
+{
+    if (session == nullptr)
+        return ToResult(WolErrorCode::InvalidArgument);
+
+    *session = nullptr;
+
+    std::unique_ptr<wol_session> newSession{};
+    try
+    {
+        newSession = std::make_unique<wol_session>();
+    }
+    catch (...)
+    {
+        return ToResult(WolErrorCode::UnexpectedException);
+    }
+
+    const WolErrorCode result = newSession->mSession.Open();
+    if (result != WolErrorCode::Success)
+        return ToResult(result);
+
+    *session = newSession.release();
+    return ToResult(WolErrorCode::Success);
+}
+
+extern "C" int wol_send_batch(wol_session* const session, const std::uint8_t* const macs,
+                              const wol_destination* const destinations, const std::size_t destination_count,
+                              const std::size_t count, std::uint8_t* const results)
+{
+    if (session == nullptr || (destination_count != 1U && destination_count != count))
+        return ToResult(WolErrorCode::InvalidArgument);
+
+    if (count == 0U)
+        return ToResult(WolErrorCode::Success);
+
+    if (macs == nullptr || destinations == nullptr)
+        return ToResult(WolErrorCode::InvalidArgument);
+
+    try
+    {
+        // 이전 호출보다 대상이 많을 때만 할당 (크기를 줄여도 용량은 유지)
+        std::vector<WakeOnLan::WolPacket>& packets = session->mPackets;
+        packets.resize(count);
+
+        // 주소를 모두 변환한 뒤에 전송하므로 잘못된 주소가 있으면 어떤 대상에게도 보내지 않음
+        WakeOnLan::DestinationAddress sharedAddr{};
+        if (destination_count == 1U)
+        {
+            const WolErrorCode result = ToDestinationAddress(destinations[0], sharedAddr);
+            if (result != WolErrorCode::Success)
+                return ToResult(result);
+        }
+
+        for (std::size_t i = 0U; i < count; ++i)
+        {
+            WakeOnLan::WolPacket& packet = packets[i];
+            if (destination_count == 1U)
+            {
+                packet.mDestAddr = sharedAddr;
+            }
+            else
+            {
+                const WolErrorCode result = ToDestinationAddress(destinations[i], packet.mDestAddr);
+                if (result != WolErrorCode::Success)
+                    return ToResult(result);
+            }
+
+            // 호출마다 다른 MAC 주소 목록을 받으므로 캐시(MagicPacketCache)에 넣지 않고 바로 생성
+            WakeOnLan::MacAddress macAddress{};
+            std::memcpy(macAddress.data(), macs + (i * macAddress.size()), macAddress.size());
+            WakeOnLan::CreateMagicPacket(macAddress, packet.mPacket);
+            packet.mRack = 0U;
+        }
+
+        const WolErrorCode result = session->mSession.SendBatch(packets, session->mResults);
+        if (result != WolErrorCode::Success)
+            return ToResult(result);
+
+        bool allSent = true;
+        for (std::size_t i = 0U; i < count; ++i)
+        {
+            const WolErrorCode packetResult = session->mResults[i];
+            if (results != nullptr)
+                results[i] = static_cast<std::uint8_t>(packetResult);
+
+            allSent = allSent && packetResult == WolErrorCode::Success;
+        }
+
+        return ToResult(allSent ? WolErrorCode::Success : WolErrorCode::PacketSendFailed);
+    }
+    catch (...)
+    {
+        return ToResult(WolErrorCode::UnexpectedException);
+    }
+}
+
+extern "C" void wol_session_close(wol_session* const session)
+{
+    // 소멸자가 세션의 소켓을 닫고 WsaGuard 참조 카운트를 감소시킴
+    delete session;
+}
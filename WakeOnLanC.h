@@ -0,0 +1,103 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Wake-on-LAN(WOL) 라이브러리의 C 인터페이스
+///
+/// @details
+/// C, Python(ctypes/cffi), Go(cgo) 등 C++ 헤더(WakeOnLan.h)를 사용할 수 없는 언어에서
+/// WOL 프로세스를 실행하지 않고 매직 패킷을 전송하기 위한 함수
+///
+/// - 세션(wol_session)은 소켓을 한 번만 열어 두고 여러 번의 wol_send_batch() 호출에 재사용
+/// - MAC 주소와 전송 주소는 문자열이 아닌 이진 배열로 전달하므로 호출 한 번에 대상 수와 관계없이
+///   일괄 전송하며, 세션이 유지하는 버퍼보다 많은 대상을 보낼 때만 메모리를 할당
+/// - 반환 값과 결과 값은 WolErrorCode와 같은 값 (콘솔 애플리케이션의 종료 코드와 같음)
+/// - 하나의 세션을 여러 스레드에서 동시에 사용하지 않음 (스레드마다 세션을 열어 사용)
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief 전송 결과 코드 (WakeOnLan::WolErrorCode와 같은 값)
+/// @details 값은 바꾸지 않으며, 새 값은 WolErrorCode에 추가할 때 함께 추가
+enum
+{
+    WOL_SUCCESS = 0,
+    WOL_INVALID_MAC_ADDRESS = 7,
+    WOL_INVALID_BROADCAST_IP = 9,
+    WOL_INVALID_PORT = 11,
+    WOL_WINSOCK_INITIALIZATION_FAILED = 12,
+    WOL_SOCKET_CREATION_FAILED = 13,
+    WOL_BROADCAST_SETUP_FAILED = 14,
+    WOL_PACKET_SEND_FAILED = 15,
+    WOL_UNEXPECTED_EXCEPTION = 16,
+    WOL_INVALID_ARGUMENT = 21
+};
+
+/// @brief wol_destination::family 값
+enum
+{
+    WOL_FAMILY_IPV4 = 4, /// IPv4 브로드캐스트 주소
+    WOL_FAMILY_IPV6 = 6 /// IPv6 멀티캐스트 주소 (ff00::/8)
+};
+
+/// @brief 매직 패킷을 전송할 주소 (24바이트, 안쪽 여백 없음)
+/// @details 바인딩에서 구조체 배열을 그대로 넘길 수 있도록 모든 필드의 크기와 순서를 고정
+typedef struct wol_destination
+{
+    /// @brief 주소 바이트 (네트워크 바이트 순서)
+    /// @details IPv4는 앞의 4바이트만 사용 (예: 192.168.0.255 → c0 a8 00 ff), IPv6는 16바이트 모두 사용
+    uint8_t address[16];
+
+    /// @brief IPv6 링크 로컬 그룹(ff02::)을 전송할 인터페이스 번호 (0이면 운영체제의 기본 인터페이스, IPv4는 무시)
+    uint32_t scope_id;
+
+    /// @brief UDP 포트 번호 (호스트 바이트 순서, 1~65535)
+    uint16_t port;
+
+    /// @brief 주소 계열 (WOL_FAMILY_IPV4 또는 WOL_FAMILY_IPV6)
+    uint8_t family;
+
+    /// @brief 사용하지 않음 (0으로 채움)
+    uint8_t reserved;
+} wol_destination;
+
+/// @brief 전송 세션 (wol_session_open()으로 생성하고 wol_session_close()로 해제)
+typedef struct wol_session wol_session;
+
+/// @brief 전송 세션을 생성하고 소켓을 초기화
+/// @param session 생성된 세션 출력 (실패한 경우 NULL)
+/// @return 성공한 경우 WOL_SUCCESS, 실패한 경우 WolErrorCode 값
+int wol_session_open(wol_session** session);
+
+/// @brief 여러 대상에게 매직 패킷을 한 번에 전송
+/// @param session wol_session_open()으로 생성한 세션
+/// @param macs MAC 주소 배열 (대상마다 6바이트, count * 6바이트)
+/// @param destinations 전송 주소 배열 (destination_count개)
+/// @param destination_count 1이면 모든 대상을 destinations[0]으로 전송, count이면 대상마다 같은 위치의 주소로 전송
+/// @param count 대상 수
+/// @param results 대상별 전송 결과 출력 (count바이트, WOL_SUCCESS 또는 WOL_PACKET_SEND_FAILED, NULL이면 기록하지 않음)
+/// @return 모든 대상을 전송한 경우 WOL_SUCCESS, 하나 이상 실패한 경우 WOL_PACKET_SEND_FAILED,
+///         인자가 잘못된 경우 전송하지 않고 WOL_INVALID_ARGUMENT, WOL_INVALID_BROADCAST_IP 또는 WOL_INVALID_PORT
+int wol_send_batch(wol_session* session, const uint8_t* macs, const wol_destination* destinations,
+                   size_t destination_count, size_t count, uint8_t* results);
+
+/// @brief 세션의 소켓을 닫고 세션을 해제 (NULL이면 아무것도 하지 않음)
+void wol_session_close(wol_session* session);
+
+#ifdef __cplusplus
+}
+#endif
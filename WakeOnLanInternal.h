@@ -0,0 +1,181 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Wake-on-LAN(WOL) 라이브러리의 내부 헤더
+///
+/// @details
+/// 라이브러리와 콘솔 애플리케이션의 소스 파일(.cpp)에서만 포함하며, 라이브러리를 사용하는 프로그램에는 제공하지 않음
+///
+/// - POSIX에서 WinSock과 같은 이름으로 사용하는 정의 (SOCKET, closesocket() 등)와 SAL 주석 매크로
+/// - 구현에만 필요한 시스템 헤더 (io_uring, 네트워크 인터페이스 조회 등)
+/// - 구현에만 사용하는 클래스 (IoUringQueue)
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "WakeOnLan.h"
+
+#ifdef _WIN32
+#include <sal.h>
+#include <iphlpapi.h>
+
+#include <MSWSock.h>	// WinSock2.h 헤더 하위에 있어야 함
+#else
+#include <fcntl.h>
+#include <ifaddrs.h>
+#include <net/if.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/select.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
+// SAL 주석은 MSVC 전용이므로 다른 컴파일러에서는 빈 매크로로 정의
+#define _In_
+#define _In_opt_
+#define _Out_
+#define _Inout_
+#define _In_range_(min, max)
+#define _In_reads_(size)
+#define _Out_writes_(size)
+
+/// @brief POSIX 소켓 핸들을 WinSock과 같은 이름으로 사용하기 위한 정의
+/// @details POSIX에서 소켓은 파일 디스크립터(int)이며 실패 시 -1을 반환
+using SOCKET = WakeOnLan::SocketHandle;
+constexpr SOCKET INVALID_SOCKET{WakeOnLan::INVALID_SOCKET_HANDLE};
+constexpr int SOCKET_ERROR{-1};
+
+/// @brief WinSock closesocket()에 대응하는 POSIX 함수
+inline int closesocket(const SOCKET socket) noexcept { return ::close(socket); }
+
+/// @brief WinSock WSAGetLastError()에 대응하는 POSIX 함수
+inline int WSAGetLastError() noexcept { return errno; }
+
+/// @brief WinSock WSAPOLLFD에 대응하는 POSIX 구조체
+using WSAPOLLFD = WakeOnLan::PollDescriptor;
+
+/// @brief WinSock WSAPoll()에 대응하는 POSIX 함수
+inline int WSAPoll(WSAPOLLFD* const fds, const unsigned long count, const int timeout) noexcept
+{
+    return ::poll(fds, static_cast<nfds_t>(count), timeout);
+}
+#endif
+
+namespace WakeOnLan
+{
+    /// @brief io_uring 제출/완료 큐로 데이터그램을 전송하는 클래스
+    /// @details liburing 없이 시스템 호출(io_uring_setup, io_uring_enter)과 공유 메모리 링을 직접 사용
+    ///          - 메시지마다 IORING_OP_SENDMSG 요청(SQE)을 채워 묶음 전체를 io_uring_enter() 한 번으로 제출하고,
+    ///            같은 호출에서 완료(CQE)를 기다린 뒤 한꺼번에 수거
+    ///          - 큐 하나는 한 스레드에서만 사용 (여러 스레드에서 전송하면 스레드마다 큐를 만듦)
+    ///          - Linux가 아니거나 io_uring을 사용할 수 없는 환경(커널 5.6 미만, kernel.io_uring_disabled, seccomp 등)에서는
+    ///            Open()이 실패하며, 호출자는 소켓 API로 전송
+    class IoUringQueue final
+    {
+    public:
+        /// @brief 기본 생성자
+        /// @details 링은 Open()을 호출하기 전까지 생성되지 않음
+        IoUringQueue() noexcept = default;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        IoUringQueue(const IoUringQueue& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        IoUringQueue(IoUringQueue&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        IoUringQueue& operator=(const IoUringQueue& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        IoUringQueue& operator=(IoUringQueue&& other) noexcept = delete;
+
+        /// @brief 소멸자
+        /// @details 링의 공유 메모리를 해제하고 링 파일 디스크립터를 닫음
+        ~IoUringQueue() noexcept { Close(); }
+
+        /// @brief 링을 생성
+        /// @param entries 한 번에 제출할 수 있는 요청 수 (커널이 2의 거듭제곱으로 올림)
+        /// @return 링을 만들었고 커널이 IORING_OP_SENDMSG를 지원하면 true
+        /// @note 이미 열린 큐에서 다시 호출하면 아무 작업도 하지 않음
+        [[nodiscard]] bool Open(_In_ unsigned int entries) noexcept;
+
+        /// @brief 링이 열려 있는지 확인
+        [[nodiscard]] bool IsOpen() const noexcept { return mRingFd >= 0; }
+
+#ifdef __linux__
+        /// @brief 메시지들을 IORING_OP_SENDMSG 요청으로 제출하고 모든 완료를 기다림
+        /// @param socket 전송할 소켓
+        /// @param messages 전송할 메시지 (sendmmsg()와 같은 형식, msg_len은 사용하지 않음)
+        /// @param count 메시지 수
+        /// @param results 메시지별 sendmsg() 결과 출력 (전송한 바이트 수 또는 -errno)
+        /// @return 결과를 기록한 메시지 수 (앞에서부터 연속, count보다 작으면 나머지는 호출자가 다른 방식으로 전송)
+        /// @details io_uring_enter()가 EINTR 이외의 이유로 실패하면 링을 닫고 반환하며, 이후 IsOpen()은 false
+        ///          이 경우 이미 제출한 요청의 완료를 모두 수거한 뒤 제출한 요청까지의 수를 반환하므로
+        ///          호출자는 반환 값 이후의 메시지만 다시 전송 (같은 대상에게 중복으로 전송하지 않음)
+        [[nodiscard]] std::size_t SendMessages(_In_ SOCKET socket, _In_ mmsghdr* messages, _In_ std::size_t count,
+                                               _Out_ int* results) noexcept;
+#endif
+
+    private:
+        /// @brief 링의 공유 메모리를 해제하고 링 파일 디스크립터를 닫음
+        void Close() noexcept;
+
+    private:
+        /// @brief io_uring_setup()이 반환한 링 파일 디스크립터 (열리지 않았다면 -1)
+        int mRingFd{-1};
+
+#ifdef __linux__
+        /// @brief 제출 큐 링의 공유 메모리 (IORING_FEAT_SINGLE_MMAP이면 완료 큐 링과 같은 영역)
+        void* mSqRing{nullptr};
+
+        /// @brief 제출 큐 링의 공유 메모리 크기
+        std::size_t mSqRingSize{0U};
+
+        /// @brief 완료 큐 링의 공유 메모리
+        void* mCqRing{nullptr};
+
+        /// @brief 완료 큐 링의 공유 메모리 크기
+        std::size_t mCqRingSize{0U};
+
+        /// @brief 요청(SQE) 배열의 공유 메모리
+        io_uring_sqe* mSqes{nullptr};
+
+        /// @brief 요청 배열의 크기 (요청 수)
+        unsigned int mSqEntries{0U};
+
+        /// @brief 제출 큐의 꼬리 (이 프로세스가 쓰고 커널이 읽음)
+        unsigned int* mSqTail{nullptr};
+
+        /// @brief 제출 큐의 색인 마스크
+        unsigned int mSqMask{0U};
+
+        /// @brief 제출 큐의 요청 색인 배열
+        unsigned int* mSqArray{nullptr};
+
+        /// @brief 완료 큐의 머리 (이 프로세스가 쓰고 커널이 읽음)
+        unsigned int* mCqHead{nullptr};
+
+        /// @brief 완료 큐의 꼬리 (커널이 쓰고 이 프로세스가 읽음)
+        const unsigned int* mCqTail{nullptr};
+
+        /// @brief 완료 큐의 색인 마스크
+        unsigned int mCqMask{0U};
+
+        /// @brief 완료(CQE) 배열
+        const io_uring_cqe* mCqes{nullptr};
+#endif
+    };
+}
@@ -0,0 +1,191 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief 비동기 전송(WakeOnLanAsyncSender)의 요청과 완료 시간 측정
+///
+/// @details
+/// 이벤트 루프 서비스와 같이 한 스레드에서 Wake()를 연속으로 호출하고, poll()(Windows: WSAPoll())로
+/// GetNotifySocket()을 기다려 DispatchCompletions()로 완료 콜백을 받으며 다음 시간을 측정
+///
+/// - Wake() 호출 한 번의 시간 (요청을 대기열에 넣고 바로 반환)
+/// - 첫 Wake() 호출부터 모든 콜백이 호출될 때까지의 시간
+/// - 요청별 완료 시간 (AsyncWakeResult::mElapsed, Wake() 호출부터 결과가 정해질 때까지)
+/// - DispatchCompletions() 한 번이 이벤트 루프 스레드를 점유한 가장 긴 시간
+///
+/// 대상은 읽지 않는 루프백 UDP 소켓이며, 켜졌는지 확인(verify)하지 않음
+///
+/// 사용법: AsyncWakeBenchmark [동시 요청 수 (기본값 10000)]
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BenchmarkSupport.h"
+
+namespace
+{
+    using WakeOnLan::WolErrorCode;
+    using WakeOnLanBenchmark::Clock;
+
+    /// @brief 기본 동시 요청 수
+    constexpr std::size_t DEFAULT_REQUEST_COUNT{10000U};
+
+    /// @brief 모든 콜백을 기다리는 최대 시간
+    constexpr std::chrono::seconds COMPLETION_TIMEOUT{30};
+
+    /// @brief 알림 소켓을 한 번에 기다리는 최대 시간
+    constexpr std::chrono::milliseconds POLL_TIMEOUT{100};
+
+    /// @brief 완료 콜백이 기록하는 결과
+    struct CompletionLog final
+    {
+        /// @brief 요청별 완료 시간 (마이크로초)
+        std::vector<double> mElapsed{};
+
+        /// @brief 전송에 실패한 요청 수
+        std::size_t mFailedCount{0U};
+    };
+
+    /// @brief 루프백 주소로 보내는 대상 목록을 만듦 (대상마다 MAC 주소가 다름)
+    /// @param port 전송할 루프백 포트
+    /// @param targets 만든 대상 목록 출력 (크기만큼 채움)
+    void FillTargets(const std::uint16_t port, std::vector<WakeOnLan::WolTarget>& targets) noexcept
+    {
+        for (std::size_t i = 0U; i < targets.size(); ++i)
+        {
+            WakeOnLan::WolTarget& target = targets[i];
+            target.mMacBytes = {std::byte{0x02}, std::byte{0x00}, static_cast<std::byte>(i >> 24U),
+                                static_cast<std::byte>(i >> 16U), static_cast<std::byte>(i >> 8U),
+                                static_cast<std::byte>(i & 0xFFU)};
+            target.mBroadcastAddr.s_addr = htonl(INADDR_LOOPBACK);
+            target.mPort = port;
+        }
+    }
+
+    /// @brief 알림 소켓이 읽기 가능 상태가 될 때까지 기다림
+    /// @return 읽기 가능하면 true, POLL_TIMEOUT 안에 알림이 없거나 실패한 경우 false
+    [[nodiscard]] bool WaitForNotify(const WakeOnLan::SocketHandle notifySocket) noexcept
+    {
+        WakeOnLan::PollDescriptor descriptor{};
+        descriptor.fd = notifySocket;
+        descriptor.events = POLLIN;
+#ifdef _WIN32
+        return ::WSAPoll(&descriptor, 1U, static_cast<int>(POLL_TIMEOUT.count())) > 0;
+#else
+        return ::poll(&descriptor, 1U, static_cast<int>(POLL_TIMEOUT.count())) > 0;
+#endif
+    }
+
+    /// @brief 요청을 모두 보내고 모든 콜백을 받을 때까지 측정하여 출력
+    /// @return 모든 요청이 성공으로 완료된 경우 true
+    [[nodiscard]] bool RunBenchmark(const std::vector<WakeOnLan::WolTarget>& targets)
+    {
+        WakeOnLan::WakeOnLanAsyncSender sender;
+        if (const WolErrorCode result = sender.Open(); result != WolErrorCode::Success)
+        {
+            std::ignore = ::fwprintf(stderr, L"비동기 전송을 열 수 없음: %ls\n", WakeOnLan::WolErrorCodeToName(result));
+            return false;
+        }
+
+        CompletionLog log{};
+        log.mElapsed.reserve(targets.size());
+        const WakeOnLan::WakeOnLanAsyncSender::Completion completion =
+            [&log](const WakeOnLan::AsyncWakeResult& result)
+        {
+            if (result.mResult != WolErrorCode::Success)
+                ++log.mFailedCount;
+
+            log.mElapsed.push_back(static_cast<double>(result.mElapsed.count()));
+        };
+
+        // 이벤트 루프 스레드에서 요청을 연속으로 보냄
+        std::vector<double> wakeSamples{};
+        wakeSamples.reserve(targets.size());
+        const Clock::time_point start = Clock::now();
+        for (const WakeOnLan::WolTarget& target : targets)
+        {
+            const Clock::time_point wakeStart = Clock::now();
+            const WolErrorCode result = sender.Wake(target, false, completion);
+            wakeSamples.push_back(std::chrono::duration<double, std::micro>(Clock::now() - wakeStart).count());
+            if (result != WolErrorCode::Success)
+            {
+                std::ignore = ::fwprintf(stderr, L"Wake 실패: %ls\n", WakeOnLan::WolErrorCodeToName(result));
+                return false;
+            }
+        }
+
+        const double submitMilliseconds = WakeOnLanBenchmark::GetElapsedMilliseconds(start);
+
+        // 알림 소켓을 기다려 완료 콜백을 받음
+        double longestDispatch = 0.0;
+        std::size_t dispatchCount = 0U;
+        while (log.mElapsed.size() < targets.size() && Clock::now() - start < COMPLETION_TIMEOUT)
+        {
+            if (WaitForNotify(sender.GetNotifySocket()) == false)
+                continue;
+
+            const Clock::time_point dispatchStart = Clock::now();
+            if (sender.DispatchCompletions() > 0U)
+                ++dispatchCount;
+
+            const double dispatchMicroseconds =
+                std::chrono::duration<double, std::micro>(Clock::now() - dispatchStart).count();
+            longestDispatch = std::max(longestDispatch, dispatchMicroseconds);
+        }
+
+        const double totalMilliseconds = WakeOnLanBenchmark::GetElapsedMilliseconds(start);
+        const std::size_t completedCount = log.mElapsed.size();
+        sender.Close();
+
+        std::ignore = ::wprintf(L"동시 요청 %zu개, 완료 %zu개 (실패 %zu개), 콜백을 호출한 DispatchCompletions() %zu회\n",
+                                targets.size(), completedCount, log.mFailedCount, dispatchCount);
+        WakeOnLanBenchmark::PrintLatency(L"Wake()", WakeOnLanBenchmark::Summarize(wakeSamples));
+        WakeOnLanBenchmark::PrintLatency(L"Wake() -> completion", WakeOnLanBenchmark::Summarize(log.mElapsed));
+        std::ignore = ::wprintf(L"%-34ls %10.2f ms\n", L"all Wake() calls", submitMilliseconds);
+        std::ignore = ::wprintf(L"%-34ls %10.2f ms\n", L"all callbacks", totalMilliseconds);
+        std::ignore = ::wprintf(L"%-34ls %10.2f us\n", L"longest DispatchCompletions()", longestDispatch);
+
+        return completedCount == targets.size() && log.mFailedCount == 0U;
+    }
+}
+
+int main(const int argc, char* argv[])
+{
+    WakeOnLanBenchmark::InitializeOutput();
+
+    const std::size_t count = WakeOnLanBenchmark::GetCount(argc, argv, DEFAULT_REQUEST_COUNT);
+
+    WakeOnLan::WsaGuard wsaGuard;
+    if (wsaGuard.Initialize() != WolErrorCode::Success)
+    {
+        std::ignore = ::fwprintf(stderr, L"WinSock을 초기화할 수 없습니다.\n");
+        return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+    }
+
+    WakeOnLanBenchmark::LoopbackSink sink;
+    if (sink.Open() == false)
+    {
+        std::ignore = ::fwprintf(stderr, L"127.0.0.1에 바인딩할 수 없습니다.\n");
+        return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+    }
+
+    try
+    {
+        std::vector<WakeOnLan::WolTarget> targets(count);
+        FillTargets(sink.GetPort(), targets);
+        if (RunBenchmark(targets) == false)
+            return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+    }
+    catch (...)
+    {
+        std::ignore = ::fwprintf(stderr, L"대상 목록을 저장할 메모리가 부족합니다.\n");
+        return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+    }
+
+    return 0;
+}
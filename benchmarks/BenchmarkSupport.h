@@ -0,0 +1,210 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief 성능 측정 공용 함수
+///
+/// @details
+/// 성능 측정 프로그램(benchmarks/)이 함께 사용하는 시간 측정, 통계 출력 함수와 루프백 수신 소켓
+///
+/// - 측정 프로그램은 첫 번째 인자로 반복 횟수(또는 대상 수)를 받고, 없으면 각 프로그램의 기본값을 사용
+/// - 측정 결과는 실행 환경에 따라 달라지므로 같은 컴퓨터에서 비교하는 용도로만 사용
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "WakeOnLan.h"
+
+#include <clocale>
+#include <cstdlib>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+namespace WakeOnLanBenchmark
+{
+    /// @brief 측정에 사용하는 시계
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief 측정을 진행할 수 없을 때의 종료 코드
+    inline constexpr int FAILURE_EXIT_CODE{1};
+
+    /// @brief 한글 출력을 준비 (main.cpp와 같은 방식)
+    inline void InitializeOutput() noexcept
+    {
+#ifdef _WIN32
+        std::ignore = _setmode(_fileno(stdout), _O_U16TEXT);
+        std::ignore = _setmode(_fileno(stderr), _O_U16TEXT);
+#else
+        if (const char* const locale = std::setlocale(LC_ALL, "");
+            locale == nullptr || std::string_view{locale}.find("UTF-8") == std::string_view::npos)
+        {
+            std::ignore = std::setlocale(LC_ALL, "C.UTF-8");
+        }
+#endif
+    }
+
+    /// @brief 첫 번째 인자에서 반복 횟수를 읽음
+    /// @param argc main()의 인자 수
+    /// @param argv main()의 인자
+    /// @param defaultCount 인자가 없거나 0 이하일 때 사용할 값
+    [[nodiscard]] inline std::size_t GetCount(const int argc, char* argv[], const std::size_t defaultCount) noexcept
+    {
+        if (argc < 2)
+            return defaultCount;
+
+        const long long count = std::strtoll(argv[1], nullptr, 10);
+        return count > 0 ? static_cast<std::size_t>(count) : defaultCount;
+    }
+
+    /// @brief 측정 결과를 기록하는 변수 (KeepResult())
+    inline volatile std::uint32_t sResultSink{0U};
+
+    /// @brief 측정한 코드의 결과를 volatile 변수에 기록하여 컴파일러가 측정할 코드를 생략하지 못하게 함
+    inline void KeepResult(const std::uint32_t value) noexcept
+    {
+        sResultSink = value;
+    }
+
+    /// @brief 시작 시각부터 지금까지의 시간 (밀리초)
+    [[nodiscard]] inline double GetElapsedMilliseconds(const Clock::time_point start) noexcept
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    /// @brief 측정값 목록의 통계
+    struct LatencySummary final
+    {
+        /// @brief 평균 (마이크로초)
+        double mMean{0.0};
+
+        /// @brief 중앙값 (마이크로초)
+        double mP50{0.0};
+
+        /// @brief 99번째 백분위수 (마이크로초)
+        double mP99{0.0};
+
+        /// @brief 최댓값 (마이크로초)
+        double mMax{0.0};
+    };
+
+    /// @brief 측정값 목록의 통계를 계산
+    /// @param samples 측정값 목록 (마이크로초, 정렬됨)
+    [[nodiscard]] inline LatencySummary Summarize(std::vector<double>& samples) noexcept
+    {
+        LatencySummary summary{};
+        if (samples.empty())
+            return summary;
+
+        std::sort(samples.begin(), samples.end());
+
+        double total = 0.0;
+        for (const double sample : samples)
+            total += sample;
+
+        const auto percentile = [&samples](const double ratio) noexcept
+        {
+            return samples[static_cast<std::size_t>(ratio * static_cast<double>(samples.size() - 1U))];
+        };
+
+        summary.mMean = total / static_cast<double>(samples.size());
+        summary.mP50 = percentile(0.50);
+        summary.mP99 = percentile(0.99);
+        summary.mMax = samples.back();
+        return summary;
+    }
+
+    /// @brief 지연 시간 통계를 한 줄로 출력
+    /// @param name 측정 항목 이름
+    /// @param summary 출력할 통계
+    inline void PrintLatency(const wchar_t* const name, const LatencySummary& summary) noexcept
+    {
+        std::ignore = ::wprintf(L"%-34ls 평균 %9.2f us  p50 %9.2f us  p99 %9.2f us  최대 %9.2f us\n", name,
+                                summary.mMean, summary.mP50, summary.mP99, summary.mMax);
+    }
+
+    /// @brief 처리량을 한 줄로 출력
+    /// @param name 측정 항목 이름
+    /// @param count 처리한 항목 수
+    /// @param milliseconds 걸린 시간 (밀리초)
+    /// @param unit 항목 단위 (예: L"pkt")
+    inline void PrintThroughput(const wchar_t* const name, const std::size_t count, const double milliseconds,
+                                const wchar_t* const unit) noexcept
+    {
+        const double perSecond = milliseconds > 0.0 ? static_cast<double>(count) * 1000.0 / milliseconds : 0.0;
+        std::ignore = ::wprintf(L"%-34ls %10zu개  %10.2f ms  %12.0f %ls/s\n", name, count, milliseconds, perSecond,
+                                unit);
+    }
+
+    /// @brief 127.0.0.1의 임의 포트에 바인딩하고 읽지 않는 UDP 소켓
+    /// @details 전송 경로만 측정하기 위해 받은 데이터그램을 읽지 않음 (수신 버퍼가 차면 커널이 버림)
+    /// @pre WinSock이 초기화되어 있어야 함 (WakeOnLan::WsaGuard)
+    class LoopbackSink final
+    {
+    public:
+        /// @brief 기본 생성자
+        LoopbackSink() noexcept = default;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        LoopbackSink(const LoopbackSink& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        LoopbackSink(LoopbackSink&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        LoopbackSink& operator=(const LoopbackSink& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        LoopbackSink& operator=(LoopbackSink&& other) noexcept = delete;
+
+        /// @brief 소멸자 - 기본 소멸자 사용
+        ~LoopbackSink() noexcept = default;
+
+        /// @brief 127.0.0.1의 임의 포트에 바인딩
+        /// @return 성공한 경우 true
+        [[nodiscard]] bool Open() noexcept
+        {
+            const WakeOnLan::SocketHandle handle = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+            if (handle == WakeOnLan::INVALID_SOCKET_HANDLE)
+                return false;
+
+            mSocket.Set(handle);
+
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            if (::bind(mSocket.Get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+                return false;
+
+            socklen_t addressLength = sizeof(address);
+            if (::getsockname(mSocket.Get(), reinterpret_cast<sockaddr*>(&address), &addressLength) != 0)
+                return false;
+
+            mDestAddr = {};
+            mDestAddr.mIpv4 = address;
+            return true;
+        }
+
+        /// @brief 바인딩한 주소를 전송 주소로 반환
+        [[nodiscard]] const WakeOnLan::DestinationAddress& GetDestination() const noexcept { return mDestAddr; }
+
+        /// @brief 바인딩한 포트를 반환 (호스트 바이트 순서)
+        [[nodiscard]] std::uint16_t GetPort() const noexcept { return ntohs(mDestAddr.mIpv4.sin_port); }
+
+    private:
+        /// @brief 수신 소켓
+        WakeOnLan::Socket mSocket;
+
+        /// @brief 바인딩한 주소
+        WakeOnLan::DestinationAddress mDestAddr{};
+    };
+}
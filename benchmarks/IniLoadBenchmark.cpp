@@ -0,0 +1,199 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief 설정 파일 로드 시간 측정
+///
+/// @details
+/// 임시 폴더에 대상 섹션이 많은 설정 파일을 만들고 WolConfig의 로드 시간을 측정
+///
+/// - LoadFromIni(): 파일을 한 번 읽어 모든 섹션을 해석하고 검증
+/// - Reload() (변경 없음): 모든 섹션을 이전 스냅샷에서 재사용
+/// - Reload() (섹션 하나 변경): 바뀐 섹션만 다시 해석하고 검증
+///
+/// 사용법: IniLoadBenchmark [대상 섹션 수 (기본값 10000)]
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BenchmarkSupport.h"
+
+namespace
+{
+    using WakeOnLan::WolErrorCode;
+    using WakeOnLanBenchmark::Clock;
+
+    /// @brief 기본 대상 섹션 수
+    constexpr std::size_t DEFAULT_SECTION_COUNT{10000U};
+
+    /// @brief 측정 횟수 (가장 빠른 측정값을 사용)
+    constexpr int ROUND_COUNT{5};
+
+    /// @brief 임시 폴더에 만드는 설정 파일 이름
+    constexpr std::wstring_view BENCHMARK_FILE_NAME{L"WolIniLoadBenchmark.ini"};
+
+    /// @brief 대상 섹션이 count개인 설정 파일을 씀
+    /// @param path 설정 파일 경로
+    /// @param count 대상 섹션 수
+    /// @param revision 첫 번째 섹션의 MAC 주소 마지막 바이트 (바꾸면 그 섹션만 내용이 달라짐)
+    /// @return 성공한 경우 true
+    [[nodiscard]] bool WriteConfigFile(const std::filesystem::path& path, const std::size_t count,
+                                       const unsigned revision)
+    {
+        std::string text{};
+        text.reserve(count * 96U);
+
+        std::array<char, 160U> section{};
+        for (std::size_t i = 0U; i < count; ++i)
+        {
+            const unsigned last = i == 0U ? (revision & 0xFFU) : static_cast<unsigned>(i & 0xFFU);
+            const int length = std::snprintf(
+                section.data(), section.size(),
+                "[Target.Node%05zu]\nMacAddress=02-00-5E-%02X-%02X-%02X\nBroadcastIp=127.255.255.255\nPort=9\nRack=%zu\n\n",
+                i, static_cast<unsigned>((i >> 16U) & 0xFFU), static_cast<unsigned>((i >> 8U) & 0xFFU), last,
+                (i / 40U) + 1U);
+            if (length <= 0 || static_cast<std::size_t>(length) >= section.size())
+                return false;
+
+            text.append(section.data(), static_cast<std::size_t>(length));
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(text.data(), static_cast<std::streamsize>(text.size()));
+        return file.good();
+    }
+
+    /// @brief LoadFromIni()의 시간 중 가장 짧은 시간을 측정 (밀리초, 실패하면 음수)
+    /// @param path 설정 파일 경로
+    /// @param loadedCount 로드한 대상 수 출력
+    [[nodiscard]] double MeasureLoad(const std::filesystem::path& path, std::size_t& loadedCount)
+    {
+        double bestMilliseconds = 0.0;
+        for (int round = 0; round < ROUND_COUNT; ++round)
+        {
+            WakeOnLan::WolConfig config;
+            config.SetConfigFilePath(path.wstring());
+
+            const Clock::time_point start = Clock::now();
+            const WolErrorCode result = config.LoadFromIni();
+            const double milliseconds = WakeOnLanBenchmark::GetElapsedMilliseconds(start);
+            if (result != WolErrorCode::Success)
+            {
+                std::ignore = ::fwprintf(stderr, L"LoadFromIni 실패: %ls\n", WakeOnLan::WolErrorCodeToName(result));
+                return -1.0;
+            }
+
+            loadedCount = config.GetTargets().size();
+            if (round == 0 || milliseconds < bestMilliseconds)
+                bestMilliseconds = milliseconds;
+        }
+
+        return bestMilliseconds;
+    }
+
+    /// @brief Reload()의 시간 중 가장 짧은 시간을 측정 (밀리초, 실패하면 음수)
+    /// @param config LoadFromIni()에 성공한 설정
+    /// @param path 설정 파일 경로
+    /// @param count 대상 섹션 수
+    /// @param changeSection true이면 측정할 때마다 첫 번째 섹션을 바꿔 씀
+    /// @param reloadResult 마지막 Reload()의 재사용/다시 검증/제외된 대상 수 출력
+    [[nodiscard]] double MeasureReload(WakeOnLan::WolConfig& config, const std::filesystem::path& path,
+                                       const std::size_t count, const bool changeSection,
+                                       WakeOnLan::ConfigReloadResult& reloadResult)
+    {
+        double bestMilliseconds = 0.0;
+        for (int round = 0; round < ROUND_COUNT; ++round)
+        {
+            if (changeSection && WriteConfigFile(path, count, static_cast<unsigned>(round + 1)) == false)
+                return -1.0;
+
+            const Clock::time_point start = Clock::now();
+            const WolErrorCode result = config.Reload(reloadResult);
+            const double milliseconds = WakeOnLanBenchmark::GetElapsedMilliseconds(start);
+            if (result != WolErrorCode::Success)
+            {
+                std::ignore = ::fwprintf(stderr, L"Reload 실패: %ls\n", WakeOnLan::WolErrorCodeToName(result));
+                return -1.0;
+            }
+
+            if (round == 0 || milliseconds < bestMilliseconds)
+                bestMilliseconds = milliseconds;
+        }
+
+        return bestMilliseconds;
+    }
+
+    /// @brief 설정 파일을 만들고 세 가지 로드 시간을 측정하여 출력
+    /// @return 모두 측정한 경우 true
+    [[nodiscard]] bool RunBenchmark(const std::filesystem::path& path, const std::size_t count)
+    {
+        if (WriteConfigFile(path, count, 0U) == false)
+        {
+            std::ignore = ::fwprintf(stderr, L"설정 파일을 쓸 수 없습니다: %ls\n", path.wstring().c_str());
+            return false;
+        }
+
+        std::size_t loadedCount = 0U;
+        const double loadMilliseconds = MeasureLoad(path, loadedCount);
+        if (loadMilliseconds < 0.0)
+            return false;
+
+        WakeOnLan::WolConfig config;
+        config.SetConfigFilePath(path.wstring());
+        if (config.LoadFromIni() != WolErrorCode::Success)
+            return false;
+
+        WakeOnLan::ConfigReloadResult unchangedResult{};
+        const double unchangedMilliseconds = MeasureReload(config, path, count, false, unchangedResult);
+        if (unchangedMilliseconds < 0.0)
+            return false;
+
+        WakeOnLan::ConfigReloadResult changedResult{};
+        const double changedMilliseconds = MeasureReload(config, path, count, true, changedResult);
+        if (changedMilliseconds < 0.0)
+            return false;
+
+        std::ignore = ::wprintf(L"대상 섹션 %zu개, 파일 %ju바이트 (%d회 중 가장 빠른 값)\n", loadedCount,
+                                static_cast<std::uintmax_t>(std::filesystem::file_size(path)), ROUND_COUNT);
+        WakeOnLanBenchmark::PrintThroughput(L"LoadFromIni", loadedCount, loadMilliseconds, L"section");
+        WakeOnLanBenchmark::PrintThroughput(L"Reload (unchanged)", loadedCount, unchangedMilliseconds, L"section");
+        WakeOnLanBenchmark::PrintThroughput(L"Reload (1 section changed)", loadedCount, changedMilliseconds,
+                                            L"section");
+        std::ignore = ::wprintf(L"  변경 없음: 재사용 %zu, 다시 검증 %zu / 섹션 하나 변경: 재사용 %zu, 다시 검증 %zu\n",
+                                unchangedResult.mUnchanged, unchangedResult.mReloaded, changedResult.mUnchanged,
+                                changedResult.mReloaded);
+        return true;
+    }
+}
+
+int main(const int argc, char* argv[])
+{
+    WakeOnLanBenchmark::InitializeOutput();
+
+    const std::size_t count = WakeOnLanBenchmark::GetCount(argc, argv, DEFAULT_SECTION_COUNT);
+
+    bool succeeded = false;
+    std::filesystem::path path{};
+    try
+    {
+        path = std::filesystem::temp_directory_path() / BENCHMARK_FILE_NAME;
+        succeeded = RunBenchmark(path, count);
+    }
+    catch (...)
+    {
+        std::ignore = ::fwprintf(stderr, L"설정 파일을 준비하는 중 예외가 발생했습니다.\n");
+    }
+
+    if (path.empty() == false)
+    {
+        std::error_code errorCode{};
+        std::ignore = std::filesystem::remove(path, errorCode);
+    }
+
+    return succeeded ? 0 : WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+}
@@ -0,0 +1,217 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief MAC 주소 변환 시간 측정
+///
+/// @details
+/// 네 가지 형식(하이픈, 콜론, Cisco 점, 구분자 없음)을 같은 비율로 섞은 MAC 주소 목록을 ParseMacAddress()로 변환하며
+/// 주소 하나의 변환 시간을 측정
+///
+/// - 비교용으로 하이픈 형식만 처리하는 swscanf() 변환 시간도 함께 측정
+/// - 측정 전에 모든 주소가 변환되고 바이트 값이 생성한 값과 같은지 확인하며, 다르면 종료 코드 1로 종료
+///
+/// 사용법: MacParseBenchmark [주소 수 (기본값 1000000)]
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BenchmarkSupport.h"
+
+namespace
+{
+    using WakeOnLan::MacAddress;
+    using WakeOnLanBenchmark::Clock;
+
+    /// @brief 기본 주소 수
+    constexpr std::size_t DEFAULT_ADDRESS_COUNT{1000000U};
+
+    /// @brief 측정 횟수 (가장 빠른 측정값을 사용)
+    constexpr int ROUND_COUNT{5};
+
+    /// @brief 생성할 MAC 주소 형식의 수 (하이픈, 콜론, Cisco 점, 구분자 없음)
+    constexpr std::size_t FORMAT_COUNT{4U};
+
+    /// @brief 번호로 MAC 주소를 만듦 (주소마다 바이트 값이 다름)
+    [[nodiscard]] MacAddress MakeMacAddress(const std::size_t index) noexcept
+    {
+        // 32비트 빌드에서도 40비트 이동이 가능하도록 64비트로 변환
+        const std::uint64_t value = index;
+        return {static_cast<std::byte>(0x02U | ((value >> 40U) & 0xFCU)), static_cast<std::byte>(value >> 32U),
+                static_cast<std::byte>(value >> 24U), static_cast<std::byte>(value >> 16U),
+                static_cast<std::byte>(value >> 8U), static_cast<std::byte>(value & 0xFFU)};
+    }
+
+    /// @brief MAC 주소를 번호에 따라 네 가지 형식 중 하나의 문자열로 만듦
+    /// @param macAddress 문자열로 만들 MAC 주소
+    /// @param index 주소 번호 (형식과 대소문자 선택)
+    [[nodiscard]] std::wstring FormatMacAddress(const MacAddress& macAddress, const std::size_t index)
+    {
+        const wchar_t* const digits = (index / FORMAT_COUNT) % 2U == 0U ? L"0123456789ABCDEF" : L"0123456789abcdef";
+
+        std::wstring text{};
+        text.reserve(17U);
+        for (std::size_t i = 0U; i < macAddress.size(); ++i)
+        {
+            switch (index % FORMAT_COUNT)
+            {
+            case 0U:
+                if (i > 0U)
+                    text.push_back(L'-');
+                break;
+            case 1U:
+                if (i > 0U)
+                    text.push_back(L':');
+                break;
+            case 2U:
+                if (i > 0U && i % 2U == 0U)
+                    text.push_back(L'.');
+                break;
+            default:
+                break;
+            }
+
+            const unsigned value = std::to_integer<unsigned>(macAddress[i]);
+            text.push_back(digits[value >> 4U]);
+            text.push_back(digits[value & 0x0FU]);
+        }
+
+        return text;
+    }
+
+    /// @brief 하이픈 형식의 MAC 주소를 swscanf()로 변환 (비교용)
+    [[nodiscard]] bool ScanMacAddress(const std::wstring& text, MacAddress& macAddress) noexcept
+    {
+        std::array<unsigned char, 6U> bytes{};
+#ifdef _WIN32
+        const int converted = ::swscanf_s(text.c_str(), L"%2hhx-%2hhx-%2hhx-%2hhx-%2hhx-%2hhx", &bytes[0], &bytes[1],
+                                          &bytes[2], &bytes[3], &bytes[4], &bytes[5]);
+#else
+        const int converted = std::swscanf(text.c_str(), L"%2hhx-%2hhx-%2hhx-%2hhx-%2hhx-%2hhx", &bytes[0], &bytes[1],
+                                           &bytes[2], &bytes[3], &bytes[4], &bytes[5]);
+#endif
+        for (std::size_t i = 0U; i < bytes.size(); ++i)
+            macAddress[i] = static_cast<std::byte>(bytes[i]);
+
+        return converted == 6;
+    }
+
+    /// @brief 모든 주소가 변환되고 생성한 바이트 값과 같은지 확인
+    [[nodiscard]] bool VerifyParse(const std::vector<std::wstring>& texts, const std::vector<MacAddress>& expected)
+    {
+        for (std::size_t i = 0U; i < texts.size(); ++i)
+        {
+            MacAddress macAddress{};
+            if (WakeOnLan::ParseMacAddress(texts[i], macAddress).IsSuccess() == false || macAddress != expected[i])
+            {
+                std::ignore = ::fwprintf(stderr, L"변환 실패: %ls\n", texts[i].c_str());
+                return false;
+            }
+
+            if (i % FORMAT_COUNT == 0U && (ScanMacAddress(texts[i], macAddress) == false || macAddress != expected[i]))
+            {
+                std::ignore = ::fwprintf(stderr, L"swscanf 변환 실패: %ls\n", texts[i].c_str());
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// @brief 목록 전체를 ParseMacAddress()로 변환한 시간 중 가장 짧은 시간을 측정 (밀리초)
+    [[nodiscard]] double MeasureParse(const std::vector<std::wstring>& texts) noexcept
+    {
+        double bestMilliseconds = 0.0;
+        std::uint32_t checksum = 0U;
+        for (int round = 0; round < ROUND_COUNT; ++round)
+        {
+            const Clock::time_point start = Clock::now();
+            for (const std::wstring& text : texts)
+            {
+                MacAddress macAddress{};
+                if (WakeOnLan::ParseMacAddress(text, macAddress).IsSuccess())
+                    checksum += std::to_integer<std::uint32_t>(macAddress[5]);
+            }
+
+            const double milliseconds = WakeOnLanBenchmark::GetElapsedMilliseconds(start);
+            if (round == 0 || milliseconds < bestMilliseconds)
+                bestMilliseconds = milliseconds;
+        }
+
+        WakeOnLanBenchmark::KeepResult(checksum);
+        return bestMilliseconds;
+    }
+
+    /// @brief 목록의 하이픈 형식 주소를 swscanf()로 변환한 시간 중 가장 짧은 시간을 측정 (밀리초)
+    /// @param count 변환한 주소 수 출력
+    [[nodiscard]] double MeasureScan(const std::vector<std::wstring>& texts, std::size_t& count) noexcept
+    {
+        double bestMilliseconds = 0.0;
+        std::uint32_t checksum = 0U;
+        count = 0U;
+        for (int round = 0; round < ROUND_COUNT; ++round)
+        {
+            count = 0U;
+            const Clock::time_point start = Clock::now();
+            for (std::size_t i = 0U; i < texts.size(); i += FORMAT_COUNT)
+            {
+                MacAddress macAddress{};
+                if (ScanMacAddress(texts[i], macAddress))
+                    checksum += std::to_integer<std::uint32_t>(macAddress[5]);
+
+                ++count;
+            }
+
+            const double milliseconds = WakeOnLanBenchmark::GetElapsedMilliseconds(start);
+            if (round == 0 || milliseconds < bestMilliseconds)
+                bestMilliseconds = milliseconds;
+        }
+
+        WakeOnLanBenchmark::KeepResult(checksum);
+        return bestMilliseconds;
+    }
+}
+
+int main(const int argc, char* argv[])
+{
+    WakeOnLanBenchmark::InitializeOutput();
+
+    const std::size_t count = WakeOnLanBenchmark::GetCount(argc, argv, DEFAULT_ADDRESS_COUNT);
+
+    try
+    {
+        std::vector<std::wstring> texts{};
+        std::vector<MacAddress> expected{};
+        texts.reserve(count);
+        expected.reserve(count);
+        for (std::size_t i = 0U; i < count; ++i)
+        {
+            expected.push_back(MakeMacAddress(i));
+            texts.push_back(FormatMacAddress(expected.back(), i));
+        }
+
+        if (VerifyParse(texts, expected) == false)
+            return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+
+        const double parseMilliseconds = MeasureParse(texts);
+        std::size_t scanCount = 0U;
+        const double scanMilliseconds = MeasureScan(texts, scanCount);
+
+        std::ignore = ::wprintf(L"MAC 주소 %zu개 (네 가지 형식 같은 비율, 결과 일치, %d회 중 가장 빠른 값)\n", count,
+                                ROUND_COUNT);
+        WakeOnLanBenchmark::PrintThroughput(L"ParseMacAddress", count, parseMilliseconds, L"addr");
+        WakeOnLanBenchmark::PrintThroughput(L"swscanf (XX-XX-XX-XX-XX-XX)", scanCount, scanMilliseconds, L"addr");
+    }
+    catch (...)
+    {
+        std::ignore = ::fwprintf(stderr, L"주소 목록을 저장할 메모리가 부족합니다.\n");
+        return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+    }
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief 매직 패킷 생성 시간 측정
+///
+/// @details
+/// 같은 MAC 주소 목록으로 매직 패킷을 생성하며 패킷당 시간을 측정
+///
+/// - 바이트 루프: 0xFF 6바이트와 MAC 주소 16회를 바이트 단위로 복사하던 이전 구현 (비교용으로 이 파일에 보관)
+/// - CreateMagicPacket(): 48바이트 블록을 만들어 고정 크기로 복사하는 현재 구현을 패킷마다 호출
+/// - CreateMagicPackets(): 같은 구현으로 연속된 버퍼를 한 번에 채움
+///
+/// 측정 전에 세 방법의 결과가 같은지 확인하며, 다르면 종료 코드 1로 종료
+///
+/// 사용법: MagicPacketBenchmark [패킷 수 (기본값 100000)]
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BenchmarkSupport.h"
+
+namespace
+{
+    using WakeOnLan::MacAddress;
+    using WakeOnLan::MagicPacket;
+    using WakeOnLanBenchmark::Clock;
+
+    /// @brief 기본 패킷 수
+    constexpr std::size_t DEFAULT_PACKET_COUNT{100000U};
+
+    /// @brief 측정 한 번에 생성할 최소 패킷 수 (패킷 수가 적으면 반복하여 측정 시간을 확보)
+    constexpr std::size_t MIN_PACKETS_PER_ROUND{1000000U};
+
+    /// @brief 측정 횟수 (가장 빠른 측정값을 사용)
+    constexpr int ROUND_COUNT{7};
+
+    /// @brief 패킷 생성 방법
+    using Generator = void (*)(const MacAddress* macAddresses, std::size_t count, MagicPacket* packets);
+
+    /// @brief 이전 구현 - 0xFF 6바이트와 MAC 주소 16회를 바이트 단위로 복사
+    void CreateMagicPacketByteLoop(const MacAddress& macBytes, MagicPacket& packet) noexcept
+    {
+        constexpr std::byte magicHeader = static_cast<std::byte>(0xFF);
+        constexpr std::size_t headerSize = 6;
+        constexpr std::size_t macRepeatCount = 16;
+
+        for (std::size_t i = 0U; i < headerSize; ++i)
+        {
+            packet[i] = magicHeader;
+        }
+
+        for (std::size_t repeat = 0U; repeat < macRepeatCount; ++repeat)
+        {
+            const std::size_t offset = headerSize + (repeat * macBytes.size());
+            for (std::size_t i = 0U; i < macBytes.size(); ++i)
+            {
+                packet[offset + i] = macBytes[i];
+            }
+        }
+    }
+
+    /// @brief 이전 구현으로 패킷 목록을 생성
+    void GenerateByteLoop(const MacAddress* const macAddresses, const std::size_t count,
+                          MagicPacket* const packets)
+    {
+        for (std::size_t i = 0U; i < count; ++i)
+            CreateMagicPacketByteLoop(macAddresses[i], packets[i]);
+    }
+
+    /// @brief CreateMagicPacket()을 패킷마다 호출하여 패킷 목록을 생성
+    void GenerateSingle(const MacAddress* const macAddresses, const std::size_t count, MagicPacket* const packets)
+    {
+        for (std::size_t i = 0U; i < count; ++i)
+            WakeOnLan::CreateMagicPacket(macAddresses[i], packets[i]);
+    }
+
+    /// @brief CreateMagicPackets()로 패킷 목록을 한 번에 생성
+    void GenerateBulk(const MacAddress* const macAddresses, const std::size_t count, MagicPacket* const packets)
+    {
+        WakeOnLan::CreateMagicPackets(macAddresses, count, packets);
+    }
+
+    /// @brief 순서대로 번호를 붙인 MAC 주소 목록을 만듦 (패킷마다 내용이 다름)
+    void FillMacAddresses(std::vector<MacAddress>& macAddresses) noexcept
+    {
+        for (std::size_t i = 0U; i < macAddresses.size(); ++i)
+        {
+            macAddresses[i] = {std::byte{0x02}, static_cast<std::byte>(i >> 24U), static_cast<std::byte>(i >> 16U),
+                               static_cast<std::byte>(i >> 8U), static_cast<std::byte>(i & 0xFFU), std::byte{0x5E}};
+        }
+    }
+
+    /// @brief 패킷 목록을 생성하는 데 걸린 시간 중 가장 짧은 시간을 측정
+    /// @param generator 패킷 생성 방법
+    /// @param macAddresses MAC 주소 목록 (반복할 때마다 첫 번째 주소를 바꿔 같은 결과를 재사용하지 못하게 함)
+    /// @param packets 생성된 패킷 출력 (macAddresses와 같은 크기)
+    /// @param repeatCount 측정 한 번에 목록 전체를 생성하는 횟수
+    /// @return 패킷 하나의 생성 시간 (나노초)
+    [[nodiscard]] double MeasureGenerator(const Generator generator, std::vector<MacAddress>& macAddresses,
+                                          std::vector<MagicPacket>& packets, const std::size_t repeatCount) noexcept
+    {
+        const MacAddress firstMacAddress = macAddresses[0];
+        double bestMilliseconds = 0.0;
+        std::uint32_t checksum = 0U;
+        for (int round = 0; round < ROUND_COUNT; ++round)
+        {
+            const Clock::time_point start = Clock::now();
+            for (std::size_t repeat = 0U; repeat < repeatCount; ++repeat)
+            {
+                macAddresses[0][0] = static_cast<std::byte>(repeat & 0xFEU);
+                generator(macAddresses.data(), macAddresses.size(), packets.data());
+                checksum += std::to_integer<std::uint32_t>(packets[0][6]);
+            }
+
+            const double milliseconds = WakeOnLanBenchmark::GetElapsedMilliseconds(start);
+            if (round == 0 || milliseconds < bestMilliseconds)
+                bestMilliseconds = milliseconds;
+        }
+
+        macAddresses[0] = firstMacAddress;
+
+        // 반복마다 생성한 결과를 읽어 컴파일러가 생성을 생략하지 못하게 함
+        WakeOnLanBenchmark::KeepResult(checksum);
+
+        return bestMilliseconds * 1000000.0 / static_cast<double>(macAddresses.size() * repeatCount);
+    }
+
+    /// @brief 세 방법의 결과가 같은지 확인
+    /// @return 모든 패킷이 같으면 true
+    [[nodiscard]] bool VerifyGenerators(const std::vector<MacAddress>& macAddresses, std::vector<MagicPacket>& expected,
+                                        std::vector<MagicPacket>& actual) noexcept
+    {
+        GenerateByteLoop(macAddresses.data(), macAddresses.size(), expected.data());
+
+        GenerateSingle(macAddresses.data(), macAddresses.size(), actual.data());
+        if (std::memcmp(expected.data(), actual.data(), expected.size() * sizeof(MagicPacket)) != 0)
+            return false;
+
+        std::fill(actual.begin(), actual.end(), MagicPacket{});
+        GenerateBulk(macAddresses.data(), macAddresses.size(), actual.data());
+        return std::memcmp(expected.data(), actual.data(), expected.size() * sizeof(MagicPacket)) == 0;
+    }
+
+    /// @brief 측정 결과를 한 줄로 출력
+    /// @param name 생성 방법 이름
+    /// @param count 목록의 패킷 수
+    /// @param nanoseconds 패킷 하나의 생성 시간 (나노초)
+    /// @param baseline 바이트 루프의 패킷 하나의 생성 시간 (나노초)
+    void PrintResult(const wchar_t* const name, const std::size_t count, const double nanoseconds,
+                     const double baseline) noexcept
+    {
+        std::ignore = ::wprintf(L"  %8.2f ns/패킷  %8.2f ms/목록  %4.1f배  %ls\n", nanoseconds,
+                                nanoseconds * static_cast<double>(count) / 1000000.0,
+                                nanoseconds > 0.0 ? baseline / nanoseconds : 0.0, name);
+    }
+
+    /// @brief 패킷 수 하나에 대해 세 방법을 측정하고 출력
+    /// @param count 한 번에 생성할 패킷 수
+    /// @return 결과가 모두 같고 측정한 경우 true
+    [[nodiscard]] bool RunBenchmark(const std::size_t count)
+    {
+        std::vector<MacAddress> macAddresses(count);
+        std::vector<MagicPacket> packets(count);
+        std::vector<MagicPacket> expected(count);
+        FillMacAddresses(macAddresses);
+
+        if (VerifyGenerators(macAddresses, expected, packets) == false)
+        {
+            std::ignore = ::fwprintf(stderr, L"패킷 %zu개: 이전 구현과 생성한 패킷이 다릅니다.\n", count);
+            return false;
+        }
+
+        const std::size_t repeatCount = std::max<std::size_t>(1U, MIN_PACKETS_PER_ROUND / count);
+        const double byteLoop = MeasureGenerator(GenerateByteLoop, macAddresses, packets, repeatCount);
+        const double single = MeasureGenerator(GenerateSingle, macAddresses, packets, repeatCount);
+        const double bulk = MeasureGenerator(GenerateBulk, macAddresses, packets, repeatCount);
+
+        std::ignore = ::wprintf(L"패킷 %zu개 x %zu회 (결과 일치, %d회 중 가장 빠른 값)\n", count, repeatCount,
+                                ROUND_COUNT);
+        PrintResult(L"바이트 루프 (이전 구현)", count, byteLoop, byteLoop);
+        PrintResult(L"CreateMagicPacket", count, single, byteLoop);
+        PrintResult(L"CreateMagicPackets", count, bulk, byteLoop);
+        return true;
+    }
+}
+
+int main(const int argc, char* argv[])
+{
+    WakeOnLanBenchmark::InitializeOutput();
+
+    const std::size_t count = WakeOnLanBenchmark::GetCount(argc, argv, DEFAULT_PACKET_COUNT);
+
+    try
+    {
+        if (RunBenchmark(1U) == false || RunBenchmark(count) == false)
+            return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+    }
+    catch (...)
+    {
+        std::ignore = ::fwprintf(stderr, L"패킷 목록을 저장할 메모리가 부족합니다.\n");
+        return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+    }
+
+    return 0;
+}
@@ -0,0 +1,142 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief 전송 방식별 일괄 전송 처리량 측정
+///
+/// @details
+/// 읽지 않는 루프백 UDP 소켓으로 매직 패킷 목록을 WakeOnLanSession::SendBatch()로 보내며 전송 방식별 처리량을 측정
+///
+/// - socket: 소켓 API (Linux: sendmmsg(), 그 외: sendto())
+/// - io_uring: IORING_OP_SENDMSG 요청 (Linux 전용, 사용할 수 없으면 소켓 API로 대체되며 결과에 실제 방식을 표시)
+///
+/// 수신 소켓을 읽지 않으므로 수신 버퍼가 차면 커널이 버리며, 전송 경로(시스템 호출과 요청 제출)만 측정함
+///
+/// 사용법: SendBackendBenchmark [패킷 수 (기본값 200000)]
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BenchmarkSupport.h"
+
+namespace
+{
+    using WakeOnLan::SendBackend;
+    using WakeOnLan::WolErrorCode;
+    using WakeOnLanBenchmark::Clock;
+
+    /// @brief 기본 패킷 수
+    constexpr std::size_t DEFAULT_PACKET_COUNT{200000U};
+
+    /// @brief 측정 횟수 (가장 빠른 측정값을 사용)
+    constexpr int ROUND_COUNT{3};
+
+    /// @brief 전송할 패킷 목록을 만듦 (패킷마다 MAC 주소가 다름)
+    /// @param destAddr 모든 패킷의 전송 주소
+    /// @param packets 만든 패킷 목록 출력 (크기만큼 채움)
+    void FillPackets(const WakeOnLan::DestinationAddress& destAddr, std::vector<WakeOnLan::WolPacket>& packets) noexcept
+    {
+        for (std::size_t i = 0U; i < packets.size(); ++i)
+        {
+            const WakeOnLan::MacAddress macAddress{std::byte{0x02}, std::byte{0x00},
+                                                   static_cast<std::byte>(i >> 24U), static_cast<std::byte>(i >> 16U),
+                                                   static_cast<std::byte>(i >> 8U), static_cast<std::byte>(i & 0xFFU)};
+            WakeOnLan::CreateMagicPacket(macAddress, packets[i].mPacket);
+            packets[i].mDestAddr = destAddr;
+        }
+    }
+
+    /// @brief 전송 방식 하나로 패킷 목록 전체를 보낸 시간 중 가장 짧은 시간을 측정하고 출력
+    /// @param backend 요청할 전송 방식
+    /// @param packets 전송할 패킷 목록
+    /// @return 모든 패킷을 전송한 경우 true
+    [[nodiscard]] bool MeasureBackend(const SendBackend backend, const std::vector<WakeOnLan::WolPacket>& packets)
+    {
+        WakeOnLan::WakeOnLanSession session;
+        session.SetSendBackend(backend);
+        if (const WolErrorCode result = session.Open(); result != WolErrorCode::Success)
+        {
+            std::ignore = ::fwprintf(stderr, L"세션을 열 수 없음: %ls\n", WakeOnLan::WolErrorCodeToName(result));
+            return false;
+        }
+
+        std::vector<WolErrorCode> results{};
+        double bestMilliseconds = 0.0;
+        for (int round = 0; round < ROUND_COUNT; ++round)
+        {
+            const Clock::time_point start = Clock::now();
+            const WolErrorCode result = session.SendBatch(packets, results);
+            const double milliseconds = WakeOnLanBenchmark::GetElapsedMilliseconds(start);
+
+            const std::size_t failedCount = static_cast<std::size_t>(
+                std::count_if(results.begin(), results.end(),
+                              [](const WolErrorCode packetResult) { return packetResult != WolErrorCode::Success; }));
+            if (result != WolErrorCode::Success || results.size() != packets.size() || failedCount != 0U)
+            {
+                std::ignore = ::fwprintf(stderr, L"%ls 전송 실패: %ls (실패한 패킷 %zu개)\n",
+                                         SendBackendToName(backend).data(), WakeOnLan::WolErrorCodeToName(result),
+                                         failedCount);
+                return false;
+            }
+
+            if (round == 0 || milliseconds < bestMilliseconds)
+                bestMilliseconds = milliseconds;
+        }
+
+        // 요청한 방식을 사용할 수 없어 대체된 경우 실제 방식을 함께 표시
+        const SendBackend activeBackend = session.GetActiveSendBackend();
+        std::array<wchar_t, 64U> name{};
+        std::ignore = std::swprintf(name.data(), name.size(), L"%ls%ls%ls", SendBackendToName(backend).data(),
+                                    activeBackend != backend ? L" -> " : L"",
+                                    activeBackend != backend ? SendBackendToName(activeBackend).data() : L"");
+        WakeOnLanBenchmark::PrintThroughput(name.data(), packets.size(), bestMilliseconds, L"pkt");
+        return true;
+    }
+}
+
+int main(const int argc, char* argv[])
+{
+    WakeOnLanBenchmark::InitializeOutput();
+
+    const std::size_t count = WakeOnLanBenchmark::GetCount(argc, argv, DEFAULT_PACKET_COUNT);
+
+    WakeOnLan::WsaGuard wsaGuard;
+    if (wsaGuard.Initialize() != WolErrorCode::Success)
+    {
+        std::ignore = ::fwprintf(stderr, L"WinSock을 초기화할 수 없습니다.\n");
+        return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+    }
+
+    WakeOnLanBenchmark::LoopbackSink sink;
+    if (sink.Open() == false)
+    {
+        std::ignore = ::fwprintf(stderr, L"127.0.0.1에 바인딩할 수 없습니다.\n");
+        return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+    }
+
+    try
+    {
+        std::vector<WakeOnLan::WolPacket> packets(count);
+        FillPackets(sink.GetDestination(), packets);
+
+        std::ignore = ::wprintf(L"127.0.0.1:%u로 패킷 %zu개 일괄 전송 (%d회 중 가장 빠른 값)\n",
+                                static_cast<unsigned>(sink.GetPort()), count, ROUND_COUNT);
+        if (MeasureBackend(SendBackend::Socket, packets) == false
+            || MeasureBackend(SendBackend::IoUring, packets) == false)
+        {
+            return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+        }
+    }
+    catch (...)
+    {
+        std::ignore = ::fwprintf(stderr, L"패킷 목록을 저장할 메모리가 부족합니다.\n");
+        return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+    }
+
+    return 0;
+}
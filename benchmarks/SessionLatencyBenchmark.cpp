@@ -0,0 +1,153 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief 일회성 전송과 세션 전송의 패킷당 지연 시간 측정
+///
+/// @details
+/// 같은 루프백 주소로 매직 패킷을 하나씩 보내며 호출 한 번의 시간을 측정
+///
+/// - 일회성 전송: WakeOnLanSender::SendMagicPacket() (호출마다 MAC/주소 문자열 변환, WinSock 초기화, 소켓 생성과 설정, 전송, 해제)
+/// - 세션 전송: 한 번 연 WakeOnLanSession의 Send() (패킷 생성과 sendto()만 수행)
+///
+/// 사용법: SessionLatencyBenchmark [전송 횟수 (기본값 10000)]
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BenchmarkSupport.h"
+
+namespace
+{
+    using WakeOnLan::WolErrorCode;
+    using WakeOnLanBenchmark::Clock;
+
+    /// @brief 기본 전송 횟수
+    constexpr std::size_t DEFAULT_SEND_COUNT{10000U};
+
+    /// @brief 측정 전에 버리는 전송 횟수 (처음 호출의 캐시 적재 비용 제외)
+    constexpr std::size_t WARMUP_COUNT{100U};
+
+    /// @brief 전송할 MAC 주소
+    constexpr std::wstring_view MAC_ADDRESS_TEXT{L"02-00-5E-10-00-01"};
+
+    /// @brief 일회성 전송 경로의 패킷당 지연 시간을 측정
+    /// @param port 전송할 루프백 포트
+    /// @param count 측정할 전송 횟수
+    /// @param samples 호출별 시간 출력 (마이크로초)
+    /// @return 모두 전송한 경우 true
+    [[nodiscard]] bool MeasureOneShot(const std::uint16_t port, const std::size_t count,
+                                      std::vector<double>& samples) noexcept
+    {
+        const WakeOnLan::WakeOnLanSender sender;
+        for (std::size_t i = 0U; i < WARMUP_COUNT + count; ++i)
+        {
+            const Clock::time_point start = Clock::now();
+            const WolErrorCode result = sender.SendMagicPacket(MAC_ADDRESS_TEXT, L"127.0.0.1", port);
+            const Clock::time_point end = Clock::now();
+            if (result != WolErrorCode::Success)
+            {
+                std::ignore = ::fwprintf(stderr, L"일회성 전송 실패: %ls\n", WakeOnLan::WolErrorCodeToName(result));
+                return false;
+            }
+
+            if (i >= WARMUP_COUNT)
+                samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        }
+
+        return true;
+    }
+
+    /// @brief 세션 전송 경로의 패킷당 지연 시간을 측정
+    /// @param destAddr 전송할 루프백 주소
+    /// @param count 측정할 전송 횟수
+    /// @param samples 호출별 시간 출력 (마이크로초)
+    /// @return 모두 전송한 경우 true
+    [[nodiscard]] bool MeasureSession(const WakeOnLan::DestinationAddress& destAddr, const std::size_t count,
+                                      std::vector<double>& samples) noexcept
+    {
+        WakeOnLan::MacAddress macAddress{};
+        if (WakeOnLan::ParseMacAddress(MAC_ADDRESS_TEXT, macAddress).IsSuccess() == false)
+            return false;
+
+        WakeOnLan::WakeOnLanSession session;
+        if (const WolErrorCode result = session.Open(); result != WolErrorCode::Success)
+        {
+            std::ignore = ::fwprintf(stderr, L"세션을 열 수 없음: %ls\n", WakeOnLan::WolErrorCodeToName(result));
+            return false;
+        }
+
+        for (std::size_t i = 0U; i < WARMUP_COUNT + count; ++i)
+        {
+            const Clock::time_point start = Clock::now();
+            const WolErrorCode result = session.Send(macAddress, destAddr, 0U);
+            const Clock::time_point end = Clock::now();
+            if (result != WolErrorCode::Success)
+            {
+                std::ignore = ::fwprintf(stderr, L"세션 전송 실패: %ls\n", WakeOnLan::WolErrorCodeToName(result));
+                return false;
+            }
+
+            if (i >= WARMUP_COUNT)
+                samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        }
+
+        return true;
+    }
+}
+
+int main(const int argc, char* argv[])
+{
+    WakeOnLanBenchmark::InitializeOutput();
+
+    const std::size_t count = WakeOnLanBenchmark::GetCount(argc, argv, DEFAULT_SEND_COUNT);
+
+    WakeOnLan::WsaGuard wsaGuard;
+    if (wsaGuard.Initialize() != WolErrorCode::Success)
+    {
+        std::ignore = ::fwprintf(stderr, L"WinSock을 초기화할 수 없습니다.\n");
+        return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+    }
+
+    WakeOnLanBenchmark::LoopbackSink sink;
+    if (sink.Open() == false)
+    {
+        std::ignore = ::fwprintf(stderr, L"127.0.0.1에 바인딩할 수 없습니다.\n");
+        return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+    }
+
+    std::vector<double> oneShotSamples{};
+    std::vector<double> sessionSamples{};
+    try
+    {
+        oneShotSamples.reserve(count);
+        sessionSamples.reserve(count);
+    }
+    catch (...)
+    {
+        std::ignore = ::fwprintf(stderr, L"측정값을 저장할 메모리가 부족합니다.\n");
+        return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+    }
+
+    if (MeasureOneShot(sink.GetPort(), count, oneShotSamples) == false
+        || MeasureSession(sink.GetDestination(), count, sessionSamples) == false)
+    {
+        return WakeOnLanBenchmark::FAILURE_EXIT_CODE;
+    }
+
+    const WakeOnLanBenchmark::LatencySummary oneShot = WakeOnLanBenchmark::Summarize(oneShotSamples);
+    const WakeOnLanBenchmark::LatencySummary session = WakeOnLanBenchmark::Summarize(sessionSamples);
+
+    std::ignore = ::wprintf(L"127.0.0.1:%u로 %zu회 전송 (호출당 시간)\n", static_cast<unsigned>(sink.GetPort()), count);
+    WakeOnLanBenchmark::PrintLatency(L"WakeOnLanSender::SendMagicPacket", oneShot);
+    WakeOnLanBenchmark::PrintLatency(L"WakeOnLanSession::Send", session);
+    if (session.mMean > 0.0)
+        std::ignore = ::wprintf(L"평균 지연 시간 비율: %.1f배\n", oneShot.mMean / session.mMean);
+
+    return 0;
+}
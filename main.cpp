@@ -4,6 +4,8 @@
 /// @details
 /// 이 프로그램은 config.ini 설정 파일로부터 MAC 주소, 브로드캐스트 IP, 포트 정보를 읽어
 /// 대상 PC로 WOL(Wake-on-LAN) 매직 패킷을 전송합니다.
+/// 설정 파일 처리와 패킷 생성, 전송은 WakeOnLan 라이브러리(WakeOnLan.h)가 담당하며,
+/// 이 파일은 명령줄 옵션 처리와 결과 출력만 포함합니다.
 ///
 /// - INI 파일 위치: 실행 파일과 동일한 디렉토리
 /// - INI 인코딩: UTF-8 (BOM 없이 저장)
@@ -13,7 +15,15 @@
 ///   BroadcastIp=192.168.0.255
 ///   Port=9
 ///
-/// - 테스트 환경: Windows 10 이상
+///   [Target.Rack01-02]
+///   MacAddress=00-11-22-AA-BB-CD
+///   BroadcastIp=192.168.0.255
+///   Port=9
+///
+/// - "Target" 또는 "Target."으로 시작하는 모든 섹션을 대상 장치로 읽어
+///   하나의 소켓으로 모든 대상에게 매직 패킷을 전송하고 대상별 결과를 출력
+///
+/// - 테스트 환경: Windows 10 이상, Linux (glibc)
 /// - 유의 사항:
 ///   - 대상 장치의 BIOS/UEFI에서 WOL 기능이 활성화되어 있어야 함
 ///   - 네트워크 장치 및 방화벽 설정이 WOL 패킷을 허용해야 함
@@ -29,1084 +39,1508 @@
 /// SPDX-License-Identifier: MIT
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#include <array>
-#include <cassert>
-#include <cstdint>
+#include "WakeOnLan.h"
+
+#include <clocale>
+
+#ifdef _WIN32
 #include <fcntl.h>
-#include <filesystem>
 #include <io.h>
 #include <sal.h>
-#include <string>
-#include <WinSock2.h>
-#include <WS2tcpip.h>
+#else
+// SAL 주석은 MSVC에서만 제공되므로 빈 매크로로 정의
+// 콘솔 애플리케이션은 공개 헤더(WakeOnLan.h)만으로 빌드되어야 하므로 내부 헤더(WakeOnLanInternal.h)의 정의를 사용하지 않음
+#define _In_
+#define _In_opt_
+#define _Out_
+#define _Inout_
+#endif
+
+namespace
+{
+    /// @brief 명령줄 옵션
+    /// @details 인자 없이 실행하면 설정 파일의 모든 대상에게 전송한 뒤 Enter 입력을 기다림 (기존 동작)
+    ///          인자가 하나라도 있으면 입력을 기다리지 않음
+    struct CommandLineOptions final
+    {
+        /// @brief 상주 서비스로 실행 (--daemon)
+        bool mDaemon{false};
 
-#include <MSWSock.h>	// WinSock2.h 헤더 하위에 있어야 함
+        /// @brief 상주 서비스에 명령 전송 (--client)
+        bool mClient{false};
 
+        /// @brief --client 뒤의 인자 (공백으로 이어 하나의 명령으로 사용)
+        std::vector<std::wstring> mClientCommand{};
 
-#pragma comment(lib, "ws2_32.lib")
+        /// @brief 설정 파일 경로 (--config, 비어 있으면 실행 파일과 같은 폴더의 config.ini)
+        std::wstring mConfigFilePath{};
 
-/// @brief 설정 파일명 상수
-/// @details 실행 파일과 동일한 디렉토리에 위치하는 설정 파일의 고정 이름
-///          변경 불가능한 컴파일 타임 상수로 정의
-#define CONFIG_FILE_NAME L"config.ini"
+        /// @brief 설정 파일 없이 전송할 MAC 주소 (--mac)
+        std::wstring mMacAddress{};
 
-namespace WakeOnLan
-{
-    /// @brief MAC 주소를 저장하는 타입 (6바이트 고정 크기 배열)
-    /// @details IEEE 802 표준에 따른 6바이트 하드웨어 주소를 저장
-    ///          네트워크 인터페이스 카드의 고유 물리적 주소를 나타냄
-    using MacAddress = std::array<std::byte, 6U>;
-
-    /// @brief Wake-on-LAN 매직 패킷을 저장하는 타입 (총 102바이트)
-    /// @details WOL 표준에 따른 매직 패킷 구조:
-    ///          - 6바이트 동기화 헤더 (0xFF 6개)
-    ///          - 16회 반복되는 대상 MAC 주소 (6바이트 × 16 = 96바이트)
-    ///          - 총 102바이트로 구성된 Wake-on-LAN 패킷
-    using MagicPacket = std::array<std::byte, 102U>;
-
-    ///	@brief Wake-on-LAN 패킷 전송 결과를 나타내는 열거형
-    /// @details 각 단계에서 발생할 수 있는 오류 상황을 구분하여 정의
-    ///          디버깅 및 오류 처리 시 정확한 원인 파악을 위해 세분화됨
-    enum class WolErrorCode : std::uint8_t
-    {
-        // 성공
-        Success = 0U, /// 성공
-
-        // Config 파일 관련
-        // Config 파일을 찾는 과정에서 발생하는 오류
-        FailedToGetExecutionPath, /// 실행 파일 경로를 얻을 수 없음
-        InvalidExecutionPath, /// 유효하지 않은 실행 파일 경로
-
-        // Config 파일을 읽는 과정에서 발생하는 오류
-        ConfigFileNotFound, /// Config 파일을 찾을 수 없음
-        CannotAccessConfigFile, /// Config 파일에 접근 권한이 없음
-        FailedToReadMacAddress, /// Config 파일에서 Mac 주소를 읽을 수 없음
-        InvalidMacAddress, /// 유효하지 않은 MAC 주소
-        FailedToReadBroadcastIp, /// Config 파일에서 브로드캐스트 주소를 읽을 수 없음
-        InvalidBroadcastIp, /// 유효하지 않은 브로드캐스트 주소
-        FailedToReadPort, /// Config 파일에서 포트 읽을 수 없음
-        InvalidPort, /// 유효하지 않은 포트
-
-        // WOL 매직 패킷을 보내는 과정에서 발생하는 오류
-        WinsockInitializationFailed, /// Winsock 라이브러리 초기화 실패
-        SocketCreationFailed, /// UDP 소켓 생성 실패
-        BroadcastSetupFailed, /// 브로드캐스트 소켓 옵션 설정 실패
-        PacketSendFailed, /// 패킷 전송 과정에서 네트워크 오류 발생
-
-        // 기타
-        UnexpectedException /// 예상치 못한 예외 상황
+        /// @brief --mac과 함께 사용할 브로드캐스트 IP 주소 (--ip, 비어 있으면 --host의 지정 브로드캐스트 또는 255.255.255.255)
+        std::wstring mBroadcastIp{};
+
+        /// @brief --mac과 함께 사용할 포트 번호 (--port)
+        std::wstring mPort{L"9"};
+
+        /// @brief --ip 또는 --port가 지정되었는지 여부
+        bool mHasAddressOption{false};
+
+        /// @brief --mac과 함께 사용할 대상 장치 자신의 IP 주소 (--host, --verify tcp/icmp에 필요, CIDR 표기 가능)
+        std::wstring mHostIp{};
+
+        /// @brief 전송 후 대상 장치가 켜졌는지 확인할 방법 (--verify tcp|icmp|arp, 지정하지 않으면 확인하지 않음)
+        std::optional<WakeOnLan::ProbeMethod> mVerifyMethod{};
+
+        /// @brief 확인 제한 시간 (--verify-timeout, 초)
+        std::wstring mVerifyTimeout{L"180"};
+
+        /// @brief ProbePort를 지정하지 않은 대상을 TCP로 확인할 때 연결할 포트 (--verify-port)
+        std::wstring mVerifyPort{L"22"};
+
+        /// @brief 응답하지 않은 대상에게 처음 다시 보낼 때까지의 간격 (--retry-interval, 초)
+        std::wstring mRetryInterval{L"5"};
+
+        /// @brief 다시 보낼 때마다 간격에 곱하는 값 (--retry-multiplier)
+        std::wstring mRetryMultiplier{L"2"};
+
+        /// @brief 간격을 무작위로 늘이거나 줄이는 비율 (--retry-jitter)
+        std::wstring mRetryJitter{L"0.2"};
+
+        /// @brief 대상별 최대 전송 횟수 (--retry-max, 첫 번째 전송 포함, 1이면 다시 보내지 않음)
+        std::wstring mRetryMax{L"5"};
+
+        /// @brief --verify-* 또는 --retry-* 옵션이 지정되었는지 여부
+        bool mHasVerifyOption{false};
+
+        /// @brief 초당 최대 패킷 수 (--rate, 비어 있으면 제한하지 않음)
+        std::wstring mRate{};
+
+        /// @brief 한 번에 연속으로 보낼 수 있는 최대 패킷 수 (--burst, 비어 있으면 --rate의 1/10)
+        std::wstring mBurst{};
+
+        /// @brief 랙별 초당 최대 전송 대상 수 (--rack-rate, 비어 있으면 제한하지 않음)
+        std::wstring mRackRate{};
+
+        /// @brief 랙별로 한 번에 연속으로 보낼 수 있는 최대 대상 수 (--rack-burst, 비어 있으면 --rack-rate의 1/10)
+        std::wstring mRackBurst{};
+
+        /// @brief 패킷을 전송할 네트워크 인터페이스 이름 또는 주소 목록 (--interface, 여러 번 지정 가능, "all"이면 모든 인터페이스)
+        /// @details 비어 있으면 운영체제가 경로에 따라 선택한 인터페이스 하나로 전송
+        std::vector<std::wstring> mInterfaceNames{};
+
+        /// @brief 매직 패킷과 확인 요청을 보낼 방식 (--send-backend socket|io_uring)
+        WakeOnLan::SendBackend mSendBackend{WakeOnLan::SendBackend::Socket};
+
+        /// @brief --send-backend가 지정되었는지 여부
+        bool mHasSendBackendOption{false};
+
+        /// @brief 일괄 전송에 사용할 스레드 수 (--send-threads, 비어 있으면 1)
+        std::wstring mSendThreads{};
+
+        /// @brief 전송할 대상 이름 목록 (--target, 여러 번 지정 가능, 비어 있으면 모든 대상)
+        std::vector<std::wstring> mTargetNames{};
+
+        /// @brief 사람이 읽는 결과를 출력하지 않음 (--quiet)
+        bool mQuiet{false};
+
+        /// @brief 결과를 JSON으로 출력 (--json)
+        bool mJson{false};
+
+        /// @brief 사용법 출력 (--help)
+        bool mHelp{false};
     };
 
-    namespace
+    /// @brief 대상 하나의 전송 결과 (출력용)
+    struct WakeResult final
     {
-        /// @brief WOL 결과를 문자열로 변환
-        ///	@param result WOL 결과
-        ///	@return 결과 설명 문자열
-        [[nodiscard]] std::wstring WolErrorCodeToString(_In_ const WolErrorCode result) noexcept
-        {
-            switch (result)
-            {
-            case WolErrorCode::Success: return {L"성공\n"};
-
-            case WolErrorCode::FailedToGetExecutionPath: return {L"실행 파일 경로를 얻을 수 없음\n"};
-            case WolErrorCode::InvalidExecutionPath: return {L"유효하지 않은 실행 파일 경로\n"};
-
-            case WolErrorCode::ConfigFileNotFound: return {CONFIG_FILE_NAME L"파일을 찾을 수 없음\n"};
-            case WolErrorCode::CannotAccessConfigFile: return {CONFIG_FILE_NAME L"파일에 접근 권한이 없음\n"};
-            case WolErrorCode::FailedToReadMacAddress: return {L"Config 파일에서 Mac 주소를 읽을 수 없음\n"};
-            case WolErrorCode::InvalidMacAddress: return {L"잘못된 MAC 주소\n"};
-            case WolErrorCode::FailedToReadBroadcastIp: return {L"Config 파일에서 브로드캐스트 주소를 읽을 수 없음\n"};
-            case WolErrorCode::InvalidBroadcastIp: return {L"잘못된 브로드캐스트 주소\n"};
-            case WolErrorCode::FailedToReadPort: return {L"Config 파일에서 포트 읽을 수 없음\n"};
-            case WolErrorCode::InvalidPort: return {L"잘못된 포트 번호\n"};
-
-            case WolErrorCode::WinsockInitializationFailed: return {L"WinSock 초기화 실패\n"};
-            case WolErrorCode::SocketCreationFailed: return {L"소켓 생성 실패\n"};
-            case WolErrorCode::BroadcastSetupFailed: return {L"브로드캐스트 설정 실패\n"};
-            case WolErrorCode::PacketSendFailed: return {L"패킷 전송 실패\n"};
-
-            case WolErrorCode::UnexpectedException: return {L"예기치 않은 오류 발생\n"};
-            }
+        /// @brief 대상 이름 (INI 섹션명 또는 --mac 값)
+        std::wstring mName{};
 
-            // 모든 조건을 위 Switch 문에서 처리해야 함
-            assert(false);
-            return {L""};
-        }
-    }
+        /// @brief MAC 주소 바이트 배열
+        WakeOnLan::MacAddress mMacBytes{};
 
-    /// @brief Wake-on-LAN 기능을 위한 설정 구조체
-    /// @details WOL 대상 장치의 설정 정보를 관리하는 클래스
-    ///          - 대상 장치의 MAC 주소 저장 및 관리
-    ///          - 브로드캐스트 IP 주소 및 포트 번호 설정
-    ///          - INI 파일을 통한 설정 로드 기능 제공
-    struct WolConfig final
-    {
-    public:
-        /// @brief 기본 생성자
-        /// @details 모든 멤버 변수를 기본값으로 초기화
-        ///          mMacAddress와 mBroadcastIP는 빈 문자열로 초기화
-        ///          mPort는 유효하지 않은 포트 번호(0)으로 초기화
-        WolConfig() = default;
-
-        /// @brief 복사 생성자 - 사용하지 않음
-        WolConfig(const WolConfig& other) = delete;
-
-        /// @brief 이동 생성자 - 사용하지 않음
-        WolConfig(WolConfig&& other) noexcept = delete;
-
-        /// @brief 복사 대입 연산자 - 사용하지 않음
-        WolConfig& operator=(const WolConfig& other) = delete;
-
-        /// @brief 이동 대입 연산자 - 사용하지 않음
-        WolConfig& operator=(WolConfig&& other) noexcept = delete;
-
-        /// @brief 소멸자 - 기본 소멸자 사용
-        ~WolConfig() = default;
-
-        /// @brief 지정된 INI 파일에서 설정을 로드
-        /// @return 설정 로드 및 유효성 검사 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
-        /// @post 성공 시 mMacAddress, BroadcastIp, mPort에 로드된 값들이 저장됨
-        /// @details INI 파일 구조:
-        ///          [Target] 섹션 하위에 다음 키들이 존재해야 함
-        ///          - MacAddress: 대상 장치의 MAC 주소 (필수)
-        ///          - BroadcastIp: 브로드캐스트 IP 주소 (기본값: 255.255.255.255)
-        ///          - Port: WOL 패킷 전송 포트 (기본값: 9)
-        /// @note 로드된 설정값들의 유효성을 검증
-        ///       - MAC 주소가 비어있지 않은지 확인, 유효하지 않음 문자가 포함되어 있지 않는지, 양식에 맞는지
-        ///       - 브로드캐스트 IP가 비어있지 않은지 확인, IP 주소에 유효하지 않은 문자가 포함되어 있는지, 양식에 맞는지
-        ///       - 포트 번호가 유효한지 확인 (0 < port < 65535(UINT16_MAX))
-        /// @warning 모든 예외는 내부에서 처리되며 false 반환으로 오류 표시
-        [[nodiscard]] WolErrorCode LoadFromIni() noexcept;
-
-        /// @brief 설정에 저장된 MAC 주소를 반환
-        /// @return 저장된 MAC 주소 문자열 (예: "00:11:22:AA:BB:CC"), 설정 파일이 유효하지 않다면 빈 문자열을 반환함
-        [[nodiscard]] std::wstring GetMacAddress() const noexcept { return mMacAddress; }
-
-        /// @brief 설정에 저장된 브로드캐스트 IP 주소를 반환
-        /// @return 저장된 브로드캐스트 주소 문자열 (예: "255.255.255.255"), 설정 파일이 유효하지 않다면 빈 문자열을 반환함
-        [[nodiscard]] std::wstring GetBroadcastIp() const noexcept { return mBroadcastIp; }
-
-        /// @brief 설정에 저장된 포트 번호를 반환
-        /// @return 저장된 포트 번호 (1~65535(UINT16_MAX) 범위의 16비트 정수), 설정 파일이 유효하지 않다면 유효하지 않은 포트(0)를 반환함
-        [[nodiscard]] std::uint16_t GetPort() const noexcept { return mPort; }
-
-    private:
-        /// @brief 실행 파일 위치를 기반으로 설정 파일 절대 경로를 가져옴
-        ///	@param configFilePath 설정 파일의 전체 경로 (예: "C:\WOL\config.ini")
-        /// @return 설정 파일 절대 경로를 얻어올 수 있으면 WolErrorCode::Success, 아니라면 적절한 WolErrorCode 값
-        /// @details 현재 실행중인 프로그램의 디렉토리에서 config.ini 파일 경로 생성
-        ///          - GetModuleFileNameW API를 사용하여 실행 파일 경로 획득
-        ///          - 디렉토리 부분만 추출하여 설정 파일명과 결합
-        ///			 - 설정 파일 절대 경로를 얻는데 실패한 경우 configFilePath은 빈 문자열
-        /// @warning 반환된 경로의 파일 존재 여부는 별도로 확인 필요
-        [[nodiscard]] WolErrorCode GetConfigFilePath(_Out_ std::wstring& configFilePath) const noexcept;
-
-        /// @brief 로드된 설정 매개변수들의 유효성을 검증
-        /// @return 모든 설정 매개변수가 유효한 경우 true, 그렇지 않으면 false
-        /// @details 포괄적인 검증 항목들:
-        ///          - MAC 주소: 길이, 형식, 유효 문자 검사
-        ///          - 브로드캐스트 IP: 길이, 형식, 유효 문자 검사
-        ///          - 포트 번호: 유효 범위 검사 (1-65535(UINT16_MAX))
-        /// @note 실제 네트워크 연결성이나 장치 존재 여부는 확인하지 않음
-        ///       형식적 유효성만을 검증하여 기본적인 오류를 사전 차단
-        [[nodiscard]] WolErrorCode IsConfigurationValid() const noexcept;
-
-        /// @brief MAC 주소 형식의 유효성을 검증
-        /// @param macAddress 검증할 MAC 주소 문자열
-        /// @return MAC 주소가 유효한 형식인 경우 true, 그렇지 않으면 false
-        /// @details 지원하는 MAC 주소 형식:
-        ///          - "XX-XX-XX-XX-XX-XX" (하이픈 구분자)
-        ///          - 여기서 XX는 16진수 값 (0-9, A-F, a-f)
-        /// @note 대소문자를 구분하지 않으며, ':' 구분자, 혼합된 구분자는 허용하지 않음
-        [[nodiscard]] WolErrorCode IsValidMacAddress(_In_ std::wstring_view macAddress) const noexcept;
-
-        /// @brief IP 주소 형식의 유효성을 검증
-        /// @param broadcastIpAddress 검증할 브로드캐스트 Ip 주소 문자열
-        /// @return 브로드캐스트 Ip 주소가 유효한 IPv4 형식인 경우 WolErrorCode::Success, 그렇지 않으면 적절한 오류 코드
-        /// @details IPv4 주소 형식 검증:
-        ///          - "A.B.C.D" 형식 (점으로 구분된 4개의 8비트 값)
-        ///          - 각 옥텟은 0-255 범위의 정수
-        ///          - 선행 0은 허용하지 않음 (예: "01.02.03.04"는 무효)
-        /// @note IPv6 주소는 지원하지 않음
-        [[nodiscard]] WolErrorCode IsValidBroadcastIpAddress(_In_ std::wstring_view broadcastIpAddress) const noexcept;
-
-        /// @brif 브로드캐스트 Ip 주소의 개별 옥텟을 검증
-        ///	@param octet 검증할 옥텟 문자열 (예: "255")
-        ///	@return 유효하다면 WolErrorCode::success, 그렇지 않다면 적합한 WolErrorCode 값
-        [[nodiscard]] WolErrorCode IsValidateIpOctet(_In_ std::wstring_view octet) const noexcept;
-
-    private:
-        /// @brief INI 파일 읽기 작업을 위한 최대 버퍼 크기
-        /// @details GetPrivateProfileStringW API 호출 시 사용되는 버퍼 크기 제한
-        ///          일반적인 설정값 길이를 고려하여 256바이트로 설정
-        ///          이 크기를 초과하는 설정값은 잘릴 수 있음
-        static constexpr std::size_t MAX_BUFFER_SIZE{256U};
-
-        /// @brief Windows 경로의 최대 길이 제한
-        /// @details GetModuleFileNameW API에서 사용하는 경로 버퍼 크기
-        ///          Windows MAX_PATH 상수(260자)를 사용
-        /// @note 긴 경로는 지원하지 않음
-        static constexpr std::size_t MAX_PATH_LENGTH{MAX_PATH};
-
-        /// @brief MAC 주소의 최대 허용 길이
-        /// @details 표준 MAC 주소 형식들의 최대 길이:
-        ///          - "XX:XX:XX:XX:XX:XX" (17자)
-        ///          - "XX-XX-XX-XX-XX-XX" (17자)
-        ///          - 기본 17 + 1(null terminator)로 18자
-        static constexpr std::size_t MAC_ADDRESS_LENGTH{18U};
-
-        /// @brief IP 주소의 최대 허용 길이
-        /// @details IPv4 주소의 최대 길이:
-        ///          - "255.255.255.255" (15자)
-        ///			 - 기본 15 + 1(null terminator)로 16자
-        static constexpr std::size_t IP_ADDRESS_LENGTH{16U};
-
-        /// @brief 최대 유효 포트 번호
-        /// @details TCP/UDP 포트 번호의 유효 범위: 1-65535
-        ///          0번 포트는 예약되어 있어 사용 불가
-        static constexpr std::uint32_t MAX_VALID_PORT{UINT16_MAX};
-
-        /// @brief 기본 WOL 포트
-        ///	@details 9번 포트가 WOL 시 일반적으로 사용되는 포트
-        static constexpr std::uint16_t DEFAULT_PORT{9U};
-
-        /// @brief 대상 장치의 MAC 주소
-        /// @details Wake-on-LAN 패킷을 전송할 네트워크 인터페이스의 하드웨어 주소
-        ///          일반적으로 "XX:XX:XX:XX:XX:XX" 또는 "XX-XX-XX-XX-XX-XX" 형식
-        ///          실제 패킷 생성 시 바이너리 형태로 변환되어 사용됨
-        std::wstring mMacAddress{};
+        /// @brief 브로드캐스트 주소 (네트워크 바이트 순서)
+        std::uint32_t mBroadcastAddress{0U};
 
-        /// @brief WOL 패킷 전송을 위한 브로드캐스트 IP 주소
-        /// @details 네트워크 세그먼트 내 모든 장치에게 패킷을 전송하기 위한 주소
-        ///          일반적으로 "255.255.255.255" (전역 브로드캐스트) 또는
-        ///          서브넷 브로드캐스트 주소 (예: "192.168.1.255") 사용
-        ///          네트워크 토폴로지에 따라 적절한 주소 선택 필요
-        std::wstring mBroadcastIp{};
+        /// @brief IPv6 멀티캐스트 그룹과 범위 ID (지정했다면 mBroadcastAddress 대신 사용)
+        WakeOnLan::Ipv6Multicast mMulticast{};
+
+        /// @brief 포트 번호
+        std::uint16_t mPort{0U};
+
+        /// @brief 대상 장치 자신의 IP 주소 (네트워크 바이트 순서, 지정하지 않았다면 0)
+        std::uint32_t mHostAddress{0U};
+
+        /// @brief TCP로 확인할 때 연결할 포트 (지정하지 않았다면 0)
+        std::uint16_t mProbePort{0U};
+
+        /// @brief 대상 장치가 설치된 랙 번호 (지정하지 않았다면 0)
+        std::uint16_t mRack{0U};
 
-        /// @brief WOL 패킷 전송을 위한 대상 포트 번호 (기본값: 9)
-        /// @details Wake-on-LAN 표준에서 권장하는 포트는 9번 (Discard Protocol)
-        ///          일부 환경에서는 7번 (Echo) 또는 다른 포트 사용 가능
-        ///          UDP 프로토콜을 사용하여 브로드캐스트 전송
-        ///          유효한 포트 범위: 1-65535 (0번 포트는 예약됨)
-        ///			 초기화 시에는 유효하지 않은 값으로 초기화
-        std::uint16_t mPort{0};
+        /// @brief 전송 결과 (확인한 경우 확인 결과)
+        WakeOnLan::WolErrorCode mResult{WakeOnLan::WolErrorCode::Success};
+
+        /// @brief 전송 후 응답할 때까지 걸린 시간 (확인하지 않았거나 응답하지 않았다면 없음)
+        std::optional<std::chrono::milliseconds> mTimeToAlive{};
+
+        /// @brief 전송에 성공하여 켜졌는지 확인한 대상인지 여부 (mResult는 확인 결과)
+        bool mVerified{false};
+
+        /// @brief 매직 패킷을 보낸 횟수 (확인하는 동안 다시 보낸 횟수 포함)
+        std::uint32_t mSendCount{1U};
     };
 
-    WolErrorCode WolConfig::GetConfigFilePath(_Out_ std::wstring& configFilePath) const noexcept
+    /// @brief 10진수 문자열을 정수로 변환
+    /// @param text 변환할 문자열
+    /// @param minimum 허용하는 최솟값
+    /// @param maximum 허용하는 최댓값
+    /// @param value 변환된 값 출력
+    /// @return 문자열 전체가 범위 안의 10진수이면 true
+    bool ParseUnsigned(_In_ const std::wstring& text, _In_ const unsigned long minimum, _In_ const unsigned long maximum,
+                       _Out_ unsigned long& value) noexcept
+    {
+        wchar_t* endPtr = nullptr;
+        errno = 0;
+        value = std::wcstoul(text.c_str(), &endPtr, 10);
+        return errno != ERANGE && endPtr != text.c_str() && *endPtr == L'\0' && text.front() != L'-' && value >= minimum
+            && value <= maximum;
+    }
+
+    /// @brief 10진수 소수 문자열을 실수로 변환
+    /// @param text 변환할 문자열
+    /// @param minimum 허용하는 최솟값
+    /// @param maximum 허용하는 최댓값
+    /// @param value 변환된 값 출력
+    /// @return 문자열 전체가 범위 안의 숫자이면 true
+    bool ParseDecimal(_In_ const std::wstring& text, _In_ const double minimum, _In_ const double maximum,
+                      _Out_ double& value) noexcept
     {
-        configFilePath.clear();
+        wchar_t* endPtr = nullptr;
+        errno = 0;
+        value = std::wcstod(text.c_str(), &endPtr);
+        return errno != ERANGE && endPtr != text.c_str() && *endPtr == L'\0' && value >= minimum && value <= maximum;
+    }
 
-        // 실행 파일 경로 저장을 위한 버퍼 (null 문자로 초기화)
-        std::array<wchar_t, MAX_PATH_LENGTH> buffer{};
+    /// @brief 사용법을 출력
+    void PrintUsage(_In_ FILE* const stream)
+    {
+        std::ignore = ::fwprintf(stream,
+                                 L"사용법:\n"
+                                 L"  WOL                                   config.ini의 모든 대상에게 전송 후 Enter 입력 대기\n"
+                                 L"  WOL [--config 파일] [--target 이름]... [--quiet] [--json]\n"
+                                 L"                                        설정 파일의 대상(기본: 모두)에게 전송\n"
+                                 L"  WOL --mac MAC [--ip IP] [--port 포트] [--host IP[/길이]] [--quiet] [--json]\n"
+                                 L"                                        설정 파일 없이 지정한 주소로 전송 (기본: 255.255.255.255, 9)\n"
+                                 L"                                        --host가 CIDR 표기이면 기본 주소는 그 서브넷의 브로드캐스트\n"
+                                 L"                                        --ip에 IPv6 멀티캐스트 그룹 지정 가능 (예: ff02::1%%eth0)\n"
+                                 L"  ... --verify tcp|icmp|arp [--verify-timeout 초] [--verify-port 포트]\n"
+                                 L"                                        전송 후 대상이 켜졌는지 확인 (기본: 180초, 22번 포트)\n"
+                                 L"      [--retry-interval 초] [--retry-multiplier 배수] [--retry-jitter 비율] [--retry-max 횟수]\n"
+                                 L"                                        확인하는 동안 응답하지 않은 대상에게 다시 전송\n"
+                                 L"                                        (기본: 5초, 2배, ±0.2, 최대 5번 전송, --retry-max 1이면 다시 보내지 않음)\n"
+                                 L"  ... [--rate 패킷/초] [--burst 개수] [--rack-rate 대/초] [--rack-burst 개수]\n"
+                                 L"                                        전송 속도 제한 (--rack-rate는 Rack을 지정한 대상에 랙별로 적용)\n"
+                                 L"  ... [--interface 이름|IP|all]...\n"
+                                 L"                                        지정한 네트워크 인터페이스마다 동시에 전송 (all: 모든 인터페이스)\n"
+                                 L"                                        IPv6 대상은 주소의 범위(%%eth0)로 인터페이스를 선택\n"
+                                 L"  ... [--send-backend socket|io_uring]\n"
+                                 L"                                        전송 방식 (기본: socket, io_uring은 Linux 전용이며 사용할 수 없으면 socket)\n"
+                                 L"  ... [--send-threads 개수]\n"
+                                 L"                                        대상을 나누어 동시에 전송할 스레드 수 (기본: 1, 최대 64)\n"
+                                 L"  WOL [--config 파일] [--rate ...] [--interface ...] [--send-backend ...] [--send-threads ...] --daemon\n"
+                                 L"                                        상주 서비스로 실행\n"
+                                 L"  WOL [--config 파일] --client 명령...   상주 서비스에 명령 전송\n"
+                                 L"\n"
+                                 L"종료 코드: 성공 시 0, 실패 시 첫 번째 실패의 오류 코드 (README 참고)\n");
+    }
 
-        // API 호출 실패 또는 경로가 버퍼 크기를 초과하여 잘린 경우
-        if (const DWORD length = ::GetModuleFileNameW(nullptr, buffer.data(), static_cast<DWORD>(buffer.size()));
-            // 현재 모듈(실행 파일)의 전체 경로를 가져옴
-            length == 0 || length >= MAX_PATH_LENGTH)
-        {
-            std::ignore = ::fwprintf(stderr, L"실행 파일 경로를 얻을 수 없습니다.\n");
-            return WolErrorCode::FailedToGetExecutionPath;
-        }
+    /// @brief 명령줄 인자를 해석
+    /// @param arguments 프로그램 이름을 제외한 명령줄 인자
+    /// @param options 해석된 옵션 출력
+    /// @return 성공 시 WolErrorCode::Success, 알 수 없는 옵션이나 잘못된 조합은 WolErrorCode::InvalidArgument
+    /// @details "--옵션 값"과 "--옵션=값" 형식을 모두 허용
+    WakeOnLan::WolErrorCode ParseCommandLine(_In_ const std::vector<std::wstring>& arguments,
+                                             _Out_ CommandLineOptions& options)
+    {
+        options = {};
 
-        try
+        for (std::size_t i = 0U; i < arguments.size(); ++i)
         {
-            // 실행 파일 절대 경로를 담은 buffer를 std::filesystem::path로 변환
-            const std::filesystem::path exePath{buffer.data()};
+            std::wstring_view name{arguments[i]};
+            std::optional<std::wstring> inlineValue{};
+            if (const std::size_t separator = name.find(L'='); name.substr(0U, 2U) == L"--" && separator != std::wstring_view::npos)
+            {
+                inlineValue = std::wstring{name.substr(separator + 1U)};
+                name = name.substr(0U, separator);
+            }
 
-            // 실행 파일이 있는 폴더 경로
-            const std::filesystem::path exeDir = exePath.parent_path();
+            // 값을 받는 옵션의 값을 읽음
+            const auto readValue = [&](_Out_ std::wstring& value) -> bool
+            {
+                if (inlineValue.has_value())
+                {
+                    value = *inlineValue;
+                    return true;
+                }
+
+                if (i + 1U >= arguments.size())
+                {
+                    std::ignore = ::fwprintf(stderr, L"%ls 옵션에 값이 필요합니다.\n", std::wstring{name}.c_str());
+                    return false;
+                }
 
-            // 디렉토리 정보가 비어있다면 파일명만 반환
-            if (exeDir.empty())
+                value = arguments[++i];
+                return true;
+            };
+
+            bool valid = true;
+            if (name == L"--client" && inlineValue.has_value() == false)
+            {
+                // 나머지 인자는 모두 서비스에 보낼 명령
+                options.mClient = true;
+                options.mClientCommand.assign(arguments.begin() + static_cast<std::ptrdiff_t>(i + 1U), arguments.end());
+                break;
+            }
+            else if (name == L"--daemon" && inlineValue.has_value() == false)
+            {
+                options.mDaemon = true;
+            }
+            else if (name == L"--config")
+            {
+                valid = readValue(options.mConfigFilePath);
+            }
+            else if (name == L"--mac")
+            {
+                valid = readValue(options.mMacAddress);
+            }
+            else if (name == L"--ip")
+            {
+                valid = readValue(options.mBroadcastIp);
+                options.mHasAddressOption = true;
+            }
+            else if (name == L"--port")
+            {
+                valid = readValue(options.mPort);
+                options.mHasAddressOption = true;
+            }
+            else if (name == L"--host")
+            {
+                valid = readValue(options.mHostIp);
+                options.mHasAddressOption = true;
+            }
+            else if (name == L"--verify")
+            {
+                std::wstring method{};
+                valid = readValue(method);
+                if (valid && WakeOnLan::EqualsIgnoreCase(method, L"tcp"))
+                {
+                    options.mVerifyMethod = WakeOnLan::ProbeMethod::TcpConnect;
+                }
+                else if (valid && WakeOnLan::EqualsIgnoreCase(method, L"icmp"))
+                {
+                    options.mVerifyMethod = WakeOnLan::ProbeMethod::IcmpEcho;
+                }
+                else if (valid && WakeOnLan::EqualsIgnoreCase(method, L"arp"))
+                {
+                    options.mVerifyMethod = WakeOnLan::ProbeMethod::Neighbor;
+                }
+                else if (valid)
+                {
+                    std::ignore = ::fwprintf(stderr, L"--verify 값은 tcp, icmp, arp 중 하나여야 합니다: %ls\n", method.c_str());
+                    valid = false;
+                }
+            }
+            else if (name == L"--verify-timeout")
+            {
+                valid = readValue(options.mVerifyTimeout);
+                options.mHasVerifyOption = true;
+            }
+            else if (name == L"--verify-port")
+            {
+                valid = readValue(options.mVerifyPort);
+                options.mHasVerifyOption = true;
+            }
+            else if (name == L"--retry-interval")
+            {
+                valid = readValue(options.mRetryInterval);
+                options.mHasVerifyOption = true;
+            }
+            else if (name == L"--retry-multiplier")
+            {
+                valid = readValue(options.mRetryMultiplier);
+                options.mHasVerifyOption = true;
+            }
+            else if (name == L"--retry-jitter")
+            {
+                valid = readValue(options.mRetryJitter);
+                options.mHasVerifyOption = true;
+            }
+            else if (name == L"--retry-max")
+            {
+                valid = readValue(options.mRetryMax);
+                options.mHasVerifyOption = true;
+            }
+            else if (name == L"--rate")
+            {
+                valid = readValue(options.mRate);
+            }
+            else if (name == L"--burst")
             {
-                // 일반적으로 발생하지 않지만, 디렉토리 경로가 비어있는 경우를 대비
-                std::ignore = ::fwprintf(stderr, L"실행 파일 경로가 유효하지 않습니다: %ls\n", exeDir.c_str());
-                return WolErrorCode::InvalidExecutionPath;
+                valid = readValue(options.mBurst);
             }
-            // 디렉토리 경로와 설정 파일명 결합
-            configFilePath = (exeDir / CONFIG_FILE_NAME).wstring();
-            return WolErrorCode::Success;
+            else if (name == L"--rack-rate")
+            {
+                valid = readValue(options.mRackRate);
+            }
+            else if (name == L"--rack-burst")
+            {
+                valid = readValue(options.mRackBurst);
+            }
+            else if (name == L"--interface")
+            {
+                valid = readValue(options.mInterfaceNames.emplace_back());
+            }
+            else if (name == L"--send-backend")
+            {
+                std::wstring backend{};
+                valid = readValue(backend);
+                options.mHasSendBackendOption = true;
+                if (valid && WakeOnLan::EqualsIgnoreCase(backend, WakeOnLan::SendBackendToName(WakeOnLan::SendBackend::Socket)))
+                {
+                    options.mSendBackend = WakeOnLan::SendBackend::Socket;
+                }
+                else if (valid && WakeOnLan::EqualsIgnoreCase(backend, WakeOnLan::SendBackendToName(WakeOnLan::SendBackend::IoUring)))
+                {
+                    options.mSendBackend = WakeOnLan::SendBackend::IoUring;
+                }
+                else if (valid)
+                {
+                    std::ignore = ::fwprintf(stderr, L"--send-backend 값은 socket, io_uring 중 하나여야 합니다: %ls\n", backend.c_str());
+                    valid = false;
+                }
+            }
+            else if (name == L"--send-threads")
+            {
+                valid = readValue(options.mSendThreads);
+            }
+            else if (name == L"--target")
+            {
+                valid = readValue(options.mTargetNames.emplace_back());
+            }
+            else if (name == L"--quiet" && inlineValue.has_value() == false)
+            {
+                options.mQuiet = true;
+            }
+            else if (name == L"--json" && inlineValue.has_value() == false)
+            {
+                options.mJson = true;
+            }
+            else if ((name == L"--help" || name == L"-h") && inlineValue.has_value() == false)
+            {
+                options.mHelp = true;
+            }
+            else
+            {
+                std::ignore = ::fwprintf(stderr, L"알 수 없는 옵션입니다: %ls\n", arguments[i].c_str());
+                valid = false;
+            }
+
+            if (valid == false)
+                return WakeOnLan::WolErrorCode::InvalidArgument;
         }
-        catch (...)
+
+        // 함께 사용할 수 없는 옵션 조합
+        const bool hasMac = options.mMacAddress.empty() == false;
+        const bool hasPacingOption = options.mRate.empty() == false || options.mBurst.empty() == false
+            || options.mRackRate.empty() == false || options.mRackBurst.empty() == false;
+        if ((options.mDaemon && options.mClient)
+            || ((options.mDaemon || options.mClient) && (hasMac || options.mTargetNames.empty() == false || options.mJson))
+            || (hasMac && options.mTargetNames.empty() == false)
+            || (hasMac == false && options.mHasAddressOption)
+            || ((options.mDaemon || options.mClient) && options.mVerifyMethod.has_value())
+            || (options.mVerifyMethod.has_value() == false && options.mHasVerifyOption)
+            || (options.mClient && (hasPacingOption || options.mInterfaceNames.empty() == false || options.mHasSendBackendOption
+                                    || options.mSendThreads.empty() == false))
+            || (options.mRate.empty() && options.mBurst.empty() == false)
+            || (options.mRackRate.empty() && options.mRackBurst.empty() == false))
         {
-            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 설정 파일을 찾는 중 알 수 없는 오류가 발생했습니다.\n");
-            return WolErrorCode::UnexpectedException;
+            std::ignore = ::fwprintf(stderr, L"함께 사용할 수 없는 옵션입니다. (--ip, --port, --host는 --mac과 함께, --verify-*, --retry-*는 --verify와 함께, "
+                                             L"--burst는 --rate와 함께, --rack-burst는 --rack-rate와 함께 사용)\n");
+            return WakeOnLan::WolErrorCode::InvalidArgument;
         }
-    }
 
-    WolErrorCode WolConfig::LoadFromIni() noexcept
-    {
-        std::wstring configFileAbsolutePath{}; // 설정 파일 절대 경로
-        const WolErrorCode errorCode = GetConfigFilePath(configFileAbsolutePath); // 설정 파일 경로를 얻어온다.
-        if (errorCode != WolErrorCode::Success)
+        unsigned long value = 0UL;
+        if (ParseUnsigned(options.mVerifyTimeout, 1UL, 86400UL, value) == false)
         {
-            return errorCode;
+            std::ignore = ::fwprintf(stderr, L"--verify-timeout 값이 유효하지 않습니다 (1 ~ 86400초): %ls\n", options.mVerifyTimeout.c_str());
+            return WakeOnLan::WolErrorCode::InvalidArgument;
         }
 
-        // 설정파일이 존재하는지 확인
-        if (std::filesystem::exists(configFileAbsolutePath) == false)
+        if (ParseUnsigned(options.mVerifyPort, 1UL, UINT16_MAX, value) == false)
         {
-            // iniPath.data()는 std::wstring_view 기반으로 null-terminated 보장이 없음 > %ls 포맷에 전달하면 미정의 동작 발생 가능
-            // std::wstring_view에서 std::wstring으로 명시적 변환 후 출력
-            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일을 찾을 수 없습니다: %ls\n", configFileAbsolutePath.c_str());
-            return WolErrorCode::ConfigFileNotFound;
+            std::ignore = ::fwprintf(stderr, L"--verify-port 값이 유효하지 않습니다 (1 ~ 65535): %ls\n", options.mVerifyPort.c_str());
+            return WakeOnLan::WolErrorCode::InvalidArgument;
         }
 
-        try
+        double decimal = 0.0;
+        if (ParseDecimal(options.mRetryInterval, 0.1, 3600.0, decimal) == false)
         {
-            // INI 파일 읽기를 위한 임시 버퍼 (null 문자로 초기화)
-            std::array<wchar_t, MAX_BUFFER_SIZE> buffer{};
-
-            // MAC 주소, 브로드캐스트 Ip, 포트 번호 등이 있는 섹션 명
-            constexpr const wchar_t* const section = L"Target";
+            std::ignore = ::fwprintf(stderr, L"--retry-interval 값이 유효하지 않습니다 (0.1 ~ 3600초): %ls\n", options.mRetryInterval.c_str());
+            return WakeOnLan::WolErrorCode::InvalidArgument;
+        }
 
-            // MAC 주소 로드
-            // [Target] 섹션의 MacAddress 키에서 값을 읽어옴
-            // 키가 없거나 값이 비어있을 경우 macResult == 0 > 유효하지 않은 맥 주소로 처리
-            const DWORD macResult = ::GetPrivateProfileStringW(
-                section, // 섹션명
-                L"MacAddress", // 키명
-                L"", // 기본값 (빈 문자열)
-                buffer.data(), // 결과 저장 버퍼
-                MAX_BUFFER_SIZE, // 버퍼 크기
-                configFileAbsolutePath.data() // INI 파일 경로
-            );
+        if (ParseDecimal(options.mRetryMultiplier, 1.0, 10.0, decimal) == false)
+        {
+            std::ignore = ::fwprintf(stderr, L"--retry-multiplier 값이 유효하지 않습니다 (1 ~ 10): %ls\n", options.mRetryMultiplier.c_str());
+            return WakeOnLan::WolErrorCode::InvalidArgument;
+        }
 
-            // MAC 주소 로드 실패 시 (키가 없거나 값이 비어있음)
-            if (macResult == 0U)
-            {
-                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일에서 MacAddress 키 값을 읽는데 실패했습니다.\n");
-                return WolErrorCode::FailedToReadMacAddress;
-            }
+        if (ParseDecimal(options.mRetryJitter, 0.0, 1.0, decimal) == false)
+        {
+            std::ignore = ::fwprintf(stderr, L"--retry-jitter 값이 유효하지 않습니다 (0 ~ 1): %ls\n", options.mRetryJitter.c_str());
+            return WakeOnLan::WolErrorCode::InvalidArgument;
+        }
 
-            // 로드된 MAC 주소를 멤버 변수에 저장
-            mMacAddress.assign(buffer.data());
-
-            // 브로드캐스트 IP 주소 로드
-            // [Target] 섹션의 BroadcastIP 키에서 값을 읽어옴
-            // 키가 없거나 값이 비어있는 경우 ipResult == 0 > 유효하지 않은 브로드캐스트 주소로 처리
-            const DWORD ipResult = ::GetPrivateProfileStringW(
-                section, // 섹션명
-                L"BroadcastIp", // 키명
-                L"255.255.255.255", // 기본값 (전역 브로드캐스트)
-                buffer.data(), // 결과 저장 버퍼
-                MAX_BUFFER_SIZE, // 버퍼 크기
-                configFileAbsolutePath.data() // INI 파일 경로
-            );
-
-            // 브로드캐스트 IP 로드 실패 시
-            if (ipResult == 0U)
-            {
-                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일에서 BroadcastIp 키 값을 읽는데 실패했습니다.\n");
-                return WolErrorCode::FailedToReadBroadcastIp;
-            }
+        if (ParseUnsigned(options.mRetryMax, 1UL, 1000UL, value) == false)
+        {
+            std::ignore = ::fwprintf(stderr, L"--retry-max 값이 유효하지 않습니다 (1 ~ 1000): %ls\n", options.mRetryMax.c_str());
+            return WakeOnLan::WolErrorCode::InvalidArgument;
+        }
 
-            // 로드된 브로드캐스트 IP를 멤버 변수에 저장
-            mBroadcastIp.assign(buffer.data());
-
-            // 포트 번호 로드
-            // [Target] 섹션의 Port 키에서 값을 읽어옴
-            // Port 키 값이 비어있는 경우 portResult == 0 > 유효하지 않은 포트로 처리
-            const DWORD portResult = ::GetPrivateProfileStringW(
-                section,
-                L"Port", L"",
-                buffer.data(),
-                MAX_BUFFER_SIZE,
-                configFileAbsolutePath.data());
-            if (portResult == 0U)
-            {
-                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일에서 Port 키 값을 읽는데 실패했습니다.\n");
-                return WolErrorCode::FailedToReadPort;
-            }
+        if (options.mRate.empty() == false && ParseDecimal(options.mRate, 0.1, 1000000.0, decimal) == false)
+        {
+            std::ignore = ::fwprintf(stderr, L"--rate 값이 유효하지 않습니다 (0.1 ~ 1000000): %ls\n", options.mRate.c_str());
+            return WakeOnLan::WolErrorCode::InvalidArgument;
+        }
 
-            if (std::wcslen(buffer.data()) == 0)
-                return WolErrorCode::InvalidPort;
+        if (options.mBurst.empty() == false && ParseUnsigned(options.mBurst, 1UL, 1000000UL, value) == false)
+        {
+            std::ignore = ::fwprintf(stderr, L"--burst 값이 유효하지 않습니다 (1 ~ 1000000): %ls\n", options.mBurst.c_str());
+            return WakeOnLan::WolErrorCode::InvalidArgument;
+        }
 
-            errno = 0;
-            wchar_t* endPtr = nullptr;
-            const unsigned long port = wcstoul(buffer.data(), &endPtr, 10);
-            if (errno == ERANGE)
-            {
-                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일에서 Port 값을 정수로 변환하는데 실패하였습니다: %ls\n",
-                                         buffer.data());
-                return WolErrorCode::InvalidPort;
-            }
+        if (options.mRackRate.empty() == false && ParseDecimal(options.mRackRate, 0.01, 10000.0, decimal) == false)
+        {
+            std::ignore = ::fwprintf(stderr, L"--rack-rate 값이 유효하지 않습니다 (0.01 ~ 10000): %ls\n", options.mRackRate.c_str());
+            return WakeOnLan::WolErrorCode::InvalidArgument;
+        }
 
-            // endPtr == buffer.data() > 변환된 숫자가 없음 (예: "abc")
-            // *endPtr != L'\0' > 숫자 뒤에 쓰레기 문자 있음 (예: "255abc")
-            if (endPtr == buffer.data() || *endPtr != L'\0')
-            {
-                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일의 Port 값이 유효하지 않습니다: %ls\n", buffer.data());
-                return WolErrorCode::InvalidPort;
-            }
+        if (options.mRackBurst.empty() == false && ParseUnsigned(options.mRackBurst, 1UL, 10000UL, value) == false)
+        {
+            std::ignore = ::fwprintf(stderr, L"--rack-burst 값이 유효하지 않습니다 (1 ~ 10000): %ls\n", options.mRackBurst.c_str());
+            return WakeOnLan::WolErrorCode::InvalidArgument;
+        }
 
-            if (port == 0 || port > UINT16_MAX)
-            {
-                std::ignore = ::fwprintf(
-                    stderr, CONFIG_FILE_NAME L" 설정 파일의 Port 키 값이 유효하지 않습니다.\n\t유효한 포트의 범위: 1 ~ 65535\n\t입력된 포트: %d\n",
-                    port);
-                return WolErrorCode::InvalidPort;
-            }
+        if (options.mSendThreads.empty() == false
+            && ParseUnsigned(options.mSendThreads, 1UL, static_cast<unsigned long>(WakeOnLan::WakeOnLanSession::MAX_SEND_THREADS), value) == false)
+        {
+            std::ignore = ::fwprintf(stderr, L"--send-threads 값이 유효하지 않습니다 (1 ~ %zu): %ls\n",
+                                     WakeOnLan::WakeOnLanSession::MAX_SEND_THREADS, options.mSendThreads.c_str());
+            return WakeOnLan::WolErrorCode::InvalidArgument;
+        }
 
+        return WakeOnLan::WolErrorCode::Success;
+    }
 
-            // 유효한 포트 값을 멤버 변수에 저장
-            mPort = static_cast<std::uint16_t>(port);
+    /// @brief 명령줄 옵션의 전송 속도 제한 설정을 반환 (ParseCommandLine()에서 검증한 옵션)
+    WakeOnLan::PacingPolicy GetPacingPolicy(_In_ const CommandLineOptions& options) noexcept
+    {
+        WakeOnLan::PacingPolicy policy{};
+        unsigned long value = 0UL;
+        if (options.mRate.empty() == false)
+        {
+            std::ignore = ParseDecimal(options.mRate, 0.1, 1000000.0, policy.mPacketsPerSecond);
+        }
 
-            // 로드된 모든 설정값들의 최종 유효성 검사
-            const WolErrorCode isValidConfiguration = IsConfigurationValid();
-            if (isValidConfiguration != WolErrorCode::Success)
-            {
-                // Config.ini 파일이 유효하지 않으면 모든 변수 초기화
-                mMacAddress = {};
-                mBroadcastIp = {};
-                mPort = 0;
+        if (options.mBurst.empty() == false && ParseUnsigned(options.mBurst, 1UL, 1000000UL, value))
+        {
+            policy.mPacketBurst = static_cast<std::uint32_t>(value);
+        }
 
-                return isValidConfiguration;
-            }
-            return WolErrorCode::Success;
+        if (options.mRackRate.empty() == false)
+        {
+            std::ignore = ParseDecimal(options.mRackRate, 0.01, 10000.0, policy.mRackHostsPerSecond);
         }
-        catch (const std::exception& e)
+
+        if (options.mRackBurst.empty() == false && ParseUnsigned(options.mRackBurst, 1UL, 10000UL, value))
         {
-            // 모든 예외 처리 (예: 문자열 조작 중 std::bad_alloc 등)
-            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 설정 파일 로드 중 오류가 발생했습니다: %hs\n", e.what());
-            return WolErrorCode::UnexpectedException;
+            policy.mRackBurst = static_cast<std::uint32_t>(value);
         }
-        catch (...)
+
+        return policy;
+    }
+
+    /// @brief 명령줄 옵션의 전송 스레드 수를 반환 (ParseCommandLine()에서 검증한 옵션, 지정하지 않았다면 1)
+    std::size_t GetSendThreads(_In_ const CommandLineOptions& options) noexcept
+    {
+        unsigned long value = 1UL;
+        if (options.mSendThreads.empty() == false
+            && ParseUnsigned(options.mSendThreads, 1UL, static_cast<unsigned long>(WakeOnLan::WakeOnLanSession::MAX_SEND_THREADS), value) == false)
         {
-            // noexcept 보장을 위해 모든 예외를 포착하고 실패로 처리
-            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 설정 파일 로드 중 알 수 없는 오류가 발생했습니다.\n");
-            return WolErrorCode::UnexpectedException;
+            value = 1UL;
         }
+
+        return static_cast<std::size_t>(value);
     }
 
-    WolErrorCode WolConfig::IsConfigurationValid() const noexcept
+    /// @brief 상주 서비스 모드로 실행 (--daemon)
+    /// @return 종료 코드 (WolErrorCode 값)
+    /// @details SIGINT(Ctrl+C) 또는 SIGTERM을 받거나 "shutdown" 명령을 받으면 종료
+    int RunDaemon(_In_ const CommandLineOptions& options)
     {
-        // MAC 주소 형식 유효성 검사
-        WolErrorCode result = IsValidMacAddress(mMacAddress);
-        if (result != WolErrorCode::Success)
+        std::ignore = std::signal(SIGINT, [](int) { WakeOnLan::WakeOnLanDaemon::RequestStop(); });
+        std::ignore = std::signal(SIGTERM, [](int) { WakeOnLan::WakeOnLanDaemon::RequestStop(); });
+
+        WakeOnLan::WakeOnLanDaemon daemon;
+        daemon.SetConfigFilePath(options.mConfigFilePath);
+        daemon.SetPacing(GetPacingPolicy(options));
+        daemon.SetSendBackend(options.mSendBackend);
+        daemon.SetSendThreads(GetSendThreads(options));
+
+        WakeOnLan::WolErrorCode errorCode = WakeOnLan::WolErrorCode::Success;
+        if (options.mInterfaceNames.empty() == false)
         {
-            return result;
+            std::vector<WakeOnLan::NetworkInterface> interfaces{};
+            errorCode = WakeOnLan::SelectNetworkInterfaces(options.mInterfaceNames, interfaces);
+            if (errorCode == WakeOnLan::WolErrorCode::Success)
+            {
+                daemon.SetInterfaces(interfaces);
+            }
         }
 
-        // 브로드캐스트 IP 주소 형식 유효성 검사
-        result = IsValidBroadcastIpAddress(mBroadcastIp);
-        if (result != WolErrorCode::Success)
+        if (errorCode == WakeOnLan::WolErrorCode::Success)
         {
-            return result;
+            errorCode = daemon.Run();
         }
 
-        // 포트는 INI 파일을 읽는 위치에서 검증
+        if (errorCode != WakeOnLan::WolErrorCode::Success)
+        {
+            std::ignore = ::fwprintf(stderr, L"Wake-on-LAN 서비스를 실행할 수 없습니다.\n\t%ls",
+                                     WakeOnLan::WolErrorCodeToString(errorCode).c_str());
+        }
 
-        return WolErrorCode::Success;
+        return static_cast<int>(errorCode);
     }
 
-    WolErrorCode WolConfig::IsValidMacAddress(_In_ const std::wstring_view macAddress) const noexcept
+    /// @brief 실행 중인 상주 서비스에 명령을 보냄 (--client <명령>)
+    /// @param options 명령줄 옵션 (mClientCommand를 공백으로 이어 하나의 명령으로 사용)
+    /// @return 종료 코드 (응답의 첫 번째 실패 결과의 WolErrorCode 값, 모두 성공하면 0)
+    int RunClient(_In_ const CommandLineOptions& options)
     {
-        const std::size_t length = macAddress.length();
+        if (options.mClientCommand.empty())
+        {
+            std::ignore = ::fwprintf(stderr, L"사용법: WOL --client <wake 이름 | wake-all | reload | status | shutdown>\n");
+            return static_cast<int>(WakeOnLan::WolErrorCode::InvalidCommand);
+        }
 
-        // MAC 주소 주소 문자열 길이가 MAC_ADDRESS_LENGTH(18)이 아니라면 유효하지 않은 것으로 판단
-        if (macAddress.empty() || length > MAC_ADDRESS_LENGTH)
+        std::wstring command{};
+        for (const std::wstring& argument : options.mClientCommand)
         {
-            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 설정 파일의 MacAddress 키 값의 길이가 유효하지 않습니다.\n");
-            return WolErrorCode::InvalidMacAddress;
+            if (command.empty() == false)
+                command += L' ';
+            command += argument;
         }
 
-        // 각 위치별 문자 검증
-        for (std::size_t i = 0U; i < length; ++i)
+        WakeOnLan::WakeOnLanControlClient client;
+        client.SetConfigFilePath(options.mConfigFilePath);
+        std::string response{};
+        const WakeOnLan::WolErrorCode errorCode = client.Execute(WakeOnLan::WideToUtf8(command), response);
+        if (errorCode != WakeOnLan::WolErrorCode::Success)
         {
-            const wchar_t ch = macAddress.at(i);
+            return static_cast<int>(errorCode);
+        }
 
-            // 구분자
-            constexpr wchar_t separator = L'-';
+        // 응답 한 줄: "<WolErrorCode 값>\t<대상>\t<설명>"
+        int exitCode = 0;
+        std::string_view remaining{response};
+        while (remaining.empty() == false)
+        {
+            const std::size_t lineEnd = remaining.find('\n');
+            const std::string_view line = remaining.substr(0U, lineEnd);
+            remaining.remove_prefix(lineEnd == std::string_view::npos ? remaining.length() : lineEnd + 1U);
 
-            // 구분자 위치
-            static constexpr std::array<std::size_t, 5> MAC_ADDRESS_SEPARATOR_INDICES{2U, 5U, 8U, 11U, 14U};
-            if (std::find(MAC_ADDRESS_SEPARATOR_INDICES.begin(), MAC_ADDRESS_SEPARATOR_INDICES.end(), i) !=
-                MAC_ADDRESS_SEPARATOR_INDICES.end())
+            if (options.mQuiet == false)
             {
-                // 구분자 일관성 검사
-                if (ch != separator)
-                {
-                    std::ignore = ::fwprintf(
-                        stderr,
-                        CONFIG_FILE_NAME L" 설정 파일의 MacAddress 키 값의 구분자가 유효하지 않습니다.\n\t유효한 구분자: '-'\n\t입력된 구분자: %c\n",
-                        separator);
-                    return WolErrorCode::InvalidMacAddress;
-                }
+                std::ignore = ::fwprintf(stdout, L"%ls\n", WakeOnLan::Utf8ToWide(line).c_str());
             }
-            else
+
+            if (exitCode == 0)
             {
-                // 16진수 문자 검사
-                if (((ch >= L'0' && ch <= L'9')
-                    || (ch >= L'A' && ch <= L'F')
-                    || (ch >= L'a' && ch <= L'f')) == false)
-                {
-                    std::ignore = ::fwprintf(
-                        stderr, CONFIG_FILE_NAME L" 설정 파일의 MacAddress 키 값에 유효하지 문자가 포함되어 있습니다: %c\n", ch);
-                    return WolErrorCode::InvalidMacAddress;
-                }
+                exitCode = std::atoi(std::string{line.substr(0U, line.find('\t'))}.c_str());
             }
         }
 
-        return WolErrorCode::Success;
+        return exitCode;
     }
 
-    WolErrorCode WolConfig::IsValidBroadcastIpAddress(_In_ const std::wstring_view broadcastIpAddress) const noexcept
+    /// @brief 설정 파일 없이 --mac/--ip/--port로 지정한 주소에 전송
+    /// @param options 명령줄 옵션
+    /// @param session 전송할 세션 (열려 있지 않으면 주소를 확인한 뒤 엶)
+    /// @param results 전송 결과 출력 (대상 하나)
+    /// @return 주소가 유효하고 세션을 연 경우 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+    WakeOnLan::WolErrorCode WakeAddress(_In_ const CommandLineOptions& options, _Inout_ WakeOnLan::WakeOnLanSession& session,
+                                        _Out_ std::vector<WakeResult>& results)
     {
-        std::size_t start = 0U;
-        std::size_t dotCount = 0U;
+        results.clear();
 
-        // 점(.)으로 구분된 각 옥텟 검사
-        for (std::size_t i = 0U; i <= broadcastIpAddress.length(); ++i)
+        WakeOnLan::WolTarget target{};
+        target.mName = options.mMacAddress;
+        target.mMacAddress = options.mMacAddress;
+        target.mBroadcastIp = options.mBroadcastIp.empty() ? std::wstring{L"255.255.255.255"} : options.mBroadcastIp;
+
+        if (WakeOnLan::ParseMacAddress(target.mMacAddress, target.mMacBytes).IsSuccess() == false)
         {
-            // 점을 만나거나 문자열 끝에 도달한 경우
-            if (i == broadcastIpAddress.length() || broadcastIpAddress[i] == L'.')
-            {
-                try
-                {
-                    const std::wstring_view octet = broadcastIpAddress.substr(start, i - start);
-                    const WolErrorCode result = IsValidateIpOctet(octet);
-                    if (result != WolErrorCode::Success)
-                    {
-                        return result;
-                    }
-                }
-                catch (const std::exception& e)
-                {
-                    std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟 파싱 중 오류가 발생했습니다: %hs\n",
-                                             e.what());
-                    return WolErrorCode::UnexpectedException;
-                }
-                catch (...)
-                {
-                    std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟 파싱 중 알 수 없는 오류가 발생했습니다.\n");
-                    return WolErrorCode::UnexpectedException;
-                }
+            std::ignore = ::fwprintf(stderr, L"MAC 주소가 유효하지 않습니다: %ls\n", target.mMacAddress.c_str());
+            return WakeOnLan::WolErrorCode::InvalidMacAddress;
+        }
 
-                start = i + 1U;
+        // --host가 CIDR 표기이고 --ip가 없으면 해당 서브넷의 지정 브로드캐스트 주소로 전송
+        if (options.mHostIp.empty() == false)
+        {
+            std::uint32_t hostAddress = 0U;
+            std::uint32_t prefixLength = 0U;
+            if (WakeOnLan::ParseIpv4Cidr(options.mHostIp, hostAddress, prefixLength) == false || hostAddress == 0U
+                || prefixLength > 30U)
+            {
+                std::ignore = ::fwprintf(stderr, L"대상 IP 주소가 유효하지 않습니다 (A.B.C.D 또는 A.B.C.D/1 ~ 30): %ls\n",
+                                         options.mHostIp.c_str());
+                return WakeOnLan::WolErrorCode::InvalidHostIp;
+            }
 
-                // 점인 경우 카운트 증가
-                if (i < broadcastIpAddress.length())
-                {
-                    ++dotCount;
-                }
+            target.mHostAddr.s_addr = htonl(hostAddress);
+            if (prefixLength != 0U && options.mBroadcastIp.empty())
+            {
+                std::array<wchar_t, 16U> directedBroadcast{};
+                WakeOnLan::FormatIpv4Address(htonl(WakeOnLan::GetDirectedBroadcast(hostAddress, prefixLength)), directedBroadcast);
+                target.mBroadcastIp = directedBroadcast.data();
+            }
+        }
 
-                if (dotCount > 3)
-                {
-                    std::ignore = ::fwprintf(
-                        stderr, CONFIG_FILE_NAME L" 설정 파일의 BroadcastIp 구분자(.) 개수가 잘못되었습니다.(필요 갯수보다 많음)\n");
-                    return WolErrorCode::InvalidBroadcastIp;
-                }
+        // IPv6 멀티캐스트 그룹(ff02::1%eth0 등) 또는 IPv4 브로드캐스트 주소
+        std::wstring_view scope{};
+        if (WakeOnLan::ParseIpv6Multicast(target.mBroadcastIp, target.mMulticast.mGroup, scope))
+        {
+            if (WakeOnLan::ResolveScopeId(scope, target.mMulticast.mScopeId) == false)
+            {
+                std::ignore = ::fwprintf(stderr, L"네트워크 인터페이스를 찾을 수 없습니다: %ls\n", target.mBroadcastIp.c_str());
+                return WakeOnLan::WolErrorCode::InvalidBroadcastIp;
             }
         }
+        else
+        {
+            target.mMulticast = {};
+            std::uint32_t broadcastAddress = 0U;
+            if (WakeOnLan::ParseIpv4Address(target.mBroadcastIp, broadcastAddress) == false)
+            {
+                std::ignore = ::fwprintf(stderr, L"브로드캐스트 IP 주소가 유효하지 않습니다: %ls\n", target.mBroadcastIp.c_str());
+                return WakeOnLan::WolErrorCode::InvalidBroadcastIp;
+            }
 
-        // 정확히 3개의 점이 있어야 함 (4개 옥텟)
-        if (dotCount != 3U)
+            target.mBroadcastAddr.s_addr = htonl(broadcastAddress);
+        }
+
+        unsigned long port = 0UL;
+        if (ParseUnsigned(options.mPort, 1UL, UINT16_MAX, port) == false)
         {
-            std::ignore = ::fwprintf(
-                stderr, CONFIG_FILE_NAME L" 설정 파일의 BroadcastIp 구분자(.) 개수가 잘못되었습니다.(필요: 3, 실제: %zu)\n", dotCount);
-            return WolErrorCode::InvalidBroadcastIp;
+            std::ignore = ::fwprintf(stderr, L"포트 번호가 유효하지 않습니다 (1 ~ 65535): %ls\n", options.mPort.c_str());
+            return WakeOnLan::WolErrorCode::InvalidPort;
         }
 
-        return WolErrorCode::Success;
+        target.mPort = static_cast<std::uint16_t>(port);
+
+        WakeOnLan::WolErrorCode errorCode = session.Open();
+        if (errorCode != WakeOnLan::WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        const std::vector<WakeOnLan::WolTarget> targets{target};
+        std::vector<WakeOnLan::WolErrorCode> sendResults{};
+        const WakeOnLan::WakeOnLanSender wolSender{};
+        errorCode = wolSender.SendMagicPackets(session, targets, sendResults);
+        if (errorCode != WakeOnLan::WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        results.push_back({target.mName, target.mMacBytes, target.mBroadcastAddr.s_addr, target.mMulticast, target.mPort,
+                           target.mHostAddr.s_addr, 0U, 0U, sendResults.front(), std::nullopt});
+        return WakeOnLan::WolErrorCode::Success;
     }
 
-    WolErrorCode WolConfig::IsValidateIpOctet(_In_ const std::wstring_view octet) const noexcept
+    /// @brief 설정 파일의 대상에게 전송
+    /// @param options 명령줄 옵션 (mTargetNames가 비어 있으면 모든 대상)
+    /// @param session 전송할 세션 (열려 있지 않으면 설정을 읽은 뒤 엶)
+    /// @param results 대상별 전송 결과 출력
+    ///                --target으로 지정한 순서를 따르며, 찾을 수 없는 이름은 WolErrorCode::TargetNotFound 결과로 포함
+    /// @return 설정을 읽고 세션을 연 경우 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+    WakeOnLan::WolErrorCode WakeConfiguredTargets(_In_ const CommandLineOptions& options,
+                                                  _Inout_ WakeOnLan::WakeOnLanSession& session,
+                                                  _Out_ std::vector<WakeResult>& results)
     {
-        // 옥텟 길이 검사 (0 또는 너무 김)
-        if (octet.empty() || octet.length() > 3)
+        results.clear();
+
+        WakeOnLan::WolConfig config;
+        config.SetConfigFilePath(options.mConfigFilePath);
+
+        WakeOnLan::TargetDatabase database;
+        WakeOnLan::WolErrorCode errorCode = config.LoadDatabase(database);
+        if (errorCode != WakeOnLan::WolErrorCode::Success)
         {
-            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟 길이가 유효하지 않습니다.\n");
-            return WolErrorCode::InvalidBroadcastIp;
+            return errorCode;
         }
 
-        // 숫자 확인
-        for (const wchar_t ch : octet)
+        errorCode = session.Open();
+        if (errorCode != WakeOnLan::WolErrorCode::Success)
         {
-            if (iswdigit(ch) == false)
+            return errorCode;
+        }
+
+        const WakeOnLan::WakeOnLanSender wolSender{};
+        std::vector<WakeOnLan::WolErrorCode> sendResults{};
+
+        if (options.mTargetNames.empty())
+        {
+            errorCode = wolSender.SendMagicPackets(session, database, sendResults);
+            if (errorCode != WakeOnLan::WolErrorCode::Success)
             {
-                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟에 유효하지 않은 문자가 포함되어 있습니다: %c\n", ch);
-                return WolErrorCode::InvalidBroadcastIp;
+                return errorCode;
             }
+
+            results.reserve(database.GetCount());
+            for (std::size_t i = 0U; i < database.GetCount(); ++i)
+            {
+                const WakeOnLan::TargetDatabase::Record& record = database.GetRecord(i);
+                results.push_back({WakeOnLan::Utf8ToWide(database.GetName(record)), record.mMacBytes,
+                                   record.mBroadcastAddress, record.mMulticast, record.mPort, record.mHostAddress, record.mProbePort,
+                                   record.mRack, sendResults[i], std::nullopt});
+            }
+
+            return WakeOnLan::WolErrorCode::Success;
         }
 
-        // 선행 0 금지 (두 자리 이상인데 0으로 시작)
-        if (octet.length() > 1 && octet[0] == L'0')
+        // 요청한 이름(소문자)별로 데이터베이스에서 처음 나타나는 레코드를 찾음
+        std::unordered_map<std::wstring, std::size_t> requested{};
+        for (const std::wstring& name : options.mTargetNames)
         {
-            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟에 선행 0이 있습니다. 지원하지 않습니다.\n");
-            return WolErrorCode::InvalidBroadcastIp;
+            requested.try_emplace(WakeOnLan::ToLowerCase(name), database.GetCount());
         }
 
-        // 숫자 범위 확인
-        try
+        std::size_t remaining = requested.size();
+        for (std::size_t i = 0U; i < database.GetCount() && remaining > 0U; ++i)
         {
-            errno = 0;
-            wchar_t* endPtr = nullptr;
-            const long value = ::wcstol(std::wstring{octet}.c_str(), &endPtr, 10);
-
-            if (errno == EINVAL || errno == ERANGE)
+            const auto found = requested.find(WakeOnLan::ToLowerCase(WakeOnLan::Utf8ToWide(database.GetName(database.GetRecord(i)))));
+            if (found != requested.end() && found->second == database.GetCount())
             {
-                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟 값을 정수로 변환하는데 실패하였습니다: %ld\n",
-                                         value);
-                return WolErrorCode::InvalidBroadcastIp;
+                found->second = i;
+                --remaining;
             }
+        }
 
-            // endPtr == octet.c_str() > 변환된 숫자가 없음 (예: "abc")
-            // *endPtr != L'\0' > 숫자 뒤에 쓰레기 문자 있음 (예: "255abc")
-            if (endPtr == octet.data() || *endPtr != L'\0')
+        std::vector<WakeOnLan::WolTarget> targets{};
+        for (const std::wstring& name : options.mTargetNames)
+        {
+            const std::size_t index = requested.at(WakeOnLan::ToLowerCase(name));
+            if (index == database.GetCount())
             {
-                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟 값이 유효하지 않습니다: %.*ls\n",
-                                         static_cast<int>(octet.length()), octet.data());
-                return WolErrorCode::InvalidBroadcastIp;
+                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" 파일에서 대상을 찾을 수 없습니다: %ls\n", name.c_str());
+                results.push_back({name, {}, 0U, {}, 0U, 0U, 0U, 0U, WakeOnLan::WolErrorCode::TargetNotFound, std::nullopt, false, 0U});
+                continue;
             }
 
-            if (value < 0L || value > 255L)
-            {
-                std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟 값이 유효 범위를 벗어났습니다. (0~255): %ld\n",
-                                         value);
-                return WolErrorCode::InvalidBroadcastIp;
-            }
+            const WakeOnLan::TargetDatabase::Record& record = database.GetRecord(index);
+            WakeOnLan::WolTarget& target = targets.emplace_back();
+            target.mName = WakeOnLan::Utf8ToWide(database.GetName(record));
+            target.mMacBytes = record.mMacBytes;
+            target.mBroadcastAddr.s_addr = record.mBroadcastAddress;
+            target.mMulticast = record.mMulticast;
+            target.mPort = record.mPort;
+            target.mRack = record.mRack;
+            results.push_back({target.mName, record.mMacBytes, record.mBroadcastAddress, record.mMulticast, record.mPort,
+                               record.mHostAddress, record.mProbePort, record.mRack, WakeOnLan::WolErrorCode::Success,
+                               std::nullopt});
         }
-        catch (...)
+
+        if (targets.empty())
         {
-            std::ignore = ::fwprintf(stderr, CONFIG_FILE_NAME L" BroadcastIp 옥텟 숫자 변환 중 오류가 발생하였습니다.\n");
-            return WolErrorCode::UnexpectedException;
+            return WakeOnLan::WolErrorCode::Success;
         }
 
-        return WolErrorCode::Success;
+        errorCode = wolSender.SendMagicPackets(session, targets, sendResults);
+        if (errorCode != WakeOnLan::WolErrorCode::Success)
+        {
+            return errorCode;
+        }
+
+        // 찾은 대상의 결과를 요청한 순서대로 채움
+        std::size_t sendIndex = 0U;
+        for (WakeResult& result : results)
+        {
+            if (result.mResult == WakeOnLan::WolErrorCode::Success)
+            {
+                result.mResult = sendResults[sendIndex++];
+            }
+        }
+
+        return WakeOnLan::WolErrorCode::Success;
     }
 
-    /// @brief WinSock SOCKET 리소스를 RAII 방식으로 관리하는 클래스
-    /// @details 소멸자에서 closesocket()을 자동 호출하여 자원 누수를 방지
-    class Socket final
+    /// @brief 전송에 성공한 대상이 켜졌는지 확인하고, 응답하지 않은 대상에게는 매직 패킷을 다시 보냄
+    /// @param options 명령줄 옵션 (mVerifyMethod, mVerifyTimeout, mVerifyPort, mRetry*)
+    /// @param session 다시 보낼 때 사용할 세션 (처음 전송한 세션, 전송 속도 제한도 그대로 적용)
+    /// @param results 대상별 결과 (전송에 성공한 대상의 결과를 확인 결과로 바꾸고 mTimeToAlive, mSendCount를 채움)
+    /// @return 확인을 시작한 경우 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
+    /// @details 모든 대상을 하나의 LivenessProber로 동시에 확인하며, 응답하는 대로 진행 상황을 출력
+    ///          재전송 시각은 RetryScheduler가 정하고, 응답한 대상은 그 즉시 재전송을 중단
+    WakeOnLan::WolErrorCode VerifyTargets(_In_ const CommandLineOptions& options, _Inout_ WakeOnLan::WakeOnLanSession& session,
+                                          _Inout_ std::vector<WakeResult>& results)
     {
-    public:
-        // socket 유효한 SOCKET 핸들 또는 INVALID_SOCKET (기본값)
-        /// @note 기본값은 INVALID_SOCKET이며, 이후 Set()으로 설정할 수 있음
-        explicit Socket(const SOCKET& socket = INVALID_SOCKET) noexcept;
+        // ParseCommandLine()에서 검증
+        unsigned long timeoutSeconds = 0UL;
+        unsigned long defaultPort = 0UL;
+        unsigned long maxAttempts = 0UL;
+        double retryInterval = 0.0;
+        WakeOnLan::RetryPolicy retryPolicy{};
+        std::ignore = ParseUnsigned(options.mVerifyTimeout, 1UL, 86400UL, timeoutSeconds);
+        std::ignore = ParseUnsigned(options.mVerifyPort, 1UL, UINT16_MAX, defaultPort);
+        std::ignore = ParseUnsigned(options.mRetryMax, 1UL, 1000UL, maxAttempts);
+        std::ignore = ParseDecimal(options.mRetryInterval, 0.1, 3600.0, retryInterval);
+        std::ignore = ParseDecimal(options.mRetryMultiplier, 1.0, 10.0, retryPolicy.mMultiplier);
+        std::ignore = ParseDecimal(options.mRetryJitter, 0.0, 1.0, retryPolicy.mJitter);
+        retryPolicy.mInitialInterval = std::chrono::milliseconds{static_cast<std::int64_t>(retryInterval * 1000.0)};
+        retryPolicy.mMaxInterval = (std::max)(retryPolicy.mMaxInterval, retryPolicy.mInitialInterval);
+        retryPolicy.mMaxAttempts = static_cast<std::uint32_t>(maxAttempts);
+
+        // 전송에 성공한 대상만 확인
+        std::vector<WakeOnLan::ProbeTarget> probeTargets{};
+        std::vector<std::size_t> resultIndices{};
+        for (std::size_t i = 0U; i < results.size(); ++i)
+        {
+            const WakeResult& result = results[i];
+            if (result.mResult != WakeOnLan::WolErrorCode::Success)
+                continue;
+
+            const std::uint16_t port = result.mProbePort != 0U ? result.mProbePort : static_cast<std::uint16_t>(defaultPort);
+            probeTargets.push_back({result.mMacBytes, result.mHostAddress, port});
+            resultIndices.push_back(i);
+        }
 
-        /// @brief 소멸자
-        /// @details 소켓이 유효하다면 closesocket() 호출 후 INVALID_SOCKET으로 초기화
-        ~Socket() noexcept;
+        if (probeTargets.empty())
+        {
+            return WakeOnLan::WolErrorCode::Success;
+        }
 
-        /// @brief 복사 생성자 - 사용하지 않음
-        Socket(const Socket& other) = delete;
+        WakeOnLan::LivenessProber prober;
+        prober.SetSendBackend(options.mSendBackend);
+        WakeOnLan::WolErrorCode errorCode = prober.Open(*options.mVerifyMethod);
+        if (errorCode != WakeOnLan::WolErrorCode::Success)
+        {
+            return errorCode;
+        }
 
-        /// @brief 이동 생성자 - 사용하지 않음
-        Socket(Socket&& other) noexcept = delete;
+        // 재전송할 패킷은 대상별로 한 번만 준비
+        const WakeOnLan::WakeOnLanSender wolSender{};
+        std::vector<WakeOnLan::WolPacket> packets(probeTargets.size());
+        for (std::size_t i = 0U; i < packets.size(); ++i)
+        {
+            const WakeResult& result = results[resultIndices[i]];
+            in_addr broadcastAddr{};
+            broadcastAddr.s_addr = result.mBroadcastAddress;
+            session.GetMagicPacket(result.mMacBytes, packets[i].mPacket);
+            wolSender.SetupDestination(broadcastAddr, result.mMulticast, result.mPort, packets[i].mDestAddr);
+            packets[i].mRack = result.mRack;
+        }
 
-        /// @brief 복사 대입 연산자 - 사용하지 않음
-        Socket& operator=(const Socket& other) = delete;
+        errorCode = prober.Start(probeTargets);
+        if (errorCode != WakeOnLan::WolErrorCode::Success)
+        {
+            return errorCode;
+        }
 
-        /// @brief 이동 대입 연산자 - 사용하지 않음
-        Socket& operator=(Socket&& other) noexcept = delete;
+        const auto startTime = std::chrono::steady_clock::now();
+        WakeOnLan::RetryScheduler scheduler;
+        errorCode = scheduler.Start(probeTargets.size(), retryPolicy, startTime);
+        if (errorCode != WakeOnLan::WolErrorCode::Success)
+        {
+            return errorCode;
+        }
 
-        /// @brief 새로운 SOCKET 값을 설정
-        /// @param socket 새로 할당받은 유효한 소켓 핸들
-        /// @note 이전 소켓이 열려 있다면 closesocket()으로 닫고 교체
-        void Set(const SOCKET& socket) noexcept;
+        const bool printProgress = options.mQuiet == false && options.mJson == false;
+        if (printProgress)
+        {
+            std::ignore = ::fwprintf(stdout, L"대상 %zu개가 켜지기를 기다리는 중... (최대 %lu초)\n", prober.GetPendingCount(),
+                                     timeoutSeconds);
+        }
 
-        /// @brief 내부의 raw SOCKET 핸들을 반환
-        [[nodiscard]] SOCKET Get() const noexcept { return mSocket; }
+        const auto deadline = startTime + std::chrono::seconds{timeoutSeconds};
+        std::vector<std::size_t> alive{};
+        std::vector<std::size_t> due{};
+        std::vector<WakeOnLan::WolPacket> retryPackets{};
+        std::vector<WakeOnLan::WolErrorCode> sendResults{};
+        while (prober.GetPendingCount() > 0U)
+        {
+            auto now = std::chrono::steady_clock::now();
+            if (now >= deadline)
+                break;
+
+            // 제한 시간과 다음 재전송 시각 중 먼저 오는 시각까지 응답을 기다림
+            const auto wakeTime = (std::min)(deadline, scheduler.GetNextDeadline());
+            const auto wait = wakeTime > now ? std::chrono::ceil<std::chrono::milliseconds>(wakeTime - now)
+                                             : std::chrono::milliseconds::zero();
+            errorCode = prober.Poll(wait, alive);
+            if (errorCode != WakeOnLan::WolErrorCode::Success)
+            {
+                return errorCode;
+            }
 
-    private:
-        /// @brief 내부 소켓 핸들을 닫고 INVALID_SOCKET으로 초기화
-        /// @details 유효한 경우에만 closesocket()을 호출
-        void Close() noexcept;
+            for (const std::size_t index : alive)
+            {
+                scheduler.Cancel(index);
+                if (printProgress)
+                {
+                    std::ignore = ::fwprintf(stdout, L"  %7.1f초  %ls\n",
+                                             static_cast<double>(prober.GetResult(index).mTimeToAlive.count()) / 1000.0,
+                                             results[resultIndices[index]].mName.c_str());
+                }
+            }
 
-    private:
-        /// @brief WinSock에서 사용되는 SOCKET 핸들
-        SOCKET mSocket;
-    };
+            now = std::chrono::steady_clock::now();
+            errorCode = scheduler.Collect(now, due);
+            if (errorCode != WakeOnLan::WolErrorCode::Success)
+            {
+                return errorCode;
+            }
 
-    Socket::Socket(const SOCKET& socket) noexcept
-        : mSocket(socket)
-    {
-    }
+            if (due.empty())
+                continue;
 
-    Socket::~Socket() noexcept
-    {
-        // WinSock SOCKET은 자동 관리되지 않는 리소스이므로 명시적으로 closesocket() 필요
-        // Rule of Zero는 이 경우 적용되지 않음
-        Close();
-    }
+            // 재전송 실패는 다음 재전송이나 응답 확인 결과에 맡기고 계속 진행
+            retryPackets.clear();
+            for (const std::size_t index : due)
+            {
+                retryPackets.push_back(packets[index]);
+            }
 
+            std::ignore = session.SendBatch(retryPackets, sendResults);
+            if (printProgress)
+            {
+                std::ignore = ::fwprintf(stdout, L"  %7.1f초  응답하지 않은 대상 %zu개에게 다시 전송\n",
+                                         std::chrono::duration<double>(now - startTime).count(), due.size());
+            }
+        }
 
-    void Socket::Set(const SOCKET& socket) noexcept
-    {
-        assert(socket != INVALID_SOCKET); // 유효하지 않은 핸들은 허용하지 않음
+        for (std::size_t i = 0U; i < resultIndices.size(); ++i)
+        {
+            const WakeOnLan::ProbeResult& probeResult = prober.GetResult(i);
+            WakeResult& result = results[resultIndices[i]];
+            result.mResult = probeResult.mResult;
+            result.mVerified = true;
+            result.mSendCount = scheduler.GetAttempts(i);
+            if (probeResult.mResult == WakeOnLan::WolErrorCode::Success)
+            {
+                result.mTimeToAlive = probeResult.mTimeToAlive;
+            }
+        }
 
-        Close(); // 이전 핸들이 열려 있다면 닫음
-        mSocket = socket; // 새 핸들로 교체
+        return WakeOnLan::WolErrorCode::Success;
     }
 
-    void Socket::Close() noexcept
+    /// @brief 종료 코드로 사용할 결과를 반환
+    /// @return errorCode가 실패라면 errorCode, 아니라면 첫 번째 실패한 대상의 결과, 모두 성공하면 WolErrorCode::Success
+    WakeOnLan::WolErrorCode GetOverallResult(_In_ const WakeOnLan::WolErrorCode errorCode,
+                                             _In_ const std::vector<WakeResult>& results) noexcept
     {
-        if (mSocket == INVALID_SOCKET)
-            return;
+        if (errorCode != WakeOnLan::WolErrorCode::Success)
+            return errorCode;
 
-        closesocket(mSocket); // 소켓 닫기
-        mSocket = INVALID_SOCKET; // 상태 초기화
+        for (const WakeResult& result : results)
+        {
+            if (result.mResult != WakeOnLan::WolErrorCode::Success)
+                return result.mResult;
+        }
+
+        return WakeOnLan::WolErrorCode::Success;
     }
 
-    /// @brief WinSock 초기화/해제를 보장하는 RAII 유틸리티 클래스
-    /// @details WSAStartup()을 호출해 WinSock 환경을 초기화하고
-    ///			소멸자에서 WSACleanup()을 자동 호출
-    ///			단일 스레드 또는 모듈 내에서 중복 초기화를 방지하기 위해 참조 카운트를 사용
-    class WsaGuard final
+    /// @brief 결과의 대상 주소(IPv4 브로드캐스트 또는 IPv6 멀티캐스트)를 문자열로 변환
+    /// @param result 대상별 결과
+    /// @param text 변환된 문자열 출력
+    void FormatDestination(_In_ const WakeResult& result, _Out_ std::array<wchar_t, 64U>& text) noexcept
     {
-    public:
-        /// @brief 기본 생성자
-        WsaGuard() noexcept = default;
-
-        /// @brief 복사 생성자 - 사용하지 않음
-        WsaGuard(const WsaGuard& other) = delete;
-
-        /// @brief 이동 생성자 - 사용하지 않음
-        WsaGuard(WsaGuard&& other) noexcept = delete;
+        if (result.mMulticast.IsSet())
+        {
+            WakeOnLan::FormatIpv6Address(result.mMulticast, text);
+            return;
+        }
 
-        /// @brief 복사 대입 연산자 - 사용하지 않음
-        WsaGuard& operator=(const WsaGuard& other) = delete;
+        std::array<wchar_t, 16U> ipv4Text{};
+        WakeOnLan::FormatIpv4Address(result.mBroadcastAddress, ipv4Text);
+        text = {};
+        std::copy(ipv4Text.begin(), ipv4Text.end(), text.begin());
+    }
 
-        /// @brief 이동 대입 연산자 - 사용하지 않음
-        WsaGuard& operator=(WsaGuard&& other) noexcept = delete;
+    /// @brief 대상별 결과 표를 출력
+    /// @param results 대상별 결과
+    /// @param verified 켜졌는지 확인한 결과인지 여부 (전송 횟수와 응답 시간 열을 추가)
+    void PrintResultTable(_In_ const std::vector<WakeResult>& results, _In_ const bool verified)
+    {
+        // WolErrorCodeToString()의 결과는 줄바꿈으로 끝남
+        std::size_t successCount = 0U;
+        std::ignore = ::fwprintf(stdout, L"%-32ls %-17ls %-15ls %5ls  %ls%ls\n", L"대상", L"MAC", L"브로드캐스트 IP", L"포트",
+                                 verified ? L"전송  응답 시간  " : L"", L"결과");
+        for (const WakeResult& result : results)
+        {
+            std::array<wchar_t, WakeOnLan::MAC_ADDRESS_SEPARATED_LENGTH + 1U> macText{};
+            std::array<wchar_t, 64U> ipText{};
+            WakeOnLan::FormatMacAddress(result.mMacBytes, macText);
+            FormatDestination(result, ipText);
+
+            std::ignore = ::fwprintf(stdout, L"%-32ls %-17ls %-15ls %5u  ", result.mName.c_str(), macText.data(),
+                                     ipText.data(), static_cast<unsigned int>(result.mPort));
+            if (verified)
+            {
+                std::ignore = ::fwprintf(stdout, L"%4u  ", static_cast<unsigned int>(result.mSendCount));
+            }
 
-        /// @brief 소멸자
-        /// @details 참조 카운트를 감소시키고, 0이 되면 WSACleanup() 호출
-        ~WsaGuard() noexcept;
+            if (verified && result.mTimeToAlive.has_value())
+            {
+                std::ignore = ::fwprintf(stdout, L"%7.1f초  ", static_cast<double>(result.mTimeToAlive->count()) / 1000.0);
+            }
+            else if (verified)
+            {
+                std::ignore = ::fwprintf(stdout, L"%8ls  ", L"-");
+            }
 
-        /// @brief WinSock 환경을 초기화합니다.
-        /// @return 성공 시 WolErrorCode::Success, 실패 시 적절한 에러 코드
-        /// @note 참조 카운트를 증가시켜 중복 초기화를 안전하게 처리
-        WolErrorCode Initialize();
+            std::ignore = ::fwprintf(stdout, L"%ls", WakeOnLan::WolErrorCodeToString(result.mResult).c_str());
 
-    private:
-        /// @brief WSAStartup()에서 채워지는 구조체
-        WSADATA mWsaData{};
+            if (result.mResult == WakeOnLan::WolErrorCode::Success)
+                ++successCount;
+        }
 
-        /// @brief 현재 활성화된 초기화 인스턴스의 수
-        /// @note 전역 정적 변수이며, Initialize() 성공 시 증가, 소멸자에서 감소
-        static unsigned long long mRefCount;
-    };
+        std::ignore = ::fwprintf(stdout, verified ? L"\n응답: %zu / %zu\n" : L"\n전송 성공: %zu / %zu\n", successCount,
+                                 results.size());
+    }
 
-    // 정적 참조 카운트 초기값
-    unsigned long long WsaGuard::mRefCount = 0;
+    /// @brief 전송 속도 제한 통계를 출력
+    void PrintPacingStats(_In_ const WakeOnLan::PacingStats& stats)
+    {
+        std::ignore = ::fwprintf(stdout, L"전송 속도 제한: 패킷 %llu개를 %llu번에 나누어 전송 (최대 %llu개), 대기 %llu번 %.1f초, "
+                                         L"전체 한도 도달 %llu번, 랙 한도로 미룸 %llu번\n",
+                                 static_cast<unsigned long long>(stats.mPacketsSent),
+                                 static_cast<unsigned long long>(stats.mBursts),
+                                 static_cast<unsigned long long>(stats.mLargestBurst),
+                                 static_cast<unsigned long long>(stats.mWaits),
+                                 static_cast<double>(stats.mWaitTime.count()) / 1000000.0,
+                                 static_cast<unsigned long long>(stats.mPacketLimitHits),
+                                 static_cast<unsigned long long>(stats.mRackDeferrals));
+    }
 
-    WsaGuard::~WsaGuard() noexcept
+    /// @brief 네트워크 인터페이스별 전송 결과를 출력
+    void PrintInterfaceStats(_In_ const std::vector<WakeOnLan::InterfaceSendStats>& interfaceStats)
     {
-        --mRefCount;
-        if (mRefCount == 0)
+        std::ignore = ::fwprintf(stdout, L"네트워크 인터페이스별 전송:\n");
+        for (const WakeOnLan::InterfaceSendStats& stats : interfaceStats)
         {
-            // 모든 인스턴스가 종료되었으므로 WinSock 환경 종료
-            std::ignore = WSACleanup(); // WSACleanup() 실패 시 복구 수단이 없으므로 무시
+            std::array<wchar_t, 16U> addressText{};
+            WakeOnLan::FormatIpv4Address(stats.mInterface.mAddress, addressText);
+            std::ignore = ::fwprintf(stdout, L"  %-16ls %-15ls 성공 %llu, 실패 %llu", stats.mInterface.mName.c_str(),
+                                     addressText.data(), static_cast<unsigned long long>(stats.mPacketsSent),
+                                     static_cast<unsigned long long>(stats.mSendErrors));
+            if (stats.mLastError != 0)
+            {
+                std::ignore = ::fwprintf(stdout, L" (마지막 오류: %d)", stats.mLastError);
+            }
+            std::ignore = ::fwprintf(stdout, L" - %ls", WakeOnLan::WolErrorCodeToString(stats.GetResult()).c_str());
         }
     }
 
-    WolErrorCode WsaGuard::Initialize()
+    /// @brief 전송 스레드별 통계를 출력
+    /// @details 지연 시간은 패킷이 전송 스레드들에게 넘겨진 때부터 그 패킷의 전송 호출이 끝날 때까지
+    void PrintWorkerStats(_In_ const std::vector<WakeOnLan::SendWorkerStats>& workerStats)
     {
-        // WinSock 초기화
-        if (WSAStartup(MAKEWORD(2, 2), &mWsaData) != 0)
+        std::ignore = ::fwprintf(stdout, L"전송 스레드별 통계:\n");
+        for (std::size_t i = 0U; i < workerStats.size(); ++i)
         {
-            std::ignore = ::fwprintf(stderr, L"WinSock 초기화에 실패했습니다.\n");
-            return WolErrorCode::WinsockInitializationFailed;
+            const WakeOnLan::SendWorkerStats& stats = workerStats[i];
+            std::ignore = ::fwprintf(stdout, L"  #%-3zu 성공 %llu, 실패 %llu, 묶음 %llu (가져옴 %llu), %.0f 패킷/초, "
+                                             L"지연 p50 %lldµs, p99 %lldµs, 최대 %lldµs\n",
+                                     i, static_cast<unsigned long long>(stats.mPacketsSent),
+                                     static_cast<unsigned long long>(stats.mSendErrors),
+                                     static_cast<unsigned long long>(stats.mChunks),
+                                     static_cast<unsigned long long>(stats.mStolenChunks), stats.GetPacketsPerSecond(),
+                                     static_cast<long long>(stats.mLatency.GetPercentile(50.0).count()),
+                                     static_cast<long long>(stats.mLatency.GetPercentile(99.0).count()),
+                                     static_cast<long long>(stats.mLatency.GetMax().count()));
         }
-
-        // 성공 시 참조 카운트 증가
-        mRefCount++;
-
-        return WolErrorCode::Success;
     }
 
-    ///	@brief WOL 패킷 전송 클래스
-    class WakeOnLanSender final
+    /// @brief 문자열을 JSON 문자열 리터럴로 추가
+    void AppendJsonString(_Inout_ std::wstring& json, _In_ const std::wstring_view text)
     {
-    public:
-        /// @brief 기본 생성자
-        WakeOnLanSender() noexcept = default;
-
-        /// @brief 복사 생성자 - 사용하지 않음
-        WakeOnLanSender(const WakeOnLanSender& other) = delete;
-
-        /// @brief 이동 생성자 - 사용하지 않음
-        WakeOnLanSender(WakeOnLanSender&& other) noexcept = delete;
-
-        /// @brief 복사 대입 연산자 - 사용하지 않음
-        WakeOnLanSender& operator=(const WakeOnLanSender& other) = delete;
-
-        /// @brief 이동 대입 연산자 - 사용하지 않음
-        WakeOnLanSender& operator=(WakeOnLanSender&& other) noexcept = delete;
-
-        /// @brief 소멸자 - 기본 소멸자 사용
-        ~WakeOnLanSender() noexcept = default;
-
-        ///	@brief WOL 매직 패킷을 전송합니다.
-        ///	@param macAddress 대상 장치의 MAC 주소 (예: "00:11:22:AA:BB:CC")
-        ///	@param broadcastAddress 브로드캐스트 주소
-        ///	@param port 포트 번호
-        ///	@return 전송에 성공한 경우 WolErrorCode::Success, 실패한 경우 적절한 WolErrorCode 값
-        [[nodiscard]] WolErrorCode SendMagicPacket(_In_ std::wstring_view macAddress,
-                                                   _In_ std::wstring_view broadcastAddress,
-                                                   _In_range_(1, 65535) std::uint16_t port) const noexcept;
-
-    private:
-        /// @brief MAC 주소 문자열을 바이트 배열로 변환
-        /// @param macAddressString 변환할 MAC 주소 문자열 (예: "00:11:22:AA:BB:CC")
-        /// @param macBytes 변환된 MAC 주소 바이트 배열 출력
-        /// @note 입력 문자열은 "XX-XX-XX-XX-XX-XX" 형식을 따라야 하며, 각 XX는 00~FF 범위의 16진수여야 함
-        void ParseMacAddress(_In_ std::wstring_view macAddressString, _Out_ MacAddress& macBytes) const noexcept;
-
-        /// @brief 매직 패킷을 생성
-        /// @param macBytes 대상 장치의 MAC 주소 바이트 배열
-        /// @param packet 생성된 매직 패킷(102바이트) 출력
-        /// @details 첫 6바이트는 0xFF 동기화 헤더로, 이후 MAC 주소를 16회 반복하여 패킷을 구성
-        void CreateMagicPacket(_In_ const MacAddress& macBytes, _Out_ MagicPacket& packet) const noexcept;
-
-        /// @brief UDP 소켓을 초기화
-        /// @param socket 생성된 소켓 핸들이 저장될 변수
-        /// @return 초기화 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
-        /// @note AF_INET, SOCK_DGRAM, IPPROTO_UDP 옵션으로 소켓을 생성합니다.
-        [[nodiscard]] WolErrorCode InitializeSocket(_Inout_ Socket& socket) const noexcept;
-
-        /// @brief 브로드캐스트 대상 주소를 설정
-        /// @param broadcastAddress 브로드캐스트 IP 문자열 (예: "255.255.255.255")
-        /// @param port 대상 포트 번호 (1~65535)
-        /// @param destAddr 설정된 sockaddr_in 구조체 출력
-        /// @return 변환 성공 시 WolErrorCode::Success, 실패 시 적절한 WolErrorCode 값
-        /// @details WideCharToMultiByte로 문자열을 ANSI로 변환한 후 inet_pton으로 sin_addr를 설정
-        [[nodiscard]] WolErrorCode SetupBroadcastAddress(_In_ std::wstring_view broadcastAddress,
-                                                         _In_range_(1, 65535) std::uint16_t port,
-                                                         _Out_ sockaddr_in& destAddr) const noexcept;
-    };
+        json += L'"';
+        for (const wchar_t ch : text)
+        {
+            switch (ch)
+            {
+            case L'"': json += L"\\\""; break;
+            case L'\\': json += L"\\\\"; break;
+            case L'\n': json += L"\\n"; break;
+            case L'\r': json += L"\\r"; break;
+            case L'\t': json += L"\\t"; break;
+            default:
+                if (static_cast<std::uint32_t>(ch) < 0x20U)
+                {
+                    std::array<wchar_t, 8U> escaped{};
+                    std::ignore = std::swprintf(escaped.data(), escaped.size(), L"\\u%04x", static_cast<unsigned int>(ch));
+                    json += escaped.data();
+                }
+                else
+                {
+                    json += ch;
+                }
+                break;
+            }
+        }
+        json += L'"';
+    }
 
-    inline WolErrorCode WakeOnLanSender::SendMagicPacket(_In_ const std::wstring_view macAddress,
-                                                         _In_ const std::wstring_view broadcastAddress,
-                                                         _In_range_(1, 65535) const std::uint16_t port) const noexcept
+    /// @brief 결과를 JSON 한 줄로 출력
+    /// @param overallResult 종료 코드로 사용할 결과
+    /// @param results 대상별 결과
+    /// @param verified 켜졌는지 확인한 결과인지 여부 ("alive", "timeToAliveMs" 필드를 추가)
+    /// @param pacingStats 전송 속도 제한 통계 (제한하지 않았다면 nullptr, 있으면 최상위에 "pacing" 객체 추가)
+    /// @param interfaceStats 네트워크 인터페이스별 전송 결과 (비어 있지 않으면 최상위에 "interfaces" 배열 추가)
+    /// @param workerStats 전송 스레드별 통계 (스레드가 둘 이상이면 최상위에 "workers" 배열 추가)
+    /// @details {"code":0,"error":"Success","sent":1,"failed":0,"results":[{"target":"...","mac":"...",
+    ///          "broadcastIp":"...","port":9,"code":0,"error":"Success"}]}
+    ///          "code"는 종료 코드와 같은 WolErrorCode 값, "error"는 WolErrorCodeToName()의 식별자
+    ///          확인한 경우 최상위에 "alive"(응답한 대상 수), 대상별로 "alive"(true/false), "timeToAliveMs"(응답하지 않았다면 null),
+    ///          "sendCount"(다시 보낸 횟수를 포함한 전송 횟수) 추가
+    ///          "pacing": {"packets":..,"bursts":..,"largestBurst":..,"waits":..,"waitMs":..,"packetLimitHits":..,"rackDeferrals":..}
+    ///          "interfaces": [{"name":"...","address":"...","sent":..,"failed":..,"lastError":..,"code":..,"error":"..."}]
+    ///          "workers": [{"thread":0,"sent":..,"failed":..,"chunks":..,"stolen":..,"packetsPerSecond":..,"p50Us":..,"p99Us":..,"maxUs":..}]
+    void PrintJson(_In_ const WakeOnLan::WolErrorCode overallResult, _In_ const std::vector<WakeResult>& results,
+                   _In_ const bool verified, _In_opt_ const WakeOnLan::PacingStats* const pacingStats,
+                   _In_ const std::vector<WakeOnLan::InterfaceSendStats>& interfaceStats,
+                   _In_ const std::vector<WakeOnLan::SendWorkerStats>& workerStats)
     {
-        // 설정 파일을 읽는 과정에서 설정 값(Mac Address, Broadcast Address, port)의 값이 유효한지
-        // 검증 했기 떄문에 여기서 또 검증하지 않는다. 간단히 assert로만 체크
-        assert(macAddress.empty() == false);
-        assert(broadcastAddress.empty() == false);
-        assert(port != 0);
-
-        // MAC 주소 파싱
-        MacAddress macBytes{};
-        ParseMacAddress(macAddress, macBytes);
-
-        // 매직 패킷 생성
-        MagicPacket packet{};
-        CreateMagicPacket(macBytes, packet);
-
-        WsaGuard wsaGuard;
-        WolErrorCode wolErrorCode = wsaGuard.Initialize();
-        if (wolErrorCode != WolErrorCode::Success)
+        const auto countSent = static_cast<std::size_t>(std::count_if(results.begin(), results.end(), [](const WakeResult& result)
+        {
+            return result.mResult == WakeOnLan::WolErrorCode::Success || result.mVerified;
+        }));
+        const auto countAlive = static_cast<std::size_t>(std::count_if(results.begin(), results.end(), [](const WakeResult& result)
         {
-            return wolErrorCode;
+            return result.mTimeToAlive.has_value();
+        }));
+
+        std::wstring json{};
+        json.reserve(64U + (results.size() * 128U));
+        json += L"{\"code\":" + std::to_wstring(static_cast<unsigned int>(overallResult));
+        json += L",\"error\":";
+        AppendJsonString(json, WakeOnLan::WolErrorCodeToName(overallResult));
+        json += L",\"sent\":" + std::to_wstring(countSent);
+        json += L",\"failed\":" + std::to_wstring(results.size() - countSent);
+        if (verified)
+        {
+            json += L",\"alive\":" + std::to_wstring(countAlive);
         }
-
-        // 소켓 초기화
-        Socket socket;
-        wolErrorCode = InitializeSocket(socket);
-        if (wolErrorCode != WolErrorCode::Success)
+        if (pacingStats != nullptr)
         {
-            return wolErrorCode;
+            json += L",\"pacing\":{\"packets\":" + std::to_wstring(pacingStats->mPacketsSent);
+            json += L",\"bursts\":" + std::to_wstring(pacingStats->mBursts);
+            json += L",\"largestBurst\":" + std::to_wstring(pacingStats->mLargestBurst);
+            json += L",\"waits\":" + std::to_wstring(pacingStats->mWaits);
+            json += L",\"waitMs\":" + std::to_wstring(pacingStats->mWaitTime.count() / 1000);
+            json += L",\"packetLimitHits\":" + std::to_wstring(pacingStats->mPacketLimitHits);
+            json += L",\"rackDeferrals\":" + std::to_wstring(pacingStats->mRackDeferrals) + L'}';
         }
-
-        // 브로드캐스트 설정
-        constexpr bool broadcastOpt = true;
-        if (setsockopt(socket.Get(), SOL_SOCKET, SO_BROADCAST, reinterpret_cast<const char*>(&broadcastOpt),
-                       sizeof(broadcastOpt)) == SOCKET_ERROR)
+        if (interfaceStats.empty() == false)
         {
-            return WolErrorCode::BroadcastSetupFailed;
+            json += L",\"interfaces\":[";
+            for (std::size_t i = 0U; i < interfaceStats.size(); ++i)
+            {
+                const WakeOnLan::InterfaceSendStats& stats = interfaceStats[i];
+                std::array<wchar_t, 16U> addressText{};
+                WakeOnLan::FormatIpv4Address(stats.mInterface.mAddress, addressText);
+
+                json += i == 0U ? L"{\"name\":" : L",{\"name\":";
+                AppendJsonString(json, stats.mInterface.mName);
+                json += L",\"address\":";
+                AppendJsonString(json, addressText.data());
+                json += L",\"sent\":" + std::to_wstring(stats.mPacketsSent);
+                json += L",\"failed\":" + std::to_wstring(stats.mSendErrors);
+                json += L",\"lastError\":" + std::to_wstring(stats.mLastError);
+                json += L",\"code\":" + std::to_wstring(static_cast<unsigned int>(stats.GetResult()));
+                json += L",\"error\":";
+                AppendJsonString(json, WakeOnLan::WolErrorCodeToName(stats.GetResult()));
+                json += L'}';
+            }
+            json += L']';
         }
-
-        // 대상 주소 설정
-        sockaddr_in destAddr{};
-        wolErrorCode = SetupBroadcastAddress(broadcastAddress, port, destAddr);
-        if (wolErrorCode != WolErrorCode::Success)
+        if (workerStats.size() > 1U)
         {
-            return wolErrorCode;
+            json += L",\"workers\":[";
+            for (std::size_t i = 0U; i < workerStats.size(); ++i)
+            {
+                const WakeOnLan::SendWorkerStats& stats = workerStats[i];
+                json += (i == 0U ? L"{\"thread\":" : L",{\"thread\":") + std::to_wstring(i);
+                json += L",\"sent\":" + std::to_wstring(stats.mPacketsSent);
+                json += L",\"failed\":" + std::to_wstring(stats.mSendErrors);
+                json += L",\"chunks\":" + std::to_wstring(stats.mChunks);
+                json += L",\"stolen\":" + std::to_wstring(stats.mStolenChunks);
+                json += L",\"packetsPerSecond\":" + std::to_wstring(static_cast<std::uint64_t>(stats.GetPacketsPerSecond()));
+                json += L",\"p50Us\":" + std::to_wstring(stats.mLatency.GetPercentile(50.0).count());
+                json += L",\"p99Us\":" + std::to_wstring(stats.mLatency.GetPercentile(99.0).count());
+                json += L",\"maxUs\":" + std::to_wstring(stats.mLatency.GetMax().count()) + L'}';
+            }
+            json += L']';
         }
+        json += L",\"results\":[";
 
-        // 매직 패킷 전송
-        const int sendResult = sendto(socket.Get(), reinterpret_cast<const char*>(packet.data()),
-                                      static_cast<int>(packet.size()), 0, reinterpret_cast<const sockaddr*>(&destAddr),
-                                      sizeof(destAddr));
-        if (sendResult == SOCKET_ERROR)
+        for (std::size_t i = 0U; i < results.size(); ++i)
         {
-            std::ignore = ::fwprintf(stderr, L"패킷 전송 실패: %d (WSALastError)\n", WSAGetLastError());
-            return WolErrorCode::PacketSendFailed;
+            const WakeResult& result = results[i];
+            std::array<wchar_t, WakeOnLan::MAC_ADDRESS_SEPARATED_LENGTH + 1U> macText{};
+            std::array<wchar_t, 64U> ipText{};
+            WakeOnLan::FormatMacAddress(result.mMacBytes, macText);
+            FormatDestination(result, ipText);
+
+            json += i == 0U ? L"{\"target\":" : L",{\"target\":";
+            AppendJsonString(json, result.mName);
+            json += L",\"mac\":";
+            AppendJsonString(json, macText.data());
+            json += L",\"broadcastIp\":";
+            AppendJsonString(json, ipText.data());
+            json += L",\"port\":" + std::to_wstring(result.mPort);
+            json += L",\"code\":" + std::to_wstring(static_cast<unsigned int>(result.mResult));
+            json += L",\"error\":";
+            AppendJsonString(json, WakeOnLan::WolErrorCodeToName(result.mResult));
+            if (verified)
+            {
+                json += result.mTimeToAlive.has_value() ? L",\"alive\":true,\"timeToAliveMs\":" + std::to_wstring(result.mTimeToAlive->count())
+                                                        : std::wstring{L",\"alive\":false,\"timeToAliveMs\":null"};
+                json += L",\"sendCount\":" + std::to_wstring(result.mSendCount);
+            }
+            json += L'}';
         }
 
-        return WolErrorCode::Success;
+        json += L"]}\n";
+        std::ignore = ::fwprintf(stdout, L"%ls", json.c_str());
     }
 
-    inline void WakeOnLanSender::ParseMacAddress(_In_ const std::wstring_view macAddressString,
-                                                 _Out_ MacAddress& macBytes) const noexcept
+    /// @brief 설정을 읽지 못한 원인을 출력
+    void PrintConfigError(_In_ const WakeOnLan::WolErrorCode errorCode)
     {
-        // 설정 파일을 읽는 과정에서 설정 값(Mac Address, Broadcast Address, port)의 값이 유효한지
-        // 검증 했기 떄문에 여기서 또 검증하지 않는다. 간단히 assert로만 체크
-        assert(macAddressString.empty() == false);
-
-        std::array<unsigned int, 6> tempValues{};
-
-        // MAC 주소 파싱 (예: "A0-36-BC-BB-EB-CC")
-        const std::wstring tempMacString{macAddressString}; // null 종료 보장
-        [[maybe_unused]] const int scanResult = swscanf_s(tempMacString.c_str(), L"%x-%x-%x-%x-%x-%x",
-                                                          &tempValues[0], &tempValues[1], &tempValues[2],
-                                                          &tempValues[3], &tempValues[4], &tempValues[5]);
-
-        // 마찬가지로 설정 파일을 읽는 과정에서 검증했기 때문에
-        // 또 검증하지는 않는다.
-        // 만일 파싱 과정에서 오류가 발생한다면 WolConfig::IsValidMacAddress() 함수를 보완해야 함
-        assert(scanResult == 6);
+        std::ignore = ::fwprintf(stderr, L"설정 파일을 읽는데 실패했습니다.\n\t%ls",
+                                 WakeOnLan::WolErrorCodeToString(errorCode).c_str());
 
-        // 변환
-        for (std::size_t i = 0U; i < macBytes.size(); ++i)
+        if (errorCode == WakeOnLan::WolErrorCode::FailedToReadMacAddress
+            || errorCode == WakeOnLan::WolErrorCode::FailedToReadBroadcastIp
+            || errorCode == WakeOnLan::WolErrorCode::FailedToReadPort)
         {
-            macBytes[i] = static_cast<std::byte>(tempValues[i]);
+            std::ignore = ::fwprintf(stderr, L"\t설정 파일이 UTF-8 인코딩이 아닌 경우 발생할 수 있습니다. UTF-8 파일만 지원합니다.");
         }
     }
 
-    inline void WakeOnLanSender::CreateMagicPacket(_In_ const MacAddress& macBytes,
-                                                   _Out_ MagicPacket& packet) const noexcept
+    /// @brief 인자를 지정한 경우의 실행 (입력을 기다리지 않음)
+    /// @return 종료 코드 (WolErrorCode 값)
+    int RunCommandLine(_In_ const CommandLineOptions& options)
     {
-        // 첫 6바이트를 0xFF로 설정
-        constexpr std::byte magicHeader = static_cast<std::byte>(0xFF);
-        constexpr std::size_t headerSize = 6;
-        constexpr std::size_t macRepeatCount = 16;
+        // 처음 전송과 --verify의 재전송이 같은 세션(같은 전송 속도 제한)을 사용
+        WakeOnLan::WakeOnLanSession session;
+        session.SetPacing(GetPacingPolicy(options));
+        session.SetSendBackend(options.mSendBackend);
+        session.SetSendThreads(GetSendThreads(options));
 
-        for (std::size_t i = 0U; i < headerSize; ++i)
+        if (options.mInterfaceNames.empty() == false)
         {
-            packet[i] = magicHeader;
+            std::vector<WakeOnLan::NetworkInterface> interfaces{};
+            const WakeOnLan::WolErrorCode interfaceResult = WakeOnLan::SelectNetworkInterfaces(options.mInterfaceNames, interfaces);
+            if (interfaceResult != WakeOnLan::WolErrorCode::Success)
+            {
+                if (options.mJson)
+                {
+                    PrintJson(interfaceResult, {}, false, nullptr, {}, {});
+                }
+                return static_cast<int>(interfaceResult);
+            }
+
+            session.SetInterfaces(interfaces);
         }
 
-        // MAC 주소를 16번 반복
-        for (std::size_t repeat = 0U; repeat < macRepeatCount; ++repeat)
+        std::vector<WakeResult> results{};
+        const bool configured = options.mMacAddress.empty();
+        WakeOnLan::WolErrorCode errorCode = configured ? WakeConfiguredTargets(options, session, results)
+                                                       : WakeAddress(options, session, results);
+
+        const bool verify = options.mVerifyMethod.has_value() && errorCode == WakeOnLan::WolErrorCode::Success;
+        if (verify)
         {
-            const std::size_t offset = headerSize + (repeat * macBytes.size());
-            for (std::size_t i = 0U; i < macBytes.size(); ++i)
-            {
-                packet[offset + i] = macBytes[i];
-            }
+            errorCode = VerifyTargets(options, session, results);
         }
-    }
 
-    inline WolErrorCode WakeOnLanSender::InitializeSocket(_Inout_ Socket& socket) const noexcept
-    {
-        // 소켓 생성
-        const SOCKET rawSocket = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        const WakeOnLan::WolErrorCode overallResult = GetOverallResult(errorCode, results);
+        const WakeOnLan::PacingStats* const pacingStats = session.GetPacing().IsEnabled() ? &session.GetPacingStats() : nullptr;
 
-        if (rawSocket == INVALID_SOCKET)
+        if (options.mJson)
         {
-            std::ignore = ::fwprintf(stderr, L"소켓 생성에 실패 했습니다.\n");
-            return WolErrorCode::SocketCreationFailed;
+            PrintJson(overallResult, results, verify, pacingStats, session.GetInterfaceStats(), session.GetWorkerStats());
         }
+        else if (options.mQuiet == false)
+        {
+            if (configured && results.empty())
+            {
+                PrintConfigError(errorCode);
+            }
+            else if (errorCode != WakeOnLan::WolErrorCode::Success)
+            {
+                std::ignore = ::fwprintf(stderr, verify ? L"대상 확인 결과: %ls" : L"WOL 패킷 전송 결과: %ls",
+                                         WakeOnLan::WolErrorCodeToString(errorCode).c_str());
+            }
+            else
+            {
+                PrintResultTable(results, verify);
+                if (pacingStats != nullptr)
+                {
+                    PrintPacingStats(*pacingStats);
+                }
 
-        // ICMP "port unreachable" 리셋 방지
-        bool bNewBehavior = FALSE;
-        DWORD dwBytesReturned = 0;
-        WSAIoctl(rawSocket, SIO_UDP_CONNRESET, &bNewBehavior, sizeof(bNewBehavior),
-                 nullptr, 0, &dwBytesReturned, nullptr, nullptr);
+                if (session.GetInterfaceStats().empty() == false)
+                {
+                    PrintInterfaceStats(session.GetInterfaceStats());
+                }
 
-        socket.Set(rawSocket);
-        return WolErrorCode::Success;
+                if (session.GetWorkerStats().size() > 1U)
+                {
+                    PrintWorkerStats(session.GetWorkerStats());
+                }
+            }
+        }
+
+        return static_cast<int>(overallResult);
     }
 
-    inline WolErrorCode WakeOnLanSender::SetupBroadcastAddress(_In_ const std::wstring_view broadcastAddress,
-                                                               _In_range_(1, 65535) const std::uint16_t port,
-                                                               _Out_ sockaddr_in& destAddr) const noexcept
+    /// @brief 인자 없이 실행한 경우의 기존 동작
+    /// @details 설정 파일의 모든 대상에게 전송하고 결과와 안내를 출력한 뒤 Enter 입력을 기다림
+    /// @return 종료 코드 (WolErrorCode 값)
+    int RunInteractive()
     {
-        // 설정 파일을 읽는 과정에서 설정 값(Mac Address, Broadcast Address, port)의 값이 유효한지
-        // 검증 했기 떄문에 여기서 또 검증하지 않는다. 간단히 assert로만 체크
-        assert(broadcastAddress.empty() == false);
-        assert(port != 0 && port < UINT16_MAX);
-
-        // 구조체 초기화
-        destAddr = {};
-        destAddr.sin_family = AF_INET;
-        destAddr.sin_port = htons(port);
+        const CommandLineOptions options{};
+        WakeOnLan::WakeOnLanSession session;
+        std::vector<WakeResult> results{};
+        WakeOnLan::WolErrorCode errorCode = WakeConfiguredTargets(options, session, results);
+        if (errorCode != WakeOnLan::WolErrorCode::Success && results.empty())
+        {
+            PrintConfigError(errorCode);
+            return static_cast<int>(errorCode);
+        }
 
-        // Wide char를 Multi-byte로 변환
-        const int sizeNeeded = WideCharToMultiByte(CP_ACP, 0, broadcastAddress.data(),
-                                                   static_cast<int>(broadcastAddress.size()), nullptr, 0, nullptr,
-                                                   nullptr);
-        std::string ipStr(sizeNeeded, 0);
-        const int conversionResult = WideCharToMultiByte(CP_ACP, 0, broadcastAddress.data(),
-                                                         static_cast<int>(broadcastAddress.size()), ipStr.data(),
-                                                         sizeNeeded, nullptr, nullptr);
+        std::ignore = ::fwprintf(stdout, L"=== Wake-on-LAN ===\n");
+        std::ignore = ::fwprintf(stdout, L"대상 수: %zu\n", results.size());
+        std::ignore = ::fwprintf(stdout, L"================================\n\n");
 
-        if (conversionResult == 0 || conversionResult != sizeNeeded)
+        if (errorCode != WakeOnLan::WolErrorCode::Success)
+        {
+            std::ignore = ::fwprintf(stdout, L"WOL 패킷 전송 결과: %ls\n", WakeOnLan::WolErrorCodeToString(errorCode).c_str());
+            std::ignore = ::fwprintf(stdout, L"패킷 전송에 실패했습니다.\n");
+        }
+        else
         {
-            std::ignore = ::fwprintf(stderr, L"broadcastAddress를 Multi-byte 문자열로 변환하는데 실패하였습니다: %.*ls\n",
-                                     static_cast<int>(broadcastAddress.size()), broadcastAddress.data());
-            return WolErrorCode::BroadcastSetupFailed;
+            PrintResultTable(results, false);
+            errorCode = GetOverallResult(errorCode, results);
         }
 
-        // IP 주소 변환
-        const int ptonResult = inet_pton(AF_INET, ipStr.c_str(), &destAddr.sin_addr);
-        if (ptonResult != 1)
+        if (errorCode == WakeOnLan::WolErrorCode::Success)
         {
-            std::ignore = ::fwprintf(stderr, L"broadcastAddress를 IP로 변환하는데 실패하였습니다: %.*ls\n",
-                                     static_cast<int>(broadcastAddress.size()), broadcastAddress.data());
-            return WolErrorCode::BroadcastSetupFailed;
+            std::ignore = ::fwprintf(stdout, L"매직 패킷이 성공적으로 전송되었습니다!\n");
+            std::ignore = ::fwprintf(stdout, L"대상 PC가 켜지지 않는다면 다음을 확인하세요:\n");
+            std::ignore = ::fwprintf(stdout, L"  1. 대상 PC의 BIOS에서 Wake-on-LAN 활성화\n");
+            std::ignore = ::fwprintf(stdout, L"  2. 네트워크 어댑터의 전원 관리 설정\n");
+            std::ignore = ::fwprintf(stdout, L"  3. 올바른 MAC 주소 및 브로드캐스트 IP\n");
+            std::ignore = ::fwprintf(stdout, L"  4. 방화벽/라우터 설정\n");
         }
 
-        return WolErrorCode::Success;
+        std::ignore = ::fwprintf(stdout, L"프로그램을 종료하려면 Enter를 누르세요...");
+
+        // Enter 키 대기
+        std::wstring buffer(10, L'\0');
+#ifdef _WIN32
+        _getws_s(buffer.data(), std::size(buffer));
+#else
+        std::ignore = std::fgetws(buffer.data(), static_cast<int>(buffer.size()), stdin);
+#endif
+
+        return static_cast<int>(errorCode);
     }
 }
 
-int main()
+#ifdef _WIN32
+int wmain(const int argc, wchar_t* argv[])
+#else
+int main(const int argc, char* argv[])
+#endif
 {
+#ifdef _WIN32
     std::ignore = _setmode(_fileno(stdout), _O_U16TEXT);
     std::ignore = _setmode(_fileno(stderr), _O_U16TEXT);
-
-    WakeOnLan::WolConfig config;
-    WakeOnLan::WolErrorCode errorCode = config.LoadFromIni();
-    if (errorCode != WakeOnLan::WolErrorCode::Success)
+#else
+    // 한글 출력을 위해 UTF-8 로케일 사용 (환경 로케일이 UTF-8이 아니라면 C.UTF-8 사용)
+    if (const char* const locale = std::setlocale(LC_ALL, "");
+        locale == nullptr || std::string_view{locale}.find("UTF-8") == std::string_view::npos)
     {
-        std::ignore = ::fwprintf(stderr, L"설정 파일을 읽는데 실패했습니다.\n\t%ls",
-                                 WakeOnLan::WolErrorCodeToString(errorCode).c_str());
-
-        if (errorCode == WakeOnLan::WolErrorCode::FailedToReadMacAddress
-            || errorCode == WakeOnLan::WolErrorCode::FailedToReadBroadcastIp
-            || errorCode == WakeOnLan::WolErrorCode::FailedToReadPort)
-        {
-            std::ignore = ::fwprintf(stderr, L"\t설정 파일이 UTF-8 인코딩이 아닌 경우 발생할 수 있습니다. UTF-8 파일만 지원합니다.");
-        }
-
-        return static_cast<int>(errorCode);
+        std::ignore = std::setlocale(LC_ALL, "C.UTF-8");
     }
+#endif
 
-    std::ignore = ::fwprintf(stdout, L"=== Wake-on-LAN ===\n");
-    std::ignore = ::fwprintf(stdout, L"대상 MAC: %ls\n", config.GetMacAddress().c_str());
-    std::ignore = ::fwprintf(stdout, L"브로드캐스트 IP: %ls\n", config.GetBroadcastIp().c_str());
-    std::ignore = ::fwprintf(stdout, L"포트: %d\n", config.GetPort());
-    std::ignore = ::fwprintf(stdout, L"================================\n\n");
+    // 인자 없이 실행하면 기존과 같이 동작 (결과 출력 후 Enter 입력 대기)
+    if (argc <= 1)
+    {
+        return RunInteractive();
+    }
 
-    const WakeOnLan::WakeOnLanSender wolSender{};
-    errorCode = wolSender.SendMagicPacket(config.GetMacAddress(), config.GetBroadcastIp(), config.GetPort());
+    // 명령줄 인자 (POSIX에서는 UTF-8로 간주)
+    std::vector<std::wstring> arguments{};
+    for (int i = 1; i < argc; ++i)
+    {
+#ifdef _WIN32
+        arguments.emplace_back(argv[i]);
+#else
+        arguments.push_back(WakeOnLan::Utf8ToWide(argv[i]));
+#endif
+    }
 
-    std::ignore = ::fwprintf(stdout, L"WOL 패킷 전송 결과: %ls\n", WakeOnLan::WolErrorCodeToString(errorCode).c_str());
+    CommandLineOptions options{};
+    if (ParseCommandLine(arguments, options) != WakeOnLan::WolErrorCode::Success)
+    {
+        PrintUsage(stderr);
+        return static_cast<int>(WakeOnLan::WolErrorCode::InvalidArgument);
+    }
 
-    if (errorCode == WakeOnLan::WolErrorCode::Success)
+    if (options.mHelp)
     {
-        std::ignore = ::fwprintf(stdout, L"매직 패킷이 성공적으로 전송되었습니다!\n");
-        std::ignore = ::fwprintf(stdout, L"대상 PC가 켜지지 않는다면 다음을 확인하세요:\n");
-        std::ignore = ::fwprintf(stdout, L"  1. 대상 PC의 BIOS에서 Wake-on-LAN 활성화\n");
-        std::ignore = ::fwprintf(stdout, L"  2. 네트워크 어댑터의 전원 관리 설정\n");
-        std::ignore = ::fwprintf(stdout, L"  3. 올바른 MAC 주소 및 브로드캐스트 IP\n");
-        std::ignore = ::fwprintf(stdout, L"  4. 방화벽/라우터 설정\n");
+        PrintUsage(stdout);
+        return static_cast<int>(WakeOnLan::WolErrorCode::Success);
     }
-    else
+
+#ifdef _WIN32
+    // 다른 프로그램이 읽는 JSON은 UTF-8로 출력 (콘솔용 UTF-16 대신)
+    if (options.mJson)
     {
-        std::ignore = ::fwprintf(stdout, L"패킷 전송에 실패했습니다.\n");
+        std::ignore = _setmode(_fileno(stdout), _O_U8TEXT);
     }
+#endif
 
-    std::ignore = ::fwprintf(stdout, L"프로그램을 종료하려면 Enter를 누르세요...");
+    if (options.mDaemon)
+    {
+        return RunDaemon(options);
+    }
 
-    // Enter 키 대기
-    std::wstring buffer(10, L'\0');
-    _getws_s(buffer.data(), std::size(buffer));
+    if (options.mClient)
+    {
+        return RunClient(options);
+    }
 
-    return static_cast<int>(errorCode);
+    return RunCommandLine(options);
 }
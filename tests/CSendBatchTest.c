@@ -0,0 +1,264 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief C 인터페이스 루프백 전송 테스트
+///
+/// @details
+/// WakeOnLanC.h만 포함한 C 프로그램에서 wol_send_batch()로 127.0.0.1에 바인딩한 UDP 소켓에 매직 패킷을 보내고,
+/// 받은 데이터그램이 0xFF 6바이트 뒤에 MAC 주소를 16번 반복한 102바이트인지 확인
+///
+/// - wol_destination의 24바이트 배치(필드 위치)를 C 컴파일러에서 확인
+/// - 모든 대상이 주소 하나를 공유하는 호출과 대상마다 주소를 넘기는 호출을 모두 확인
+/// - 잘못된 인자는 전송하지 않고 오류 코드를 반환하는지 확인
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 표준 C(-std=c11)에서 POSIX 소켓 함수(poll(), close() 등)를 선언하도록 지정
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "WakeOnLanC.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <WinSock2.h>
+#include <WS2tcpip.h>
+typedef SOCKET socket_handle;
+#define INVALID_SOCKET_HANDLE INVALID_SOCKET
+#define close_socket closesocket
+#define poll_sockets WSAPoll
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+typedef int socket_handle;
+#define INVALID_SOCKET_HANDLE (-1)
+#define close_socket close
+#define poll_sockets poll
+#endif
+
+/// @brief ctest가 건너뛴 테스트로 처리하는 종료 코드
+#define SKIP_EXIT_CODE 77
+
+/// @brief 수신을 기다리는 최대 시간 (밀리초)
+#define RECEIVE_TIMEOUT_MS 2000
+
+/// @brief 한 번에 보낼 대상 수
+#define TARGET_COUNT 4U
+
+// 바인딩이 구조체 배열을 그대로 넘기므로 C 컴파일러에서도 크기와 필드 위치가 같아야 함
+_Static_assert(sizeof(wol_destination) == 24U, "wol_destination 크기가 24바이트가 아님");
+_Static_assert(offsetof(wol_destination, address) == 0U, "address 위치가 달라짐");
+_Static_assert(offsetof(wol_destination, scope_id) == 16U, "scope_id 위치가 달라짐");
+_Static_assert(offsetof(wol_destination, port) == 20U, "port 위치가 달라짐");
+_Static_assert(offsetof(wol_destination, family) == 22U, "family 위치가 달라짐");
+_Static_assert(offsetof(wol_destination, reserved) == 23U, "reserved 위치가 달라짐");
+
+/// @brief 실패한 검사 수
+static int sFailureCount = 0;
+
+/// @brief 조건이 거짓이면 실패로 기록하고 설명을 출력
+static void Check(const int condition, const char* const description)
+{
+    if (condition)
+        return;
+
+    ++sFailureCount;
+    (void)fprintf(stderr, "실패: %s\n", description);
+}
+
+/// @brief 대상 번호로 MAC 주소를 만듦 (패킷마다 내용이 달라 섞이거나 중복되면 알 수 있음)
+static void MakeMacAddress(const size_t index, uint8_t* const mac)
+{
+    const uint8_t prefix[4] = {0x02U, 0x00U, 0x5EU, 0x10U};
+    memcpy(mac, prefix, sizeof(prefix));
+    mac[4] = 0xC0U;
+    mac[5] = (uint8_t)index;
+}
+
+/// @brief 127.0.0.1의 wol_destination을 만듦
+static wol_destination MakeLoopbackDestination(const uint16_t port)
+{
+    wol_destination destination;
+    memset(&destination, 0, sizeof(destination));
+    destination.address[0] = 127U;
+    destination.address[3] = 1U;
+    destination.port = port;
+    destination.family = WOL_FAMILY_IPV4;
+    return destination;
+}
+
+/// @brief 데이터그램 하나를 받음
+/// @return 받은 데이터의 길이, 제한 시간 안에 받지 못했거나 실패한 경우 -1
+static int ReceiveDatagram(const socket_handle socket, uint8_t* const buffer, const size_t size)
+{
+#ifdef _WIN32
+    WSAPOLLFD descriptor;
+#else
+    struct pollfd descriptor;
+#endif
+    memset(&descriptor, 0, sizeof(descriptor));
+    descriptor.fd = socket;
+    descriptor.events = POLLIN;
+    if (poll_sockets(&descriptor, 1U, RECEIVE_TIMEOUT_MS) <= 0)
+        return -1;
+
+    return (int)recv(socket, (char*)buffer, (int)size, 0);
+}
+
+/// @brief 다음 데이터그램이 MAC 주소의 102바이트 매직 패킷인지 확인
+static void ExpectMagicPacket(const socket_handle socket, const uint8_t* const mac, const char* const description)
+{
+    uint8_t buffer[512];
+    const int received = ReceiveDatagram(socket, buffer, sizeof(buffer));
+    Check(received == 102, description);
+    if (received != 102)
+        return;
+
+    int matches = 1;
+    for (size_t i = 0U; i < 6U; ++i)
+        matches = matches && buffer[i] == 0xFFU;
+
+    for (size_t i = 0U; i < 16U; ++i)
+        matches = matches && memcmp(buffer + 6U + (i * 6U), mac, 6U) == 0;
+
+    Check(matches, description);
+}
+
+/// @brief 127.0.0.1의 임의 포트에 바인딩한 UDP 소켓을 만듦
+/// @return 성공한 경우 소켓, 실패한 경우 INVALID_SOCKET_HANDLE
+static socket_handle OpenReceiver(uint16_t* const port)
+{
+    const socket_handle receiver = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (receiver == INVALID_SOCKET_HANDLE)
+        return INVALID_SOCKET_HANDLE;
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addressLength = sizeof(address);
+    if (bind(receiver, (const struct sockaddr*)&address, sizeof(address)) != 0
+        || getsockname(receiver, (struct sockaddr*)&address, &addressLength) != 0)
+    {
+        (void)close_socket(receiver);
+        return INVALID_SOCKET_HANDLE;
+    }
+
+    *port = ntohs(address.sin_port);
+    return receiver;
+}
+
+/// @brief 모든 대상이 주소 하나를 공유하는 호출 (destination_count == 1)
+static void TestSharedDestination(wol_session* const session, const socket_handle receiver, const uint16_t port)
+{
+    uint8_t macs[TARGET_COUNT * 6U];
+    for (size_t i = 0U; i < TARGET_COUNT; ++i)
+        MakeMacAddress(i, macs + (i * 6U));
+
+    const wol_destination destination = MakeLoopbackDestination(port);
+    uint8_t results[TARGET_COUNT];
+    memset(results, 0xAA, sizeof(results));
+    Check(wol_send_batch(session, macs, &destination, 1U, TARGET_COUNT, results) == WOL_SUCCESS, "공유 주소: 반환 값");
+    for (size_t i = 0U; i < TARGET_COUNT; ++i)
+        Check(results[i] == WOL_SUCCESS, "공유 주소: 대상별 결과");
+
+    for (size_t i = 0U; i < TARGET_COUNT; ++i)
+        ExpectMagicPacket(receiver, macs + (i * 6U), "공유 주소: 수신한 매직 패킷");
+}
+
+/// @brief 대상마다 주소를 넘기는 호출 (destination_count == count, 결과 출력 생략)
+static void TestPerTargetDestinations(wol_session* const session, const socket_handle receiver, const uint16_t port)
+{
+    uint8_t macs[TARGET_COUNT * 6U];
+    wol_destination destinations[TARGET_COUNT];
+    for (size_t i = 0U; i < TARGET_COUNT; ++i)
+    {
+        MakeMacAddress(0x80U + i, macs + (i * 6U));
+        destinations[i] = MakeLoopbackDestination(port);
+    }
+
+    Check(wol_send_batch(session, macs, destinations, TARGET_COUNT, TARGET_COUNT, NULL) == WOL_SUCCESS, "대상별 주소: 반환 값");
+    for (size_t i = 0U; i < TARGET_COUNT; ++i)
+        ExpectMagicPacket(receiver, macs + (i * 6U), "대상별 주소: 수신한 매직 패킷");
+}
+
+/// @brief 잘못된 인자는 어떤 대상에게도 보내지 않고 오류 코드를 반환
+static void TestInvalidArguments(wol_session* const session, const socket_handle receiver, const uint16_t port)
+{
+    uint8_t macs[2U * 6U];
+    MakeMacAddress(0xF0U, macs);
+    MakeMacAddress(0xF1U, macs + 6U);
+
+    wol_destination destinations[2];
+    destinations[0] = MakeLoopbackDestination(port);
+    destinations[1] = MakeLoopbackDestination(0U);
+    Check(wol_send_batch(session, macs, destinations, 2U, 2U, NULL) == WOL_INVALID_PORT, "포트 0");
+
+    // IPv6는 멀티캐스트 주소(ff00::/8)만 허용
+    destinations[1] = MakeLoopbackDestination(port);
+    destinations[1].family = WOL_FAMILY_IPV6;
+    Check(wol_send_batch(session, macs, destinations, 2U, 2U, NULL) == WOL_INVALID_BROADCAST_IP, "IPv6 유니캐스트 주소");
+
+    destinations[1].family = 5U;
+    Check(wol_send_batch(session, macs, destinations, 2U, 2U, NULL) == WOL_INVALID_BROADCAST_IP, "알 수 없는 주소 계열");
+
+    Check(wol_send_batch(session, macs, destinations, 3U, 2U, NULL) == WOL_INVALID_ARGUMENT, "주소 수가 1도 count도 아님");
+    Check(wol_send_batch(NULL, macs, destinations, 1U, 1U, NULL) == WOL_INVALID_ARGUMENT, "세션 없음");
+    Check(wol_send_batch(session, NULL, destinations, 1U, 1U, NULL) == WOL_INVALID_ARGUMENT, "MAC 주소 없음");
+    Check(wol_send_batch(session, NULL, NULL, 1U, 0U, NULL) == WOL_SUCCESS, "대상 없음");
+
+    // 앞의 호출이 하나도 보내지 않았다면 다음 데이터그램은 이 패킷
+    Check(wol_send_batch(session, macs, destinations, 1U, 1U, NULL) == WOL_SUCCESS, "잘못된 인자 뒤의 전송");
+    ExpectMagicPacket(receiver, macs, "잘못된 인자로는 전송하지 않음");
+}
+
+int main(void)
+{
+#ifdef _WIN32
+    WSADATA wsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0)
+        return SKIP_EXIT_CODE;
+#endif
+
+    uint16_t port = 0U;
+    const socket_handle receiver = OpenReceiver(&port);
+    if (receiver == INVALID_SOCKET_HANDLE)
+    {
+        (void)fprintf(stderr, "127.0.0.1에 바인딩할 수 없어 테스트를 건너뜁니다.\n");
+        return SKIP_EXIT_CODE;
+    }
+
+    wol_session* session = NULL;
+    Check(wol_session_open(NULL) == WOL_INVALID_ARGUMENT, "세션 출력 없음");
+    const int openResult = wol_session_open(&session);
+    Check(openResult == WOL_SUCCESS && session != NULL, "세션 열기");
+    if (openResult == WOL_SUCCESS)
+    {
+        TestSharedDestination(session, receiver, port);
+        TestPerTargetDestinations(session, receiver, port);
+        TestInvalidArguments(session, receiver, port);
+    }
+
+    wol_session_close(session);
+    wol_session_close(NULL);
+    (void)close_socket(receiver);
+
+#ifdef _WIN32
+    (void)WSACleanup();
+#endif
+    return sFailureCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief IPv6 멀티캐스트 루프백 전송 테스트
+///
+/// @details
+/// 루프백 인터페이스에서 ff02::1 그룹에 가입한 UDP 소켓에 "ff02::1%lo"로 매직 패킷을 보내고,
+/// 받은 데이터그램이 102바이트 매직 패킷인지 확인
+///
+/// - 설정 파일과 같은 경로(ParseIpv6Multicast(), ResolveScopeId(), WakeOnLanSender::SetupDestination())로 주소를 만듦
+/// - lo로 멀티캐스트를 받을 수 없는 환경(lo에 MULTICAST 플래그나 경로가 없는 경우가 많음)에서는 켜져 있는 다른 인터페이스의
+///   "ff02::1%이름"으로 보내고 같은 호스트로 되돌아오는 사본(IPV6_MULTICAST_LOOP)을 받음
+/// - 받을 수 있는 인터페이스가 없으면 건너뜀
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "TestSupport.h"
+
+namespace
+{
+    using WakeOnLan::WolErrorCode;
+    using WakeOnLanTest::Check;
+
+    /// @brief 전송할 그룹 (모든 노드 그룹, 범위는 인터페이스 이름)
+    constexpr std::wstring_view MULTICAST_GROUP{L"ff02::1%"};
+
+    /// @brief 먼저 사용할 인터페이스 (루프백)
+    constexpr std::wstring_view LOOPBACK_INTERFACE{L"lo"};
+
+    /// @brief 인터페이스 하나의 그룹에 가입하고 그 그룹으로 보낸 데이터그램을 받을 수 있는지 확인
+    /// @param interfaceName 인터페이스 이름
+    /// @param receiver 그룹에 가입할 수신 소켓
+    /// @param destAddr 전송할 주소 출력 (수신 소켓의 포트)
+    /// @return 1바이트 확인 데이터그램을 받은 경우 true
+    /// @details 컨테이너의 lo처럼 MULTICAST 플래그나 경로가 없으면 전송이 실패하거나(ENETUNREACH) 수신되지 않음
+    [[nodiscard]] bool PrepareMulticast(const std::wstring& interfaceName, WakeOnLanTest::LoopbackReceiver& receiver,
+                                        WakeOnLan::DestinationAddress& destAddr) noexcept
+    {
+        // 설정 파일의 BroadcastIp와 같은 방법으로 변환
+        std::wstring text{};
+        try
+        {
+            text = std::wstring{MULTICAST_GROUP} + interfaceName;
+        }
+        catch (...)
+        {
+            return false;
+        }
+
+        WakeOnLan::Ipv6Multicast multicast{};
+        std::wstring_view scope{};
+        if (WakeOnLan::ParseIpv6Multicast(text, multicast.mGroup, scope) == false
+            || WakeOnLan::ResolveScopeId(scope, multicast.mScopeId) == false
+            || receiver.OpenIpv6Multicast(multicast.mGroup, multicast.mScopeId) == false)
+        {
+            return false;
+        }
+
+        const WakeOnLan::WakeOnLanSender sender{};
+        sender.SetupDestination(in_addr{}, multicast, receiver.GetPort(), destAddr);
+        Check(WakeOnLan::IsIpv6Destination(destAddr) && destAddr.mIpv6.sin6_scope_id == multicast.mScopeId, L"전송 주소");
+
+        const WakeOnLan::Socket socket(::socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP));
+        constexpr char probe = 0;
+        if (socket.Get() == WakeOnLan::INVALID_SOCKET_HANDLE
+            || ::sendto(socket.Get(), &probe, 1, 0, reinterpret_cast<const sockaddr*>(&destAddr.mIpv6), sizeof(destAddr.mIpv6)) != 1)
+        {
+            return false;
+        }
+
+        std::array<std::byte, 512U> buffer{};
+        return receiver.Receive(buffer.data(), buffer.size()) == 1;
+    }
+}
+
+int main()
+{
+    WakeOnLan::WsaGuard wsaGuard;
+    if (wsaGuard.Initialize() != WolErrorCode::Success)
+    {
+        std::ignore = ::fwprintf(stderr, L"WinSock을 초기화할 수 없어 테스트를 건너뜁니다.\n");
+        return WakeOnLanTest::SKIP_EXIT_CODE;
+    }
+
+    // lo를 먼저 사용하고, 멀티캐스트를 받을 수 없으면 켜져 있는 다른 인터페이스로 보냄 (같은 호스트로 되돌아오는 사본을 받음)
+    std::vector<std::wstring> candidates{};
+    std::vector<WakeOnLan::NetworkInterface> interfaces{};
+    try
+    {
+        candidates.emplace_back(LOOPBACK_INTERFACE);
+        if (WakeOnLan::GetNetworkInterfaces(interfaces) == WolErrorCode::Success)
+        {
+            for (const WakeOnLan::NetworkInterface& networkInterface : interfaces)
+            {
+                if (std::find(candidates.begin(), candidates.end(), networkInterface.mName) == candidates.end())
+                    candidates.push_back(networkInterface.mName);
+            }
+        }
+    }
+    catch (...)
+    {
+        Check(false, L"인터페이스 목록 할당");
+        return WakeOnLanTest::GetExitCode();
+    }
+
+    WakeOnLanTest::LoopbackReceiver receiver;
+    WakeOnLan::DestinationAddress destAddr{};
+    const auto usable = std::find_if(candidates.begin(), candidates.end(), [&](const std::wstring& interfaceName)
+                                     { return PrepareMulticast(interfaceName, receiver, destAddr); });
+    if (usable == candidates.end())
+    {
+        std::ignore = ::fwprintf(stderr, L"IPv6 멀티캐스트를 받을 수 있는 인터페이스가 없어 테스트를 건너뜁니다. (lo의 MULTICAST 플래그 확인)\n");
+        return WakeOnLanTest::SKIP_EXIT_CODE;
+    }
+
+    std::ignore = ::fwprintf(stdout, L"%ls%ls로 전송합니다.\n", MULTICAST_GROUP.data(), usable->c_str());
+
+    WakeOnLan::WakeOnLanSession session;
+    Check(session.Open() == WolErrorCode::Success, L"세션 열기");
+
+    const WakeOnLan::MacAddress macAddress{std::byte{0x02}, std::byte{0x00}, std::byte{0x5E},
+                                           std::byte{0x10}, std::byte{0x66}, std::byte{0x01}};
+    Check(session.Send(macAddress, destAddr) == WolErrorCode::Success, L"전송 결과");
+
+    std::array<std::byte, 512U> buffer{};
+    const int received = receiver.Receive(buffer.data(), buffer.size());
+    Check(received == 102, L"수신한 데이터그램 크기");
+    Check(received > 0 && WakeOnLanTest::IsMagicPacket(buffer.data(), static_cast<std::size_t>(received), macAddress),
+          L"수신한 매직 패킷");
+
+    return WakeOnLanTest::GetExitCode();
+}
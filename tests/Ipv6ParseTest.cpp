@@ -0,0 +1,155 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief IPv6 멀티캐스트 주소 변환 테스트
+///
+/// @details
+/// ParseIpv6Address(), ParseIpv6Multicast(), ResolveScopeId()와 설정 파일의 BroadcastIp 검증을
+/// 실행 시점의 입력(상수 식이 아닌 값)으로 확인
+///
+/// - 잘못된 입력: "::" 두 번, 4자리를 넘는 그룹, 그룹 수 초과/부족, 빈 범위, 없는 인터페이스 이름의 범위
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "TestSupport.h"
+
+namespace
+{
+    using WakeOnLan::Ipv6Address;
+    using WakeOnLan::WolErrorCode;
+    using WakeOnLanTest::Check;
+
+    /// @brief 변환에 성공해야 하는 주소와 기대하는 바이트
+    struct ValidCase final
+    {
+        /// @brief 입력 문자열
+        const wchar_t* mText;
+
+        /// @brief 기대하는 주소
+        Ipv6Address mAddress;
+    };
+
+    /// @brief 변환에 성공해야 하는 주소
+    const std::array<ValidCase, 5U> VALID_CASES{{
+        {L"ff02::1", {0xFF, 0x02, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01}},
+        {L"FF05:0:0:0:0:0:1:3", {0xFF, 0x05, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01, 0, 0x03}},
+        {L"::", {}},
+        {L"ff02::1:ff00:1234", {0xFF, 0x02, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01, 0xFF, 0x00, 0x12, 0x34}},
+        {L"1:2:3:4:5:6::8", {0, 0x01, 0, 0x02, 0, 0x03, 0, 0x04, 0, 0x05, 0, 0x06, 0, 0, 0, 0x08}},
+    }};
+
+    /// @brief 변환에 실패해야 하는 주소
+    const std::array<const wchar_t*, 19U> INVALID_CASES{{
+        L"ff02::1::2",           // "::" 두 번
+        L"::1::",                // "::" 두 번 (끝)
+        L"ff02:::1",             // 콜론 세 개
+        L":::",                  // 콜론 세 개
+        L"ff02::10000",          // 그룹이 4자리를 넘음 (0xFFFF 초과)
+        L"fffff::1",             // 첫 그룹이 4자리를 넘음
+        L"ff02::00001",          // 앞의 0을 포함해도 4자리를 넘으면 거부
+        L"1:2:3:4:5:6:7:8:9",    // 그룹 9개
+        L"1:2:3:4:5:6:7::8",     // "::"가 있는데 그룹 8개
+        L"1:2:3:4:5:6:7",        // "::" 없이 그룹 7개
+        L"ff02::1:",             // 끝이 콜론 하나
+        L":ff02::1",             // 시작이 콜론 하나
+        L"ff02::g",              // 16진수가 아닌 문자
+        L"ff02:: 1",             // 공백
+        L"ff02::1.2.3.4",        // IPv4 표기
+        L"",                     // 빈 문자열
+        L":",                    // 콜론 하나
+        L"ff02::-1",             // 부호
+        L"ff02::1%lo",           // 범위는 ParseIpv6Multicast()에서만 허용
+    }};
+
+    /// @brief ParseIpv6Address()로 올바른 주소와 잘못된 주소를 변환
+    void TestParseIpv6Address() noexcept
+    {
+        for (const ValidCase& validCase : VALID_CASES)
+        {
+            Ipv6Address address{};
+            Check(WakeOnLan::ParseIpv6Address(validCase.mText, address) && address == validCase.mAddress, validCase.mText);
+        }
+
+        for (const wchar_t* const text : INVALID_CASES)
+        {
+            // 실패하면 주소는 모두 0이어야 함 (이전 값이나 일부만 변환된 값이 남지 않음)
+            Ipv6Address address{};
+            address.fill(0xAAU);
+            Check(WakeOnLan::ParseIpv6Address(text, address) == false && address == Ipv6Address{}, text);
+        }
+    }
+
+    /// @brief ParseIpv6Multicast()로 멀티캐스트 여부와 범위를 확인
+    void TestParseIpv6Multicast() noexcept
+    {
+        Ipv6Address group{};
+        std::wstring_view scope{};
+        Check(WakeOnLan::ParseIpv6Multicast(L"ff02::1%lo", group, scope) && group[0] == 0xFFU && group[15] == 0x01U
+                  && scope == L"lo",
+              L"ff02::1%lo");
+        Check(WakeOnLan::ParseIpv6Multicast(L"ff05::1:3", group, scope) && scope.empty(), L"ff05::1:3 (범위 없음)");
+
+        const std::array<const wchar_t*, 6U> invalid{{L"ff02::1%", L"fe80::1%lo", L"::1", L"ff02::1::2%lo", L"ff02::10000%lo", L"%lo"}};
+        for (const wchar_t* const text : invalid)
+        {
+            scope = L"x";
+            Check(WakeOnLan::ParseIpv6Multicast(text, group, scope) == false && group == Ipv6Address{} && scope.empty(), text);
+        }
+    }
+
+    /// @brief ResolveScopeId()로 번호와 인터페이스 이름을 변환
+    void TestResolveScopeId() noexcept
+    {
+        std::uint32_t scopeId = 1U;
+        Check(WakeOnLan::ResolveScopeId(L"", scopeId) && scopeId == 0U, L"빈 범위는 0");
+        Check(WakeOnLan::ResolveScopeId(L"12", scopeId) && scopeId == 12U, L"번호 범위");
+        Check(WakeOnLan::ResolveScopeId(L"4294967295", scopeId) && scopeId == UINT32_MAX, L"가장 큰 번호 범위");
+        Check(WakeOnLan::ResolveScopeId(L"4294967296", scopeId) == false && scopeId == 0U, L"32비트를 넘는 번호 범위");
+        Check(WakeOnLan::ResolveScopeId(L"wol-no-such-if0", scopeId) == false && scopeId == 0U, L"없는 인터페이스 이름");
+    }
+
+    /// @brief 설정 파일의 BroadcastIp가 잘못된 IPv6 주소이면 로드에 실패하는지 확인
+    void TestConfigRejectsInvalidIpv6() noexcept
+    {
+        const std::array<const char*, 3U> broadcastIps{{"ff02::1::2", "ff02::10000%lo", "ff02::1%wol-no-such-if0"}};
+        std::error_code errorCode{};
+        const std::filesystem::path path = std::filesystem::temp_directory_path(errorCode) / "WakeOnLanIpv6ParseTest.ini";
+        if (errorCode)
+        {
+            Check(false, L"임시 폴더");
+            return;
+        }
+
+        for (const char* const broadcastIp : broadcastIps)
+        {
+            {
+                std::ofstream file{path, std::ios::binary | std::ios::trunc};
+                file << "[Target.Ipv6]\nMacAddress=02-00-5E-10-00-01\nBroadcastIp=" << broadcastIp << "\nPort=9\n";
+            }
+
+            WakeOnLan::WolConfig config;
+            config.SetConfigFilePath(path.wstring());
+            Check(config.LoadFromIni() == WolErrorCode::InvalidBroadcastIp && config.GetSnapshot() == nullptr,
+                  L"설정 파일의 잘못된 IPv6 BroadcastIp");
+        }
+
+        std::ignore = std::filesystem::remove(path, errorCode);
+    }
+}
+
+int main()
+{
+    TestParseIpv6Address();
+    TestParseIpv6Multicast();
+    TestResolveScopeId();
+    TestConfigRejectsInvalidIpv6();
+
+    return WakeOnLanTest::GetExitCode();
+}
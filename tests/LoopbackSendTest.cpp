@@ -0,0 +1,133 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief 매직 패킷 루프백 전송 테스트
+///
+/// @details
+/// WakeOnLanSession으로 127.0.0.1에 바인딩한 UDP 소켓에 매직 패킷을 보내고,
+/// 받은 데이터그램이 0xFF 6바이트 뒤에 MAC 주소를 16번 반복한 102바이트인지 확인
+///
+/// - Send()와 SendBatch()를 모두 확인하며, SendBatch()는 소켓 API와 io_uring(사용할 수 없으면 소켓 API로 대체) 방식으로 각각 전송
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "TestSupport.h"
+
+namespace
+{
+    using WakeOnLan::MacAddress;
+    using WakeOnLan::WolErrorCode;
+    using WakeOnLanTest::Check;
+
+    /// @brief 일괄 전송할 패킷 수
+    constexpr std::size_t BATCH_COUNT{8U};
+
+    /// @brief 루프백 주소와 포트로 전송 주소를 만듦
+    [[nodiscard]] WakeOnLan::DestinationAddress MakeLoopbackDestination(const std::uint16_t port) noexcept
+    {
+        WakeOnLan::DestinationAddress destAddr{};
+        destAddr.mIpv4.sin_family = AF_INET;
+        destAddr.mIpv4.sin_port = htons(port);
+        destAddr.mIpv4.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        return destAddr;
+    }
+
+    /// @brief 순서대로 번호를 붙인 MAC 주소를 만듦 (패킷마다 내용이 달라 섞이거나 중복되면 알 수 있음)
+    [[nodiscard]] MacAddress MakeMacAddress(const std::size_t index) noexcept
+    {
+        return {std::byte{0x02}, std::byte{0x00}, std::byte{0x5E}, std::byte{0x10},
+                static_cast<std::byte>(index >> 8U), static_cast<std::byte>(index & 0xFFU)};
+    }
+
+    /// @brief 다음 데이터그램이 MAC 주소의 매직 패킷인지 확인
+    void ExpectMagicPacket(WakeOnLanTest::LoopbackReceiver& receiver, const MacAddress& macAddress,
+                           const wchar_t* const description) noexcept
+    {
+        std::array<std::byte, 512U> buffer{};
+        const int received = receiver.Receive(buffer.data(), buffer.size());
+        Check(received == 102, description);
+        Check(received > 0 && WakeOnLanTest::IsMagicPacket(buffer.data(), static_cast<std::size_t>(received), macAddress),
+              description);
+    }
+
+    /// @brief Send()로 패킷 하나를 보내고 확인
+    void TestSend(WakeOnLanTest::LoopbackReceiver& receiver) noexcept
+    {
+        WakeOnLan::WakeOnLanSession session;
+        Check(session.Open() == WolErrorCode::Success, L"Send: 세션 열기");
+
+        const MacAddress macAddress = MakeMacAddress(0xABCDU);
+        Check(session.Send(macAddress, MakeLoopbackDestination(receiver.GetPort())) == WolErrorCode::Success,
+              L"Send: 전송 결과");
+        ExpectMagicPacket(receiver, macAddress, L"Send: 수신한 매직 패킷");
+    }
+
+    /// @brief SendBatch()로 패킷 여러 개를 보내고 순서대로 확인
+    void TestSendBatch(WakeOnLanTest::LoopbackReceiver& receiver, const WakeOnLan::SendBackend backend) noexcept
+    {
+        WakeOnLan::WakeOnLanSession session;
+        session.SetSendBackend(backend);
+        Check(session.Open() == WolErrorCode::Success, L"SendBatch: 세션 열기");
+
+        std::vector<WakeOnLan::WolPacket> packets{};
+        std::vector<WolErrorCode> results{};
+        try
+        {
+            packets.resize(BATCH_COUNT);
+        }
+        catch (...)
+        {
+            Check(false, L"SendBatch: 패킷 목록 할당");
+            return;
+        }
+
+        for (std::size_t i = 0U; i < BATCH_COUNT; ++i)
+        {
+            WakeOnLan::CreateMagicPacket(MakeMacAddress(i), packets[i].mPacket);
+            packets[i].mDestAddr = MakeLoopbackDestination(receiver.GetPort());
+        }
+
+        Check(session.SendBatch(packets, results) == WolErrorCode::Success, L"SendBatch: 전송 결과");
+        Check(results.size() == BATCH_COUNT, L"SendBatch: 결과 수");
+        for (std::size_t i = 0U; i < results.size(); ++i)
+        {
+            Check(results[i] == WolErrorCode::Success, L"SendBatch: 패킷별 전송 결과");
+        }
+
+        // 루프백에서는 보낸 순서대로 도착
+        for (std::size_t i = 0U; i < BATCH_COUNT; ++i)
+        {
+            ExpectMagicPacket(receiver, MakeMacAddress(i), L"SendBatch: 수신한 매직 패킷");
+        }
+    }
+}
+
+int main()
+{
+    WakeOnLan::WsaGuard wsaGuard;
+    if (wsaGuard.Initialize() != WolErrorCode::Success)
+    {
+        std::ignore = ::fwprintf(stderr, L"WinSock을 초기화할 수 없어 테스트를 건너뜁니다.\n");
+        return WakeOnLanTest::SKIP_EXIT_CODE;
+    }
+
+    WakeOnLanTest::LoopbackReceiver receiver;
+    if (receiver.OpenIpv4() == false)
+    {
+        std::ignore = ::fwprintf(stderr, L"127.0.0.1에 바인딩할 수 없어 테스트를 건너뜁니다.\n");
+        return WakeOnLanTest::SKIP_EXIT_CODE;
+    }
+
+    TestSend(receiver);
+    TestSendBatch(receiver, WakeOnLan::SendBackend::Socket);
+    TestSendBatch(receiver, WakeOnLan::SendBackend::IoUring);
+
+    return WakeOnLanTest::GetExitCode();
+}
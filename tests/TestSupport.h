@@ -0,0 +1,191 @@
+﻿////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief 테스트 공용 함수
+///
+/// @details
+/// 테스트 프로그램(ctest)이 함께 사용하는 검사 함수와 루프백 수신 소켓
+///
+/// - 테스트 프로그램은 실패한 검사가 있으면 1, 모두 통과하면 0, 실행 환경에서 검사할 수 없으면 SKIP_EXIT_CODE로 종료
+///
+/// @author Oh Sungsik <ohsungsik@outlook.com>
+/// @version 1.0
+/// @date 2025-05-30
+///
+/// @license
+/// This code is released under the MIT License.
+/// You are free to use, modify, and distribute it with attribution.
+///
+/// SPDX-License-Identifier: MIT
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "WakeOnLan.h"
+
+namespace WakeOnLanTest
+{
+    /// @brief ctest가 건너뛴 테스트로 처리하는 종료 코드 (SKIP_RETURN_CODE 속성과 같은 값)
+    inline constexpr int SKIP_EXIT_CODE{77};
+
+    /// @brief 수신을 기다리는 최대 시간
+    inline constexpr std::chrono::milliseconds RECEIVE_TIMEOUT{2000};
+
+    /// @brief 실패한 검사 수
+    inline int sFailureCount{0};
+
+    /// @brief 조건이 거짓이면 실패로 기록하고 설명을 출력
+    /// @param condition 검사 결과
+    /// @param description 검사 내용
+    inline void Check(const bool condition, const wchar_t* const description) noexcept
+    {
+        if (condition)
+            return;
+
+        ++sFailureCount;
+        std::ignore = ::fwprintf(stderr, L"실패: %ls\n", description);
+    }
+
+    /// @brief 검사 결과로 테스트 프로그램의 종료 코드를 반환
+    [[nodiscard]] inline int GetExitCode() noexcept
+    {
+        return sFailureCount == 0 ? 0 : 1;
+    }
+
+    /// @brief 수신한 데이터가 MAC 주소의 매직 패킷인지 확인
+    /// @param data 수신한 데이터
+    /// @param length 수신한 데이터의 길이
+    /// @param macAddress 대상 장치의 MAC 주소
+    /// @return 0xFF 6바이트 뒤에 MAC 주소를 16번 반복한 102바이트이면 true
+    [[nodiscard]] inline bool IsMagicPacket(const std::byte* const data, const std::size_t length,
+                                            const WakeOnLan::MacAddress& macAddress) noexcept
+    {
+        if (length != 102U)
+            return false;
+
+        for (std::size_t i = 0U; i < 6U; ++i)
+        {
+            if (data[i] != std::byte{0xFF})
+                return false;
+        }
+
+        for (std::size_t i = 0U; i < 16U; ++i)
+        {
+            if (std::memcmp(data + 6U + (i * macAddress.size()), macAddress.data(), macAddress.size()) != 0)
+                return false;
+        }
+
+        return true;
+    }
+
+    /// @brief 루프백 주소(또는 루프백 인터페이스의 IPv6 멀티캐스트 그룹)의 임의 포트에서 데이터그램을 받는 UDP 소켓
+    /// @pre WinSock이 초기화되어 있어야 함 (WakeOnLan::WsaGuard)
+    class LoopbackReceiver final
+    {
+    public:
+        /// @brief 기본 생성자
+        LoopbackReceiver() noexcept = default;
+
+        /// @brief 복사 생성자 - 사용하지 않음
+        LoopbackReceiver(const LoopbackReceiver& other) = delete;
+
+        /// @brief 이동 생성자 - 사용하지 않음
+        LoopbackReceiver(LoopbackReceiver&& other) noexcept = delete;
+
+        /// @brief 복사 대입 연산자 - 사용하지 않음
+        LoopbackReceiver& operator=(const LoopbackReceiver& other) = delete;
+
+        /// @brief 이동 대입 연산자 - 사용하지 않음
+        LoopbackReceiver& operator=(LoopbackReceiver&& other) noexcept = delete;
+
+        /// @brief 소멸자 - 기본 소멸자 사용
+        ~LoopbackReceiver() noexcept = default;
+
+        /// @brief 127.0.0.1의 임의 포트에 바인딩
+        /// @return 성공한 경우 true
+        [[nodiscard]] bool OpenIpv4() noexcept
+        {
+            const WakeOnLan::SocketHandle handle = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+            if (handle == WakeOnLan::INVALID_SOCKET_HANDLE)
+                return false;
+
+            mSocket.Set(handle);
+
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            if (::bind(mSocket.Get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+                return false;
+
+            socklen_t addressLength = sizeof(address);
+            if (::getsockname(mSocket.Get(), reinterpret_cast<sockaddr*>(&address), &addressLength) != 0)
+                return false;
+
+            mPort = ntohs(address.sin_port);
+            return true;
+        }
+
+        /// @brief IPv6 임의 포트에 바인딩하고 인터페이스의 멀티캐스트 그룹에 가입
+        /// @param group 가입할 멀티캐스트 그룹 (예: ff02::1)
+        /// @param scopeId 그룹에 가입할 인터페이스 번호
+        /// @return 성공한 경우 true
+        [[nodiscard]] bool OpenIpv6Multicast(const WakeOnLan::Ipv6Address& group, const std::uint32_t scopeId) noexcept
+        {
+            const WakeOnLan::SocketHandle handle = ::socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+            if (handle == WakeOnLan::INVALID_SOCKET_HANDLE)
+                return false;
+
+            mSocket.Set(handle);
+
+            sockaddr_in6 address{};
+            address.sin6_family = AF_INET6;
+            address.sin6_addr = in6addr_any;
+            if (::bind(mSocket.Get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+                return false;
+
+            socklen_t addressLength = sizeof(address);
+            if (::getsockname(mSocket.Get(), reinterpret_cast<sockaddr*>(&address), &addressLength) != 0)
+                return false;
+
+            ipv6_mreq membership{};
+            std::memcpy(&membership.ipv6mr_multiaddr, group.data(), group.size());
+            membership.ipv6mr_interface = scopeId;
+            if (::setsockopt(mSocket.Get(), IPPROTO_IPV6, IPV6_JOIN_GROUP, reinterpret_cast<const char*>(&membership),
+                             sizeof(membership)) != 0)
+            {
+                return false;
+            }
+
+            mPort = ntohs(address.sin6_port);
+            return true;
+        }
+
+        /// @brief 바인딩한 포트를 반환 (호스트 바이트 순서)
+        [[nodiscard]] std::uint16_t GetPort() const noexcept { return mPort; }
+
+        /// @brief 데이터그램 하나를 받음
+        /// @param buffer 수신 버퍼 (매직 패킷보다 큰 데이터그램도 잘리지 않았는지 알 수 있도록 크게 준비)
+        /// @param size 수신 버퍼의 크기
+        /// @return 받은 데이터의 길이, RECEIVE_TIMEOUT 안에 받지 못했거나 실패한 경우 -1
+        [[nodiscard]] int Receive(std::byte* const buffer, const std::size_t size) noexcept
+        {
+            WakeOnLan::PollDescriptor descriptor{};
+            descriptor.fd = mSocket.Get();
+            descriptor.events = POLLIN;
+#ifdef _WIN32
+            const int ready = ::WSAPoll(&descriptor, 1U, static_cast<int>(RECEIVE_TIMEOUT.count()));
+#else
+            const int ready = ::poll(&descriptor, 1U, static_cast<int>(RECEIVE_TIMEOUT.count()));
+#endif
+            if (ready <= 0)
+                return -1;
+
+            return static_cast<int>(::recv(mSocket.Get(), reinterpret_cast<char*>(buffer), static_cast<int>(size), 0));
+        }
+
+    private:
+        /// @brief 수신 소켓
+        WakeOnLan::Socket mSocket;
+
+        /// @brief 바인딩한 포트 (호스트 바이트 순서)
+        std::uint16_t mPort{0U};
+    };
+}